@@ -0,0 +1,59 @@
+#include <benchmark/benchmark.h>
+#include <filesystem>
+#include "lecture.hxx"
+#include "sauvegardage.hxx"
+
+/* Dossier temporaire des fichiers VTU des microbenchmarks */
+static std::string dossierBench(){
+    std::string nomDossier = (std::filesystem::temp_directory_path() / "bench_simulation").string();
+    creerDossier(nomDossier);
+    return nomDossier;
+}
+
+/* Établir un univers bidimensionnel d'environ 40x40 cellules */
+static void configurerUnivers(){
+    Configuration& configuration = Configuration::getInstance();
+    configuration.setConditionLimite(ConditionLimite::Periodique);
+    configuration.setRCut(2.5);
+    configuration.setLd(100, 100, 0);
+}
+
+/* Écrire un fichier VTU de state.range(0) particules */
+static void BM_SauvegarderEtatEnVTU(benchmark::State& state){
+    configurerUnivers();
+    Univers univers;
+    univers.ajouterParticulesAleatoires(state.range(0));
+    univers.remplirCellules();
+    std::string nomDossier = dossierBench();
+
+    for(auto _ : state){
+        sauvegarderEtatEnVTU(nomDossier, univers, 0);
+    }
+
+    state.SetBytesProcessed(state.iterations() * std::filesystem::file_size(nomDossier + "/Iteration.0.vtu"));
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_SauvegarderEtatEnVTU)->RangeMultiplier(10)->Range(1000, 100000)->Unit(benchmark::kMillisecond);
+
+/* Lire un fichier VTU ASCII de state.range(0) particules */
+static void BM_LectureDuFichier(benchmark::State& state){
+    configurerUnivers();
+    std::string nomDossier = dossierBench();
+    {
+        Univers univers;
+        univers.ajouterParticulesAleatoires(state.range(0));
+        univers.remplirCellules();
+        sauvegarderEtatEnVTU(nomDossier, univers, 1);
+    }
+    std::string adresseFichier = nomDossier + "/Iteration.1.vtu";
+
+    for(auto _ : state){
+        Univers univers;
+        lectureDuFichier(adresseFichier, univers);
+        benchmark::DoNotOptimize(univers.getGrille().data());
+    }
+
+    state.SetBytesProcessed(state.iterations() * std::filesystem::file_size(adresseFichier));
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_LectureDuFichier)->RangeMultiplier(10)->Range(1000, 100000)->Unit(benchmark::kMillisecond);
@@ -0,0 +1,43 @@
+#include <benchmark/benchmark.h>
+#include "simulation.hxx"
+
+/* Accès aux noyaux de calcul privés de la simulation */
+class AccesNoyauxSimulation{
+
+    public:
+
+        static void calculerForceSurParticule(Simulation& simulation, const Cellule& cellule, Particule* particule){
+            simulation.calculerForceSurParticule(cellule, particule);
+        }
+
+};
+
+/* Calculer les forces de paires d'un univers périodique de 5x5x5 cellules
+dont chaque cellule contient en moyenne state.range(0) particules */
+static void BM_CalculerForceSurParticule(benchmark::State& state){
+
+    /* Établir la configuration de l'univers */
+    Configuration& configuration = Configuration::getInstance();
+    configuration.setConditionLimite(ConditionLimite::Periodique);
+    configuration.setForces(true, false, false);
+    configuration.setSorties(false);
+    configuration.setRCut(2.5);
+    configuration.setLd(12.5, 12.5, 12.5);
+
+    Univers univers;
+    const int densite = state.range(0);
+    univers.ajouterParticulesAleatoires(densite * 125);
+    Simulation simulation(univers);
+
+    for(auto _ : state){
+        for(const auto& cellule : univers.getGrille()){
+            for(const auto particule : cellule.getParticules()){
+                AccesNoyauxSimulation::calculerForceSurParticule(simulation, cellule, particule);
+            }
+        }
+    }
+
+    state.SetItemsProcessed(state.iterations() * univers.getNombreParticules());
+    state.counters["densite"] = densite;
+}
+BENCHMARK(BM_CalculerForceSurParticule)->RangeMultiplier(2)->Range(1, 64)->Unit(benchmark::kMicrosecond);
@@ -0,0 +1,66 @@
+#include <benchmark/benchmark.h>
+#include <random>
+#include "univers.hxx"
+
+/* Établir un univers périodique cubique de n cellules par direction */
+static void configurerUnivers(int n){
+    Configuration& configuration = Configuration::getInstance();
+    configuration.setConditionLimite(ConditionLimite::Periodique);
+    configuration.setRCut(2.5);
+    configuration.setLd(2.5 * n, 2.5 * n, 2.5 * n);
+}
+
+/* Construire la grille et le stencil des voisines selon la taille de la grille */
+static void BM_ConstructionUnivers(benchmark::State& state){
+    const int n = state.range(0);
+    configurerUnivers(n);
+
+    for(auto _ : state){
+        Univers univers;
+        benchmark::DoNotOptimize(univers.getGrille().data());
+    }
+
+    state.SetItemsProcessed(state.iterations() * n * n * n);
+    state.counters["cellules"] = n * n * n;
+}
+BENCHMARK(BM_ConstructionUnivers)->RangeMultiplier(2)->Range(4, 64)->Unit(benchmark::kMillisecond);
+
+/* Corriger les cellules après avoir fait changer de cellule
+state.range(0) pour cent des particules */
+static void BM_CorrigerCellules(benchmark::State& state){
+    configurerUnivers(20);
+
+    Univers univers;
+    univers.ajouterParticulesAleatoires(20000);
+    univers.remplirCellules();
+
+    /* Choisir les particules qui migrent */
+    std::vector<Particule*> particules;
+    for(const auto& cellule : univers.getGrille()){
+        for(const auto particule : cellule.getParticules()){
+            particules.push_back(particule);
+        }
+    }
+    std::mt19937 mt(42);
+    std::shuffle(particules.begin(), particules.end(), mt);
+    const size_t nombreMigrations = particules.size() * state.range(0) / 100;
+
+    double sens = 1;
+    for(auto _ : state){
+        state.PauseTiming();
+        for(size_t i = 0; i < particules.size(); i++){
+            if(i < nombreMigrations){
+                univers.deplacerParticule(particules[i], Vecteur<double>(sens * univers.getRCut(), 0, 0));
+            }
+            particules[i]->setCelluleConfirmee(false);
+        }
+        sens = -sens;
+        state.ResumeTiming();
+
+        univers.corrigerCellules();
+    }
+
+    state.SetItemsProcessed(state.iterations() * particules.size());
+    state.counters["migrations"] = nombreMigrations;
+}
+BENCHMARK(BM_CorrigerCellules)->Arg(0)->Arg(1)->Arg(10)->Arg(50)->Unit(benchmark::kMicrosecond);
@@ -0,0 +1,49 @@
+#include <benchmark/benchmark.h>
+#include <vector>
+#include "vecteur.hxx"
+
+/* Préparer des vecteurs réguliers dont les normes ne sont jamais nulles */
+static std::vector<Vecteur<double>> creerVecteurs(size_t n){
+    std::vector<Vecteur<double>> vecteurs;
+    vecteurs.reserve(n);
+    for(size_t i = 0; i < n; i++){
+        vecteurs.emplace_back(1.0 + i % 7, 2.0 - i % 5, 0.5 + i % 3);
+    }
+    return vecteurs;
+}
+
+/* Combinaison linéaire a += b * s, comme dans l'intégrateur */
+static void BM_VecteurCombinaison(benchmark::State& state){
+    std::vector<Vecteur<double>> a = creerVecteurs(state.range(0));
+    std::vector<Vecteur<double>> b = creerVecteurs(state.range(0));
+
+    for(auto _ : state){
+        for(size_t i = 0; i < a.size(); i++){
+            a[i] += b[i] * 1e-6;
+        }
+        benchmark::DoNotOptimize(a.data());
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_VecteurCombinaison)->Arg(1024)->Arg(65536);
+
+/* Différence, norme et mise à l'échelle, comme dans le calcul des forces */
+static void BM_VecteurForce(benchmark::State& state){
+    std::vector<Vecteur<double>> a = creerVecteurs(state.range(0));
+    std::vector<Vecteur<double>> b = creerVecteurs(state.range(0) + 1);
+
+    for(auto _ : state){
+        Vecteur<double> somme;
+        for(size_t i = 0; i < a.size(); i++){
+            Vecteur<double> direction = b[i + 1] - a[i];
+            double distance = direction.norme();
+            somme += direction * (1 / (distance + 1));
+        }
+        benchmark::DoNotOptimize(somme);
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_VecteurForce)->Arg(1024)->Arg(65536);
@@ -0,0 +1,21 @@
+#include "trajectoire.hxx"
+
+/* Convertir un fichier de trajectoire en fichiers VTU lisibles par ParaView */
+int main(int argc, char *argv[]){
+
+    if(argc != 3){
+        std::cerr << "Utilisation : " << argv[0] << " <fichier de trajectoire> <dossier de sortie>" << std::endl;
+        return 1;
+    }
+
+    try{
+        LecteurTrajectoire lecteur(argv[1]);
+        std::cout << "Conversion de " << lecteur.getNombreFrames() << " frames vers " << argv[2] << "\n";
+        convertirTrajectoireEnVTU(argv[1], argv[2]);
+    }catch(const std::exception& e){
+        std::cerr << "Erreur : " << e.what() << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
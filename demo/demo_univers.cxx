@@ -13,7 +13,8 @@
 * 2. Mode de mesure des performances : C'est un mode secondaire dans lequel les performances
 *    des collections standard de C++ sont évaluées pour différentes tailles de données. \n
 *    De plus, il mesure le temps nécessaire à la création d'un univers de différentes 
-*    tailles de particules. \n
+*    tailles de particules, puis compare les conteneurs de cellule (voir l'option
+*    CONTENEUR_CELLULE de CMake) sur l'ajout, le parcours des voisines et la migration. \n
 *
 * ## Mode de simulation
 * 
@@ -24,14 +25,37 @@
 * 2. Absorption : Les particules disparaissent lorsqu'elles atteignent les limites de l'univers. 
 * 3. Périodique : Les particules se déplacent dans un univers périodique. \n
 *
+* Des obstacles statiques (plans, sphères, boîtes ou champ de distance signée voxelisé)
+* peuvent être décrits dans le fichier FICHIER_OBSTACLES. Comme les faces de la boîte \n
+* en réflexion, ils repoussent les particules par une force de Lennard-Jones, calculée
+* uniquement dans les cellules à leur portée. \n
+*
+* En absorption, l'univers peut être ouvert : les sources du fichier FICHIER_SOURCES
+* injectent des particules sur une face à un débit et une vitesse donnés, dans les \n
+* emplacements libérés par les particules absorbées. Celles-ci sont retirées du stockage
+* toutes les INTERVALLE_COMPACTION itérations sans changer l'identifiant des autres, si bien \n
+* qu'une longue simulation ouverte garde une mémoire et un coût par itération constants. \n
+*
 *
 * Pour simplifier les calculs, les forces d'interaction ne sont calculées que si la distance
 * entre les particules est inférieure à rCut. Ainsi, seules les particules qui contribuent \n
 * à une attraction significative sont prises en compte. \n \n
 *
+* Les cellules pavent exactement l'univers et mesurent au moins rCut/k, k étant donné par
+* SUBDIVISION_CELLULES. Chaque particule parcourt les cellules dont la distance minimale \n
+* à la sienne est inférieure à rCut : avec k = 2 ou 3, ce voisinage épouse mieux la sphère
+* de coupure que les 27 cellules de côté rCut, et moins de distances sont calculées. \n \n
+*
 * D'autre part, les particules d'entrée à la simulation doivent être centrées autour du point
 * (0, 0, 0). Elles doivent être fournies via un fichier vtu, dont le nom sera identique à \n
-* celui du dossier de sortie contenant les fichiers de sortie.
+* celui du dossier de sortie contenant les fichiers de sortie. Les tableaux du fichier vtu peuvent
+* être au format ascii, binary (base64, éventuellement compressé avec zlib) ou appended, en \n
+* Float32 ou Float64. Les tableaux optionnels Categorie et Id sont également lus.
+* Les particules sans identifiant sont numérotées par l'univers à partir de 1. \n \n
+*
+* Pour les univers de plus de 10^8 particules, l'option GRAND_SYSTEME de CMake stocke
+* les vitesses, forces et masses en simple précision, ce qui ramène une \n
+* particule à 64 octets ; les calculs restent faits en double précision.
 *
 * ## Fichier de configuration
 * 
@@ -55,6 +79,37 @@
 * - G = Définit la valeur de G (défaut : -12)
 * - DELTA = Définit la valeur de delta avec laquelle le temps est incrémenté dans la simulation (défaut : 0.00005)
 * - T_FINAL = Définit le temps de fin de la simulation (défaut : 19.5)
+* - SORTIES = NON pour n'écrire aucun fichier de sortie, par exemple pour mesurer le débit (défaut : OUI)
+* - INTERVALLE_JOURNAL = Définit le nombre d'itérations entre deux écritures du journal, 0 pour le désactiver (défaut : 1000)
+* - INTERVALLE_JOURNAL_TEMPS = Définit le temps simulé entre deux écritures du journal, prioritaire s'il est positif (défaut : 0)
+* - INTERVALLE_VTU = Définit le nombre d'itérations entre deux fichiers VTU ou frames de trajectoire, 0 pour les désactiver (défaut : 1000)
+* - INTERVALLE_VTU_TEMPS = Définit le temps simulé entre deux fichiers VTU ou frames de trajectoire, prioritaire s'il est positif (défaut : 0)
+* - INTERVALLE_REPRISE = Définit le nombre d'itérations entre deux points de reprise, 0 pour les désactiver (défaut : 0)
+* - FICHIER_REPRISE = Définit le point de reprise à partir duquel la simulation redémarre (défaut : aucun)
+* - TRAJECTOIRE = OUI pour écrire les états dans un fichier de trajectoire unique au lieu de fichiers VTU (défaut : NON)
+* - TRAJECTOIRE_FORCES = OUI pour écrire aussi les forces dans le fichier de trajectoire (défaut : NON)
+* - TRAJECTOIRE_COMPRESSION = OUI pour quantifier les frames de la trajectoire et les coder par différence (défaut : NON)
+* - TRAJECTOIRE_PRECISION = Définit le pas de quantification des positions et des vitesses de la trajectoire compressée (défaut : 0.0001)
+* - TRAJECTOIRE_IMAGES_CLES = Définit le nombre de frames entre deux images clés de la trajectoire compressée (défaut : 10)
+* - JOURNAL_FORMAT = Définit le format du journal des particules. 'CSV', 'BINAIRE' ou 'AUCUN' (défaut : CSV)
+* - JOURNAL_CHAMPS = Définit les champs du journal parmi id, categorie, position, vitesse, force et masse (défaut : id,categorie,position,vitesse,masse)
+* - JOURNAL_ECHANTILLONNAGE = Définit le pas d'échantillonnage : seules les particules d'identifiant multiple de ce pas sont écrites (défaut : 1)
+* - REDUCTION_INTERVALLE = Définit le nombre d'itérations entre deux fichiers VTI de champs réduits (densité, vitesse, température), 0 pour les désactiver (défaut : 0)
+* - REDUCTION_FACTEUR = Définit le nombre de cellules par voxel et par direction des champs réduits (défaut : 1)
+* - INTERVALLE_CHRONOMETRAGE = Définit le nombre d'itérations entre deux affichages des chronomètres des phases, 0 pour un affichage en fin de simulation uniquement (défaut : 0)
+* - COMPTEURS_MATERIELS = OUI pour lire les compteurs de performance matériels (cycles, instructions, défauts de cache et de branchement) de chaque phase et de chaque thread (défaut : NON)
+* - TRACE = OUI pour écrire la chronologie des phases, des tâches de chaque thread et des entrées-sorties dans trace.json, lisible dans Perfetto (défaut : NON)
+* - TRACE_DEBUT = Définit la première itération enregistrée dans la trace (défaut : 0)
+* - TRACE_FIN = Définit la dernière itération enregistrée dans la trace, négative pour aller jusqu'à la fin (défaut : 100)
+* - MEMOIRE_MAXIMALE = Définit la mémoire autorisée en Mo : une configuration dont l'estimation la dépasse est refusée avant d'être construite, 0 pour la mémoire physique de la machine (défaut : 0)
+* - GRAINE = Définit la graine des particules aléatoires : un même couple (graine, indice de particule) donne toujours le même tirage, quel que soit le nombre de threads (défaut : 0)
+* - FICHIER_OBSTACLES = Définit le fichier des obstacles statiques (PLAN, SPHERE, BOITE ou CHAMP de distance signée, un par ligne) (défaut : aucun)
+* - FICHIER_SOURCES = Définit le fichier des sources qui injectent des particules sur une face de l'univers (SOURCE face débit vx vy vz [masse [catégorie]], une par ligne) (défaut : aucun)
+* - SUBDIVISION_CELLULES = Définit le nombre k de cellules par rayon de coupure et par direction, de 1 à 4 : des cellules plus petites réduisent le nombre de distances calculées (défaut : 1)
+* - DETERMINISTE = OUI pour obtenir des résultats identiques bit à bit quel que soit le nombre de threads : chaque particule accumule ses forces dans un ordre fixe et l'énergie cinétique est sommée par paires, au prix de deux fois plus de distances calculées (défaut : NON)
+* - DIFFUSION = Définit le nom du segment de mémoire partagée dans lequel l'état des particules est publié en direct, lisible par lire_diffusion (défaut : aucun)
+* - INTERVALLE_DIFFUSION = Définit le nombre d'itérations entre deux frames diffusées (défaut : 100)
+* - INTERVALLE_COMPACTION = Définit le nombre d'itérations entre deux compactions, qui retirent du stockage les particules absorbées, 0 pour aucune (défaut : 1000)
 *
 * ## Exemple de configuration :
 * 
@@ -152,10 +207,12 @@ int main(int argc, char *argv[]){
             /* Mesurer le temps de début de la simulation */
             auto start = std::chrono::steady_clock::now();
 
-            /* Créer un univers et lire le fichier .vtu d'entrée */
+            /* Créer un univers et lire le fichier .vtu d'entrée, sauf en cas de reprise */
             Univers univers;
-            const std::string& adresseFichier = configuration.getAdresseFichier();
-            lectureDuFichier(adresseFichier, univers);
+            if(configuration.getFichierReprise().empty()){
+                const std::string& adresseFichier = configuration.getAdresseFichier();
+                lectureDuFichier(adresseFichier, univers);
+            }
     
             /* Créer la simulation et démarrer l'algorithme de Stromer-Verlet */
             Simulation simulation(univers);
@@ -174,59 +231,3 @@ int main(int argc, char *argv[]){
     return 0;
 }
 
-
-/*  
-double distance = pow(2, 1.0/6);
-
-double xCarre = -pow(2, 1.0/6)*20;
-double yCarre = 8;
-double zCarre = 0;
-for(int i = 0; i < 40; i++){
-    for(int j = 0; j < 40; j++){
-        Particule particuleCarre("carre", xCarre + i*distance, yCarre + j*distance, zCarre, 0,-10,0, 1);
-        univers.ajouterParticule(particuleCarre);
-    }
-}
-
-double xRectangle = -pow(2, 1.0/6)*80;
-double yRectangle = -pow(2, 1.0/6)*40 + 4;
-double zRectangle = 0;
-for(int i = 0; i < 160; i++){
-    for(int j = 0; j < 40; j++){
-        Particule particuleRectangle("rectangle", xRectangle + i*distance, yRectangle + j*distance, zRectangle, 0,0,0, 1);
-        univers.ajouterParticule(particuleRectangle);
-    }
-}*/
-
-/*
-double xCircle = 0;
-double yCircle = 20;
-double zCircle = 0;
-double radius = 13;
-double changeAnglePrev = 0;
-int nombreParticulesPerCercle = 1;
-
-double distance = 1.2;
-for(double j = 1; j < radius; j = j+distance){
-    nombreParticulesPerCercle += 6;
-    double changeAngle = 2 * M_PI / nombreParticulesPerCercle;
-    for(int i = 0; i < nombreParticulesPerCercle; i++){
-        double xPoint = xCircle + j * cos(changeAngle*i + changeAnglePrev);
-        double yPoint = yCircle + j * sin(changeAngle*i + changeAnglePrev);
-        Particule particle("circle", xPoint, yPoint, zCircle, 0,-10,0, 10);
-        univers.ajouterParticule(particle);
-    }
-    changeAnglePrev = changeAngle;
-}
-
-double xRectangle = -125;
-double yRectangle = -90;
-double zRectangle = 0;
-
-distance = 0.8;
-for(int i = 0; i < 312; i++){
-    for(int j = 0; j < 55; j++){
-        Particule particuleRectangle("rectangle", xRectangle + i*distance, yRectangle + j*distance, zRectangle, 0,0,0, 1);
-        univers.ajouterParticule(particuleRectangle);
-    }
-}*/
\ No newline at end of file
@@ -0,0 +1,98 @@
+#include <chrono>
+#include <cmath>
+#include <thread>
+#include "diffusion.hxx"
+#include "trajectoire.hxx"
+
+/* Suivre en direct les frames diffusées par une simulation, et les
+sauvegarder en fichiers VTU si un dossier est donné */
+int main(int argc, char *argv[]){
+
+    if(argc < 2 || argc > 3){
+        std::cerr << "Utilisation : " << argv[0] << " <segment> [dossier VTU]\n"
+                  << "  Le segment est la valeur de DIFFUSION dans la configuration de la simulation." << std::endl;
+        return 1;
+    }
+
+    try{
+        /* Attendre que la simulation crée le segment */
+        std::unique_ptr<LecteurDiffusion> lecteur;
+        for(int essai = 0; !lecteur; essai++){
+            try{
+                lecteur.reset(new LecteurDiffusion(argv[1]));
+            }catch(const std::runtime_error&){
+                if(essai == 100){
+                    throw;
+                }
+                std::this_thread::sleep_for(std::chrono::milliseconds(100));
+            }
+        }
+        if(argc == 3){
+            creerDossier(argv[2]);
+        }
+        std::cout << "Attaché au segment " << argv[1] << " (capacité " << lecteur->getEntete().capacite << " particules)\n";
+
+        /* Lire chaque nouvelle frame sans la copier ; celles réécrites
+        pendant leur lecture sont ignorées, la suivante les remplaçant */
+        uint64_t derniere = 0;
+        FrameDiffusion frame;
+        while(true){
+            bool terminee = lecteur->estTerminee();
+            if(lecteur->lireDerniereFrame(frame) && frame.numero != derniere){
+                double energie = 0;
+                double vitesseMaximale = 0;
+                for(uint64_t k = 0; k < frame.nombreParticules; k++){
+                    const float* v = frame.vitesses + 3*k;
+                    double carre = v[0]*v[0] + v[1]*v[1] + v[2]*v[2];
+                    energie += 0.5 * frame.masses[k] * carre;
+                    vitesseMaximale = std::max(vitesseMaximale, carre);
+                }
+
+                /* Copier les colonnes avant d'écrire le fichier VTU, bien plus lent que la publication d'une frame */
+                FrameTrajectoire copie;
+                std::vector<int64_t> ids;
+                std::vector<float> positions, vitesses, masses;
+                std::vector<uint32_t> categories;
+                if(argc == 3){
+                    ids.assign(frame.ids, frame.ids + frame.nombreParticules);
+                    positions.assign(frame.positions, frame.positions + 3*frame.nombreParticules);
+                    vitesses.assign(frame.vitesses, frame.vitesses + 3*frame.nombreParticules);
+                    masses.assign(frame.masses, frame.masses + frame.nombreParticules);
+                }
+
+                if(lecteur->estValide(frame)){
+                    derniere = frame.numero;
+                    std::cout << "Itération " << frame.iteration << "\ttemps " << frame.temps << "\tparticules " << frame.nombreParticules;
+                    if(frame.nombreTotal > frame.nombreParticules){
+                        std::cout << "/" << frame.nombreTotal;
+                    }
+                    std::cout << "\ténergie cinétique " << energie << "\tvitesse maximale " << std::sqrt(vitesseMaximale) << std::endl;
+
+                    if(argc == 3){
+                        categories.assign(ids.size(), 0);
+                        copie.iteration = frame.iteration;
+                        copie.temps = frame.temps;
+                        copie.nombreParticules = ids.size();
+                        copie.ids = ids.data();
+                        copie.positions = positions.data();
+                        copie.vitesses = vitesses.data();
+                        copie.masses = masses.data();
+                        copie.categories = categories.data();
+                        sauvegarderFrameEnVTU(std::string(argv[2]) + "/Iteration." + std::to_string(frame.iteration) + ".vtu", copie);
+                    }
+                }
+                continue;
+            }
+            if(terminee){
+                break;
+            }
+            std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        }
+        std::cout << "Simulation terminée" << std::endl;
+    }catch(const std::exception& e){
+        std::cerr << "Erreur : " << e.what() << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,69 @@
+#include <fstream>
+#include <sstream>
+#include "mise_a_echelle.hxx"
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+/* Lire une liste d'entiers séparés par des virgules */
+static std::vector<int> lireListe(const std::string& texte){
+    std::vector<int> valeurs;
+    std::stringstream flux(texte);
+    std::string valeur;
+    while(std::getline(flux, valeur, ',')){
+        valeurs.push_back(std::stoi(valeur));
+    }
+    return valeurs;
+}
+
+/* Mesurer la mise à l'échelle forte ou faible d'un scénario de collision, ou celle du mode déterministe */
+int main(int argc, char *argv[]){
+
+    if(argc < 5 || argc > 7){
+        std::cerr << "Utilisation : " << argv[0] << " <carre|disque> <forte|faible|deterministe> <pas> <tailles> [threads] [fichier CSV]\n"
+                  << "  tailles et threads sont des listes séparées par des virgules, par exemple 8000,32000 et 1,2,4.\n"
+                  << "  En mise à l'échelle faible, les tailles sont des nombres de particules par thread.\n"
+                  << "  Le mode deterministe mesure DETERMINISTE = OUI en mise à l'échelle forte, par rapport au mode par défaut.\n"
+                  << "  Par défaut, les threads vont de 1 au maximum disponible par puissances de 2." << std::endl;
+        return 1;
+    }
+
+    try{
+        Scenario scenario = lireScenario(argv[1]);
+        std::string mode = argv[2];
+        if(mode != "forte" && mode != "faible" && mode != "deterministe"){
+            throw std::invalid_argument("Mode inconnu : " + mode);
+        }
+        int pas = std::stoi(argv[3]);
+        std::vector<int> tailles = lireListe(argv[4]);
+
+        std::vector<int> threads;
+        if(argc >= 6){
+            threads = lireListe(argv[5]);
+        }else{
+            int maximum = 1;
+#ifdef _OPENMP
+            maximum = omp_get_max_threads();
+#endif
+            for(int p = 1; p < maximum; p *= 2){
+                threads.push_back(p);
+            }
+            threads.push_back(maximum);
+        }
+
+        if(argc == 7){
+            std::ofstream fichierCSV(argv[6]);
+            if(!fichierCSV.is_open()){
+                throw std::runtime_error("Impossible d'ouvrir le fichier " + std::string(argv[6]));
+            }
+            mesurerMiseAEchelle(fichierCSV, scenario, mode == "faible", tailles, threads, pas, mode == "deterministe");
+        }else{
+            mesurerMiseAEchelle(std::cout, scenario, mode == "faible", tailles, threads, pas, mode == "deterministe");
+        }
+    }catch(const std::exception& e){
+        std::cerr << "Erreur : " << e.what() << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
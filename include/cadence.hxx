@@ -0,0 +1,58 @@
+#pragma once
+
+#include <cmath>
+
+/**
+* @brief
+* Classe qui décide à quelles itérations une sortie doit être écrite,
+* soit toutes les n itérations, soit à intervalles réguliers de temps
+* simulé. Un intervalle de temps positif l'emporte sur l'intervalle en
+* itérations ; si les deux sont nuls, la sortie est désactivée.
+*/
+
+class Cadence{
+
+    private:
+
+        int intervalleIterations; /**< Nombre d'itérations entre deux sorties. */
+        double intervalleTemps; /**< Temps simulé entre deux sorties. */
+        double prochainTemps; /**< Temps de la prochaine sortie en mode temporel. */
+        bool initialisee; /**< Indique si le prochain temps a été calculé. */
+
+    public:
+
+        /* Constructeur */
+
+        /**
+        * @brief
+        * Constructeur de la classe Cadence.
+        * @param intervalleIterations est le nombre d'itérations entre deux sorties.
+        * @param intervalleTemps est le temps simulé entre deux sorties.
+        */
+
+        Cadence(int intervalleIterations = 0, double intervalleTemps = 0);
+
+        /* Méthodes publiques */
+
+        /**
+        * @brief
+        * Fonction qui indique si une sortie doit être écrite à cette
+        * itération. En mode temporel, elle doit être appelée à chaque
+        * itération, dans l'ordre : la première sortie a lieu au premier
+        * multiple de l'intervalle atteint, y compris après une reprise.
+        * @param[in] iteration est le numéro de l'itération.
+        * @param[in] temps est le temps simulé au début de l'itération.
+        * @return true si la sortie doit être écrite, false sinon.
+        */
+
+        bool doitSortir(int iteration, double temps);
+
+        /**
+        * @brief
+        * Fonction qui indique si la sortie est activée.
+        * @return true si l'un des intervalles est positif, false sinon.
+        */
+
+        bool estActive() const;
+
+};
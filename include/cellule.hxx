@@ -1,19 +1,21 @@
 #pragma once
 
 #include "collections.hxx"
+#include "conteneurs.hxx"
 #include "particule.hxx"
 
 /**
 * @brief 
 * Classe représentant une cellule de l'univers de particules.
+* @tparam Conteneur est le conteneur des pointeurs vers les particules.
 */
 
-class Cellule{
+template <typename Conteneur>
+class CelluleGenerique{
 
     private:
 
-        std::list<Particule*> particules; /**< List de pointeurs vers les particules contenues dans la cellule. */
-        std::vector<Cellule*> voisines; /**< Vecteur de pointeurs vers les cellules voisines. */
+        Conteneur particules; /**< Conteneur de pointeurs vers les particules contenues dans la cellule. */
 
         Vecteur<int> indices; /**< Indices identifiant la position de la cellule dans l'univers. */
         bool bord; /**< Indique si la cellule se trouve sur le bord de l'univers. */
@@ -27,19 +29,22 @@ class Cellule{
         * Constructeur par défaut de la classe Cellule.
         */
 
-        Cellule();
+        CelluleGenerique();
         
         /* Méthodes publiques */
 
         /**
         * @brief 
         * Fonction qui supprime un pointeur de la liste de particules 
-        * en utilisant un itérateur fourni comme argument.
+        * en utilisant un itérateur fourni comme argument. Pour les
+        * conteneurs à accès direct, le dernier élément prend la place
+        * de l'élément supprimé : l'itérateur renvoyé désigne alors cet
+        * élément, et l'ordre des particules n'est pas conservé.
         * @param it est le itérateur.
         * @return L'itérateur suivant après l'élément supprimé.
         */
 
-        std::list<Particule*>::const_iterator suprimerParticule(std::list<Particule*>::const_iterator it);
+        typename Conteneur::const_iterator suprimerParticule(typename Conteneur::const_iterator it);
 
         /**
         * @brief 
@@ -48,14 +53,25 @@ class Cellule{
         */
 
         void ajouterParticule(Particule* particule);
-        
+
         /**
         * @brief 
-        * Fonction qui ajoute une cellule voisine.
-        * @param voisine est le pointeur vers la cellule voisine à ajouter.
+        * Fonction qui remplace le pointeur désigné par un itérateur,
+        * sans changer l'ordre des particules de la cellule. Une colonie
+        * réutilise l'emplacement qui vient d'être libéré.
+        * @param it est l'itérateur vers le pointeur à remplacer.
+        * @param particule est le nouveau pointeur.
+        * @return Itérateur vers le nouveau pointeur.
         */
-        
-        void ajouterVoisine(Cellule* voisine);
+
+        typename Conteneur::const_iterator remplacerParticule(typename Conteneur::const_iterator it, Particule* particule);
+
+        /**
+        * @brief 
+        * Fonction qui retire toutes les particules de la cellule.
+        */
+
+        void vider();
 
         /**
         * @brief 
@@ -76,15 +92,7 @@ class Cellule{
         * @return Vecteur de pointeurs vers les particules contenues.
         */
 
-        const std::list<Particule*>& getParticules() const;
-        
-        /**
-        * @brief 
-        * Fonction qui obtient les cellules voisines.
-        * @return Vecteur de pointeurs vers les cellules voisines.
-        */
-        
-        const std::vector<Cellule*>& getVoisines() const;
+        const Conteneur& getParticules() const;
         
         /**
         * @brief 
@@ -123,3 +131,23 @@ class Cellule{
         void setBord(bool newBord);
 
 };
+
+/* Conteneur des particules d'une cellule, choisi à la compilation
+   (option CONTENEUR_CELLULE de CMake) */
+#if defined(CELLULE_VECTOR)
+using ConteneurParticules = std::vector<Particule*>;
+#elif defined(CELLULE_DEQUE)
+using ConteneurParticules = std::deque<Particule*>;
+#elif defined(CELLULE_PETIT_VECTEUR)
+using ConteneurParticules = PetitVecteur<Particule*, 16>;
+#elif defined(CELLULE_COLONIE)
+using ConteneurParticules = Colonie<Particule*>;
+#else
+using ConteneurParticules = std::list<Particule*>;
+#endif
+
+using Cellule = CelluleGenerique<ConteneurParticules>;
+
+extern template class CelluleGenerique<ConteneurParticules>;
+
+#include "cellule.txx"
@@ -0,0 +1,78 @@
+/* Constructeur */
+
+template <typename Conteneur>
+CelluleGenerique<Conteneur>::CelluleGenerique() : bord(false) {}
+
+/* Méthodes publiques */
+
+template <typename Conteneur>
+typename Conteneur::const_iterator CelluleGenerique<Conteneur>::suprimerParticule(typename Conteneur::const_iterator it){
+    using Categorie = typename std::iterator_traits<typename Conteneur::const_iterator>::iterator_category;
+    if constexpr(std::is_base_of<std::random_access_iterator_tag, Categorie>::value){
+        /* Échange avec le dernier élément : aucun décalage des suivants */
+        auto indice = it - particules.cbegin();
+        particules.begin()[indice] = particules.back();
+        particules.pop_back();
+        return particules.cbegin() + indice;
+    }else{
+        return particules.erase(it);
+    }
+}
+
+template <typename Conteneur>
+void CelluleGenerique<Conteneur>::ajouterParticule(Particule* particule) {
+    particules.insert(particules.end(), particule);
+}
+
+template <typename Conteneur>
+typename Conteneur::const_iterator CelluleGenerique<Conteneur>::remplacerParticule(typename Conteneur::const_iterator it, Particule* particule){
+    using Categorie = typename std::iterator_traits<typename Conteneur::const_iterator>::iterator_category;
+    if constexpr(std::is_base_of<std::random_access_iterator_tag, Categorie>::value){
+        auto indice = it - particules.cbegin();
+        particules.begin()[indice] = particule;
+        return particules.cbegin() + indice;
+    }else{
+        return particules.insert(particules.erase(it), particule);
+    }
+}
+
+template <typename Conteneur>
+void CelluleGenerique<Conteneur>::vider(){
+    particules.clear();
+}
+
+template <typename Conteneur>
+bool CelluleGenerique<Conteneur>::comparerIndices(int autreX, int autreY, int autreZ) const{
+    return indices.getX() == autreX && indices.getY() == autreY && indices.getZ() == autreZ;
+}
+
+/* Getters */
+
+template <typename Conteneur>
+const Conteneur& CelluleGenerique<Conteneur>::getParticules() const{
+    return particules;
+}
+
+template <typename Conteneur>
+const Vecteur<int>& CelluleGenerique<Conteneur>::getIndices() const{
+    return indices;
+}
+
+template <typename Conteneur>
+bool CelluleGenerique<Conteneur>::isBord() const{
+    return bord;
+}
+
+/* Setters */
+
+template <typename Conteneur>
+void CelluleGenerique<Conteneur>::setIndices(int newX, int newY, int newZ){
+    indices.setX(newX);
+    indices.setY(newY);
+    indices.setZ(newZ);
+}
+
+template <typename Conteneur>
+void CelluleGenerique<Conteneur>::setBord(bool newBord){
+    bord = newBord;
+}
@@ -0,0 +1,199 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+
+/**
+* @brief
+* Énumération des phases chronométrées d'une itération de la simulation.
+*/
+
+enum class Phase{ Derive, CorrectionCellules, Injection, Compaction, ForcesReflexion, ForcesPaires, Kick, LimitationVitesse,
+                  SortieTexte, SortieVTU, Diffusion, Reduction, Reprise, Nombre };
+
+/**
+* @brief
+* Énumération des compteurs d'événements de la simulation.
+*/
+
+enum class Compteur{ PairesEvaluees, Interactions, Nombre };
+
+/**
+* @brief
+* Classe singleton qui accumule la durée et le nombre d'appels de
+* chaque phase, ainsi que des compteurs d'événements. Elle est
+* alimentée par les macros CHRONOMETRER et COMPTER, qui disparaissent
+* à la compilation si AVEC_CHRONOMETRAGE n'est pas défini (option
+* CMake CHRONOMETRAGE).
+*/
+
+class Chronometrage{
+
+    private:
+
+        int64_t durees[static_cast<int>(Phase::Nombre)]; /**< Durée cumulée de chaque phase, en nanosecondes. */
+        uint64_t appels[static_cast<int>(Phase::Nombre)]; /**< Nombre d'exécutions de chaque phase. */
+        uint64_t compteurs[static_cast<int>(Compteur::Nombre)]; /**< Valeur de chaque compteur. */
+
+        /**
+        * @brief
+        * Constructeur privé par défaut de la classe Chronometrage.
+        */
+
+        Chronometrage();
+
+        /**
+        * @brief
+        * Constructeur de copie supprimé pour empêcher la copie de l'instance.
+        */
+
+        Chronometrage(const Chronometrage&) = delete;
+
+        /**
+        * @brief
+        * Opérateur d'assignation supprimé pour empêcher l'assignation de l'instance.
+        */
+
+        void operator=(const Chronometrage&) = delete;
+
+    public:
+
+        /**
+        * @brief
+        * Fonction qui obtient l'instance unique de la classe Chronometrage.
+        * @return Référence à l'instance unique.
+        */
+
+        static Chronometrage& getInstance();
+
+        /* Méthodes publiques */
+
+        /**
+        * @brief
+        * Fonction qui ajoute une durée à une phase.
+        * @param[in] phase est la phase chronométrée.
+        * @param[in] duree est la durée en nanosecondes.
+        */
+
+        void ajouter(Phase phase, int64_t duree){
+            durees[static_cast<int>(phase)] += duree;
+            appels[static_cast<int>(phase)]++;
+        }
+
+        /**
+        * @brief
+        * Fonction qui incrémente un compteur, y compris depuis
+        * plusieurs threads.
+        * @param[in] compteur est le compteur.
+        * @param[in] n est la valeur à ajouter.
+        */
+
+        void compter(Compteur compteur, uint64_t n){
+            #pragma omp atomic
+            compteurs[static_cast<int>(compteur)] += n;
+        }
+
+        /**
+        * @brief
+        * Fonction qui remet toutes les durées et tous les compteurs à zéro.
+        */
+
+        void reinitialiser();
+
+        /**
+        * @brief
+        * Fonction qui affiche le tableau récapitulatif des phases et
+        * des compteurs.
+        * @param[in,out] flux est le flux de sortie.
+        * @param[in] iterations est le nombre d'itérations effectuées.
+        */
+
+        void afficherResume(std::ostream& flux, int iterations) const;
+
+        /* Getters */
+
+        /**
+        * @brief
+        * Fonction qui obtient la durée cumulée d'une phase.
+        * @param[in] phase est la phase.
+        * @return Durée en secondes.
+        */
+
+        double getDuree(Phase phase) const;
+
+        /**
+        * @brief
+        * Fonction qui obtient le nombre d'exécutions d'une phase.
+        * @param[in] phase est la phase.
+        * @return Nombre d'appels.
+        */
+
+        uint64_t getAppels(Phase phase) const;
+
+        /**
+        * @brief
+        * Fonction qui obtient la valeur d'un compteur.
+        * @param[in] compteur est le compteur.
+        * @return Valeur du compteur.
+        */
+
+        uint64_t getCompteur(Compteur compteur) const;
+
+        /**
+        * @brief
+        * Fonction qui obtient le nom d'une phase.
+        * @param[in] phase est la phase.
+        * @return Nom affichable de la phase.
+        */
+
+        static const char* getNom(Phase phase);
+
+};
+
+/**
+* @brief
+* Classe qui chronomètre une phase pendant sa durée de vie.
+*/
+
+class ChronometrePhase{
+
+    private:
+
+        Phase phase; /**< Phase chronométrée. */
+        std::chrono::steady_clock::time_point debut; /**< Instant de début. */
+
+    public:
+
+        /**
+        * @brief
+        * Constructeur de la classe ChronometrePhase, qui démarre le
+        * chronomètre et lit les compteurs matériels s'ils sont ouverts.
+        * @param phase est la phase chronométrée.
+        */
+
+        explicit ChronometrePhase(Phase phase);
+
+        /**
+        * @brief
+        * Destructeur de la classe ChronometrePhase, qui ajoute la durée
+        * écoulée et la variation des compteurs matériels à la phase, et
+        * l'enregistre dans la trace si elle est active.
+        */
+
+        ~ChronometrePhase();
+
+};
+
+#define CONCATENER_(a, b) a##b
+#define CONCATENER(a, b) CONCATENER_(a, b)
+
+#ifdef AVEC_CHRONOMETRAGE
+    /** Chronométrer la phase jusqu'à la fin du bloc courant. */
+    #define CHRONOMETRER(phase) ChronometrePhase CONCATENER(chronometre, __LINE__)(phase)
+    /** Ajouter n au compteur. */
+    #define COMPTER(compteur, n) Chronometrage::getInstance().compter(compteur, n)
+#else
+    #define CHRONOMETRER(phase)
+    #define COMPTER(compteur, n) ((void)(n))
+#endif
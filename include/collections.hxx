@@ -4,6 +4,7 @@
 #include <list>
 #include <deque>
 #include <vector>
+#include "conteneurs.hxx"
 
 /**
 * @brief 
@@ -64,3 +65,26 @@ template <typename T, typename Alloc>
 struct TypeCollection<std::vector<T, Alloc>> {
     static constexpr const char* name = "std::vector";
 };
+
+/**
+* @brief 
+* Spécialisation du modèle TypeCollection pour PetitVecteur.
+* @tparam T est le type des éléments stockés dans le vecteur.
+* @tparam N est le nombre d'éléments stockés sans allocation.
+*/
+
+template <typename T, size_t N>
+struct TypeCollection<PetitVecteur<T, N>> {
+    static constexpr const char* name = "PetitVecteur";
+};
+
+/**
+* @brief 
+* Spécialisation du modèle TypeCollection pour Colonie.
+* @tparam T est le type pointeur des éléments stockés dans la colonie.
+*/
+
+template <typename T>
+struct TypeCollection<Colonie<T>> {
+    static constexpr const char* name = "Colonie";
+};
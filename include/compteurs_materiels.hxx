@@ -0,0 +1,191 @@
+#pragma once
+
+#include <cstdint>
+#include <iostream>
+#include <vector>
+#include "chronometrage.hxx"
+
+/**
+* @brief
+* Énumération des événements lus avec perf_event_open.
+*/
+
+enum class EvenementMateriel{ Cycles, Instructions, DefautsCache, DefautsBranchement, TempsTache, DefautsPage, Nombre };
+
+/**
+* @brief
+* Classe singleton qui ouvre des compteurs de performance Linux
+* (perf_event_open) pour chaque thread OpenMP et attribue leurs
+* variations aux phases chronométrées de la simulation. Les événements
+* que le noyau refuse, par exemple dans une machine virtuelle ou un
+* conteneur, sont simplement marqués indisponibles.
+*/
+
+class CompteursMateriels{
+
+    private:
+
+        /**
+        * @brief
+        * Structure regroupant les compteurs ouverts pour un thread.
+        */
+
+        struct CompteursThread{
+            int tid; /**< Identifiant noyau du thread. */
+            int meneur = -1; /**< Descripteur du meneur du groupe d'événements. */
+            std::vector<int> descripteurs; /**< Descripteurs de tous les événements ouverts. */
+        };
+
+        bool actif; /**< Indique si au moins un événement est ouvert. */
+        std::vector<CompteursThread> threads; /**< Compteurs de chaque thread. */
+        int positions[static_cast<int>(EvenementMateriel::Nombre)]; /**< Position de chaque événement dans le groupe, -1 s'il est indisponible. */
+        int nombreEvenements; /**< Nombre d'événements ouverts par thread. */
+        std::vector<uint64_t> debuts; /**< Valeurs brutes et durées du groupe au début de chaque phase, par phase et thread. */
+        std::vector<uint64_t> totaux; /**< Variations cumulées par phase, thread et événement. */
+        std::vector<uint64_t> courantes; /**< Valeurs brutes et durées du groupe lues à la fin d'une phase, par thread. */
+        std::vector<uint64_t> lecture; /**< Tampon de lecture du groupe d'événements d'un thread. */
+
+        /**
+        * @brief
+        * Constructeur privé par défaut de la classe CompteursMateriels.
+        */
+
+        CompteursMateriels();
+
+        /**
+        * @brief
+        * Constructeur de copie supprimé pour empêcher la copie de l'instance.
+        */
+
+        CompteursMateriels(const CompteursMateriels&) = delete;
+
+        /**
+        * @brief
+        * Opérateur d'assignation supprimé pour empêcher l'assignation de l'instance.
+        */
+
+        void operator=(const CompteursMateriels&) = delete;
+
+        /**
+        * @brief
+        * Fonction qui lit les valeurs brutes des événements de tous les
+        * threads, suivies des durées d'activation et d'exécution du groupe
+        * qui permettent de corriger une variation du multiplexage.
+        * @param[out] valeurs est le tableau à remplir, par thread.
+        */
+
+        void lire(uint64_t* valeurs);
+
+    public:
+
+        /**
+        * @brief
+        * Fonction qui obtient l'instance unique de la classe CompteursMateriels.
+        * @return Référence à l'instance unique.
+        */
+
+        static CompteursMateriels& getInstance();
+
+        /**
+        * @brief
+        * Destructeur de la classe CompteursMateriels, qui ferme les compteurs.
+        */
+
+        ~CompteursMateriels();
+
+        /* Méthodes publiques */
+
+        /**
+        * @brief
+        * Fonction qui ouvre les compteurs pour chaque thread OpenMP et
+        * remet les totaux à zéro.
+        * @return true si au moins un événement a pu être ouvert.
+        */
+
+        bool ouvrir();
+
+        /**
+        * @brief
+        * Fonction qui ferme tous les compteurs.
+        */
+
+        void fermer();
+
+        /**
+        * @brief
+        * Fonction qui lit les compteurs au début d'une phase.
+        * @param[in] phase est la phase qui commence.
+        */
+
+        void commencer(Phase phase);
+
+        /**
+        * @brief
+        * Fonction qui lit les compteurs à la fin d'une phase et
+        * ajoute leurs variations aux totaux de la phase.
+        * @param[in] phase est la phase qui se termine.
+        */
+
+        void terminer(Phase phase);
+
+        /**
+        * @brief
+        * Fonction qui affiche, pour chaque phase et chaque thread, les
+        * événements, l'IPC et le débit mémoire estimé à partir des
+        * défauts du dernier niveau de cache (64 octets par défaut).
+        * @param[in,out] flux est le flux de sortie.
+        */
+
+        void afficherResume(std::ostream& flux) const;
+
+        /* Getters */
+
+        /**
+        * @brief
+        * Fonction qui indique si des compteurs sont ouverts.
+        * @return true si au moins un événement est ouvert.
+        */
+
+        bool estActif() const{
+            return actif;
+        }
+
+        /**
+        * @brief
+        * Fonction qui indique si un événement a pu être ouvert.
+        * @param[in] evenement est l'événement.
+        * @return true si l'événement est disponible.
+        */
+
+        bool estDisponible(EvenementMateriel evenement) const;
+
+        /**
+        * @brief
+        * Fonction qui obtient le nombre de threads suivis.
+        * @return Nombre de threads.
+        */
+
+        int getNombreThreads() const;
+
+        /**
+        * @brief
+        * Fonction qui obtient la variation cumulée d'un événement
+        * pendant une phase, pour un thread.
+        * @param[in] phase est la phase.
+        * @param[in] thread est le numéro du thread OpenMP.
+        * @param[in] evenement est l'événement.
+        * @return Variation cumulée, 0 si l'événement est indisponible.
+        */
+
+        uint64_t getTotal(Phase phase, int thread, EvenementMateriel evenement) const;
+
+        /**
+        * @brief
+        * Fonction qui obtient le nom d'un événement.
+        * @param[in] evenement est l'événement.
+        * @return Nom affichable de l'événement.
+        */
+
+        static const char* getNom(EvenementMateriel evenement);
+
+};
@@ -2,6 +2,7 @@
 
 #include "fichier.hxx"
 #include <sstream>
+#include <cstdint>
 #include <cmath>
 
 /**
@@ -12,6 +13,14 @@
 
 enum class ConditionLimite{ Reflexion, Absorption, Periodique };
 
+/**
+* @brief 
+* Énumération représentant les formats possibles du journal
+* des particules.
+*/ 
+
+enum class FormatJournal{ Csv, Binaire, Aucun };
+
 /**
 * @brief 
 * Classe représentant la configuration avec laquelle la simulation sera exécuté. 
@@ -45,6 +54,45 @@ class Configuration{
         std::string adresseFichier; /**< Définit le nom du fichier de lecture VTU. */
         std::string nomDossier; /**< Définit le nom du dossier dans lequel sont sauvegardés les fichiers de sortie. */
 
+        bool sorties = true; /**< Indique si les fichiers de sortie sont écrits. */
+        int intervalleJournal = 1000; /**< Définit le nombre d'itérations entre deux écritures du journal. */
+        double intervalleJournalTemps = 0; /**< Définit le temps simulé entre deux écritures du journal (prioritaire s'il est positif). */
+        int intervalleVTU = 1000; /**< Définit le nombre d'itérations entre deux fichiers VTU ou frames de trajectoire. */
+        double intervalleVTUTemps = 0; /**< Définit le temps simulé entre deux fichiers VTU ou frames de trajectoire (prioritaire s'il est positif). */
+
+        int intervalleReprise = 0; /**< Définit le nombre d'itérations entre deux points de reprise (0 pour les désactiver). */
+        std::string fichierReprise; /**< Définit le fichier de reprise à partir duquel la simulation redémarre. */
+
+        bool trajectoire = false; /**< Indique si les états sont écrits dans un fichier de trajectoire unique au lieu de fichiers VTU. */
+        bool trajectoireForces = false; /**< Indique si les forces sont écrites dans le fichier de trajectoire. */
+        bool trajectoireCompression = false; /**< Indique si les frames de la trajectoire sont quantifiées et codées par différence. */
+        double trajectoirePrecision = 1e-4; /**< Définit le pas de quantification des positions et des vitesses de la trajectoire. */
+        int trajectoireImagesCles = 10; /**< Définit le nombre de frames entre deux images clés de la trajectoire. */
+
+        FormatJournal formatJournal = FormatJournal::Csv; /**< Définit le format du journal des particules. */
+        std::string champsJournal = "id,categorie,position,vitesse,masse"; /**< Définit les champs écrits dans le journal des particules. */
+        int echantillonnageJournal = 1; /**< Définit le pas d'échantillonnage des particules du journal. */
+
+        int intervalleReduction = 0; /**< Définit le nombre d'itérations entre deux écritures des champs réduits (0 pour les désactiver). */
+        int facteurReduction = 1; /**< Définit le nombre de cellules par voxel et par direction des champs réduits. */
+
+        int intervalleChronometrage = 0; /**< Définit le nombre d'itérations entre deux affichages des chronomètres (0 pour aucun). */
+        bool compteursMateriels = false; /**< Indique si les compteurs de performance matériels sont lus pour chaque phase. */
+        bool trace = false; /**< Indique si une chronologie des phases et des threads est écrite au format Chrome Trace. */
+        int traceDebut = 0; /**< Définit la première itération enregistrée dans la trace. */
+        int traceFin = 100; /**< Définit la dernière itération enregistrée dans la trace (négative pour aller jusqu'à la fin). */
+
+        double memoireMaximale = 0; /**< Définit la mémoire autorisée en Mo (0 pour la mémoire physique de la machine). */
+
+        uint64_t graine = 0; /**< Définit la graine des tirages aléatoires. */
+        std::string fichierObstacles; /**< Définit le fichier décrivant les obstacles statiques (vide pour aucun). */
+        std::string fichierSources; /**< Définit le fichier décrivant les sources de particules (vide pour aucune). */
+        int intervalleCompaction = 1000; /**< Définit le nombre d'itérations entre deux compactions des particules absorbées (0 pour aucune). */
+        int subdivisionCellules = 1; /**< Définit le nombre de cellules par rayon de coupure et par direction. */
+        bool deterministe = false; /**< Indique si les résultats doivent être identiques bit à bit quel que soit le nombre de threads. */
+        std::string diffusion; /**< Définit le nom du segment de mémoire partagée de la diffusion en direct (vide pour aucune). */
+        int intervalleDiffusion = 100; /**< Définit le nombre d'itérations entre deux frames diffusées. */
+
         /**
         * @brief 
         * Constructeur privé par défaut de la classe Configuration.
@@ -113,6 +161,19 @@ class Configuration{
 
         void afficherParametresPossibles();
 
+        /**
+        * @brief 
+        * Fonction qui calcule une empreinte des paramètres physiques
+        * de la configuration et de ceux qui modifient la trajectoire
+        * (subdivision, mode déterministe, compaction, graine, adresse
+        * et contenu des fichiers d'obstacles et de sources). Elle
+        * permet de vérifier qu'un point de reprise est relu avec la
+        * même configuration.
+        * @return Empreinte FNV-1a des paramètres.
+        */
+
+        uint64_t calculerHash() const;
+
         /* getters */
 
         /**
@@ -276,6 +337,272 @@ class Configuration{
         */
 
         const std::string& getNomDossier() const;
+
+        /**
+        * @brief 
+        * Fonction qui indique si les fichiers de sortie sont écrits.
+        * @return true si les sorties sont activées, false sinon.
+        */
+
+        bool getSorties() const;
+
+        /**
+        * @brief 
+        * Fonction qui obtient le nombre d'itérations entre deux
+        * écritures du journal des particules.
+        * @return Intervalle en itérations, 0 pour désactiver le journal.
+        */
+
+        int getIntervalleJournal() const;
+
+        /**
+        * @brief 
+        * Fonction qui obtient le temps simulé entre deux écritures
+        * du journal des particules.
+        * @return Intervalle en temps, 0 pour utiliser l'intervalle en itérations.
+        */
+
+        double getIntervalleJournalTemps() const;
+
+        /**
+        * @brief 
+        * Fonction qui obtient le nombre d'itérations entre deux
+        * fichiers VTU ou frames de trajectoire.
+        * @return Intervalle en itérations, 0 pour désactiver ces sorties.
+        */
+
+        int getIntervalleVTU() const;
+
+        /**
+        * @brief 
+        * Fonction qui obtient le temps simulé entre deux fichiers
+        * VTU ou frames de trajectoire.
+        * @return Intervalle en temps, 0 pour utiliser l'intervalle en itérations.
+        */
+
+        double getIntervalleVTUTemps() const;
+
+        /**
+        * @brief 
+        * Fonction qui obtient le nombre d'itérations entre deux
+        * points de reprise.
+        * @return Intervalle des points de reprise, 0 s'ils sont désactivés.
+        */
+
+        int getIntervalleReprise() const;
+
+        /**
+        * @brief 
+        * Fonction qui obtient l'adresse du fichier de reprise à
+        * partir duquel la simulation doit redémarrer.
+        * @return Adresse du fichier de reprise, vide pour un nouveau départ.
+        */
+
+        const std::string& getFichierReprise() const;
+
+        /**
+        * @brief 
+        * Fonction qui indique si les états sont écrits dans un
+        * fichier de trajectoire unique.
+        * @return true si le fichier de trajectoire est activé, false sinon.
+        */
+
+        bool getTrajectoire() const;
+
+        /**
+        * @brief 
+        * Fonction qui indique si les forces sont écrites dans le
+        * fichier de trajectoire.
+        * @return true si les forces sont écrites, false sinon.
+        */
+
+        bool getTrajectoireForces() const;
+
+        /**
+        * @brief 
+        * Fonction qui indique si les frames de la trajectoire sont
+        * compressées.
+        * @return true si la compression est activée, false sinon.
+        */
+
+        bool getTrajectoireCompression() const;
+
+        /**
+        * @brief 
+        * Fonction qui obtient le pas de quantification des positions
+        * et des vitesses de la trajectoire compressée.
+        * @return Pas de quantification.
+        */
+
+        double getTrajectoirePrecision() const;
+
+        /**
+        * @brief 
+        * Fonction qui obtient le nombre de frames entre deux images
+        * clés de la trajectoire compressée.
+        * @return Intervalle des images clés.
+        */
+
+        int getTrajectoireImagesCles() const;
+
+        /**
+        * @brief 
+        * Fonction qui obtient le format du journal des particules.
+        * @return Format du journal.
+        */
+
+        FormatJournal getFormatJournal() const;
+
+        /**
+        * @brief 
+        * Fonction qui obtient la liste des champs écrits dans le
+        * journal des particules.
+        * @return Liste des champs séparés par des virgules.
+        */
+
+        const std::string& getChampsJournal() const;
+
+        /**
+        * @brief 
+        * Fonction qui obtient le pas d'échantillonnage des particules
+        * du journal.
+        * @return Pas d'échantillonnage.
+        */
+
+        int getEchantillonnageJournal() const;
+
+        /**
+        * @brief 
+        * Fonction qui obtient le nombre d'itérations entre deux
+        * écritures des champs réduits.
+        * @return Intervalle des champs réduits, 0 s'ils sont désactivés.
+        */
+
+        int getIntervalleReduction() const;
+
+        /**
+        * @brief 
+        * Fonction qui obtient le nombre de cellules par voxel et
+        * par direction des champs réduits.
+        * @return Facteur de réduction.
+        */
+
+        int getFacteurReduction() const;
+
+        /**
+        * @brief 
+        * Fonction qui obtient le nombre d'itérations entre deux
+        * affichages des chronomètres des phases.
+        * @return Intervalle d'affichage, 0 pour un affichage en fin de simulation uniquement.
+        */
+
+        int getIntervalleChronometrage() const;
+
+        /**
+        * @brief 
+        * Fonction qui indique si les compteurs de performance
+        * matériels sont lus pour chaque phase.
+        * @return true si les compteurs matériels sont activés.
+        */
+
+        bool getCompteursMateriels() const;
+
+        /**
+        * @brief 
+        * Fonction qui indique si une chronologie des phases et des
+        * threads est écrite au format Chrome Trace.
+        * @return true si la trace est activée.
+        */
+
+        bool getTrace() const;
+
+        /**
+        * @brief 
+        * Fonction qui obtient la première itération enregistrée dans la trace.
+        * @return Numéro de la première itération.
+        */
+
+        int getTraceDebut() const;
+
+        /**
+        * @brief 
+        * Fonction qui obtient la dernière itération enregistrée dans la trace.
+        * @return Numéro de la dernière itération, négatif pour aller jusqu'à la fin.
+        */
+
+        int getTraceFin() const;
+
+        /**
+        * @brief 
+        * Fonction qui obtient la mémoire autorisée pour la simulation.
+        * @return Mémoire autorisée en Mo, 0 pour la mémoire physique de la machine.
+        */
+
+        double getMemoireMaximale() const;
+
+        /**
+        * @brief 
+        * Fonction qui obtient la graine des tirages aléatoires.
+        * @return Graine du générateur Philox.
+        */
+
+        uint64_t getGraine() const;
+
+        /**
+        * @brief
+        * Fonction qui obtient l'adresse du fichier des obstacles.
+        * @return Adresse du fichier des obstacles, vide s'il n'y en a pas.
+        */
+
+        const std::string& getFichierObstacles() const;
+
+        /**
+        * @brief
+        * Fonction qui obtient l'adresse du fichier des sources de particules.
+        * @return Adresse du fichier des sources, vide s'il n'y en a pas.
+        */
+
+        const std::string& getFichierSources() const;
+
+        /**
+        * @brief
+        * Fonction qui obtient l'intervalle de compaction des particules absorbées.
+        * @return Nombre d'itérations entre deux compactions, 0 pour aucune.
+        */
+
+        int getIntervalleCompaction() const;
+
+        /**
+        * @brief
+        * Fonction qui obtient le nombre de cellules par rayon de coupure.
+        * @return Subdivision k, les cellules mesurant au moins rCut/k.
+        */
+
+        int getSubdivisionCellules() const;
+
+        /**
+        * @brief
+        * Fonction qui indique si le mode déterministe est activé.
+        * @return Booléen indiquant si les résultats ne dépendent pas du nombre de threads.
+        */
+
+        bool getDeterministe() const;
+
+        /**
+        * @brief
+        * Fonction qui obtient le nom du segment de la diffusion en direct.
+        * @return Référence au nom du segment, vide si la diffusion est désactivée.
+        */
+
+        const std::string& getDiffusion() const;
+
+        /**
+        * @brief
+        * Fonction qui obtient l'intervalle de diffusion.
+        * @return Nombre d'itérations entre deux frames diffusées.
+        */
+
+        int getIntervalleDiffusion() const;
         
         /* Setters */
 
@@ -295,6 +622,15 @@ class Configuration{
 
         void setForces(bool newForceLJ, bool newForceIG, bool newForcePG);
 
+        /**
+        * @brief
+        * Fonction qui permet de modifier la limitation de la vitesse.
+        * @param newLimiterVitesse est le booléen indiquant si la vitesse est limitée.
+        * @param newEnergieDesiree est l'énergie désirée du système.
+        */
+
+        void setLimiterVitesse(bool newLimiterVitesse, double newEnergieDesiree);
+
         /**
         * @brief 
         * Fonction qui permet de modifier la configuration de la
@@ -333,4 +669,157 @@ class Configuration{
 
         void setNomDossier(const std::string& newNomDossier);
 
+        /**
+        * @brief 
+        * Fonction qui permet d'activer ou de désactiver l'écriture
+        * de tous les fichiers de sortie.
+        */
+
+        void setSorties(bool newSorties);
+
+        /**
+        * @brief 
+        * Fonction qui permet de modifier les intervalles, en itérations
+        * et en temps simulé, du journal et des fichiers VTU.
+        */
+
+        void setIntervallesSortie(int newIntervalleJournal, double newIntervalleJournalTemps, int newIntervalleVTU, double newIntervalleVTUTemps);
+
+        /**
+        * @brief 
+        * Fonction qui permet de modifier l'intervalle, en itérations,
+        * entre deux points de reprise.
+        */
+
+        void setIntervalleReprise(int newIntervalleReprise);
+
+        /**
+        * @brief 
+        * Fonction qui permet de modifier l'adresse du fichier de reprise
+        * à partir duquel la simulation redémarre.
+        */
+
+        void setFichierReprise(const std::string& newFichierReprise);
+
+        /**
+        * @brief 
+        * Fonction qui permet d'activer le fichier de trajectoire et
+        * de choisir si les forces y sont écrites.
+        */
+
+        void setTrajectoire(bool newTrajectoire, bool newTrajectoireForces);
+
+        /**
+        * @brief 
+        * Fonction qui permet de modifier la compression de la
+        * trajectoire : activation, pas de quantification et
+        * intervalle des images clés.
+        */
+
+        void setTrajectoireCompression(bool newTrajectoireCompression, double newTrajectoirePrecision, int newTrajectoireImagesCles);
+
+        /**
+        * @brief 
+        * Fonction qui permet de modifier le format, les champs et
+        * l'échantillonnage du journal des particules.
+        */
+
+        void setJournal(FormatJournal newFormatJournal, const std::string& newChampsJournal, int newEchantillonnageJournal);
+
+        /**
+        * @brief 
+        * Fonction qui permet de modifier l'intervalle d'écriture et
+        * le facteur de réduction des champs réduits.
+        */
+
+        void setReduction(int newIntervalleReduction, int newFacteurReduction);
+
+        /**
+        * @brief 
+        * Fonction qui permet de modifier l'intervalle d'affichage
+        * des chronomètres des phases.
+        */
+
+        void setIntervalleChronometrage(int newIntervalleChronometrage);
+
+        /**
+        * @brief 
+        * Fonction qui permet d'activer ou de désactiver la lecture
+        * des compteurs de performance matériels.
+        */
+
+        void setCompteursMateriels(bool newCompteursMateriels);
+
+        /**
+        * @brief 
+        * Fonction qui permet d'activer la trace et de modifier la
+        * plage d'itérations enregistrée.
+        */
+
+        void setTrace(bool newTrace, int newTraceDebut, int newTraceFin);
+
+        /**
+        * @brief 
+        * Fonction qui permet de modifier la mémoire autorisée,
+        * en Mo (0 pour la mémoire physique de la machine).
+        */
+
+        void setMemoireMaximale(double newMemoireMaximale);
+
+        /**
+        * @brief 
+        * Fonction qui permet de modifier la graine des tirages aléatoires.
+        */
+
+        void setGraine(uint64_t newGraine);
+
+        /**
+        * @brief
+        * Fonction qui permet de modifier l'adresse du fichier des obstacles.
+        * @param newFichierObstacles est la nouvelle adresse, vide pour aucun obstacle.
+        */
+
+        void setFichierObstacles(const std::string& newFichierObstacles);
+
+        /**
+        * @brief
+        * Fonction qui permet de modifier l'adresse du fichier des sources de particules.
+        * @param newFichierSources est la nouvelle adresse, vide pour aucune source.
+        */
+
+        void setFichierSources(const std::string& newFichierSources);
+
+        /**
+        * @brief
+        * Fonction qui permet de modifier l'intervalle de compaction des particules absorbées.
+        * @param newIntervalleCompaction est le nombre d'itérations, 0 pour aucune compaction.
+        */
+
+        void setIntervalleCompaction(int newIntervalleCompaction);
+
+        /**
+        * @brief
+        * Fonction qui permet de modifier le nombre de cellules par rayon de coupure.
+        * @param newSubdivisionCellules est la nouvelle subdivision k.
+        */
+
+        void setSubdivisionCellules(int newSubdivisionCellules);
+
+        /**
+        * @brief
+        * Fonction qui permet d'activer ou de désactiver le mode déterministe.
+        * @param newDeterministe est le booléen indiquant si le mode déterministe est activé.
+        */
+
+        void setDeterministe(bool newDeterministe);
+
+        /**
+        * @brief
+        * Fonction qui permet de modifier la diffusion en direct.
+        * @param newDiffusion est le nom du segment, vide pour aucune diffusion.
+        * @param newIntervalleDiffusion est le nombre d'itérations entre deux frames diffusées.
+        */
+
+        void setDiffusion(const std::string& newDiffusion, int newIntervalleDiffusion);
+
 };
@@ -0,0 +1,274 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <iterator>
+#include <type_traits>
+#include <vector>
+
+/**
+* @brief 
+* Classe représentant un vecteur dont les N premiers éléments sont
+* stockés dans l'objet lui-même : une cellule peu peuplée ne fait
+* alors aucune allocation dynamique. Au-delà, les éléments sont
+* déplacés dans un tableau alloué dont la capacité double.
+* @tparam T est le type des éléments, trivialement copiable.
+* @tparam N est le nombre d'éléments stockés sans allocation.
+*/
+
+template <typename T, size_t N>
+class PetitVecteur{
+
+    static_assert(std::is_trivially_copyable<T>::value, "PetitVecteur requiert un type trivialement copiable");
+
+    private:
+
+        T local[N]; /**< Stockage interne des N premiers éléments. */
+        T* donnees; /**< Début du stockage courant, interne ou alloué. */
+        size_t taille; /**< Nombre d'éléments. */
+        size_t capacite; /**< Nombre d'éléments que le stockage courant peut contenir. */
+
+        /**
+        * @brief 
+        * Fonction qui agrandit le stockage pour contenir au moins n éléments.
+        * @param[in] n est la capacité minimale.
+        */
+
+        void reserver(size_t n);
+
+    public:
+
+        using value_type = T; /**< Type des éléments. */
+        using iterator = T*; /**< Itérateur sur les éléments. */
+        using const_iterator = const T*; /**< Itérateur constant sur les éléments. */
+
+        /* Constructeur */
+
+        /**
+        * @brief 
+        * Constructeur par défaut de la classe PetitVecteur.
+        */
+
+        PetitVecteur();
+
+        /**
+        * @brief 
+        * Constructeur de copie de la classe PetitVecteur.
+        * @param autre est le vecteur à copier.
+        */
+
+        PetitVecteur(const PetitVecteur& autre);
+
+        /**
+        * @brief 
+        * Opérateur d'assignation de la classe PetitVecteur.
+        * @param autre est le vecteur à copier.
+        * @return Référence au vecteur modifié.
+        */
+
+        PetitVecteur& operator=(const PetitVecteur& autre);
+
+        /**
+        * @brief 
+        * Destructeur de la classe PetitVecteur.
+        */
+
+        ~PetitVecteur();
+
+        /* Méthodes publiques */
+
+        /**
+        * @brief 
+        * Fonction qui insère un élément avant la position donnée.
+        * @param position est la position d'insertion.
+        * @param valeur est l'élément à insérer.
+        * @return Itérateur vers l'élément inséré.
+        */
+
+        iterator insert(const_iterator position, const T& valeur);
+
+        /**
+        * @brief 
+        * Fonction qui ajoute un élément à la fin.
+        * @param valeur est l'élément à ajouter.
+        */
+
+        void push_back(const T& valeur);
+
+        /**
+        * @brief 
+        * Fonction qui supprime le dernier élément.
+        */
+
+        void pop_back();
+
+        /**
+        * @brief 
+        * Fonction qui supprime un élément en conservant l'ordre des suivants.
+        * @param position est la position de l'élément.
+        * @return Itérateur vers l'élément suivant.
+        */
+
+        iterator erase(const_iterator position);
+
+        /**
+        * @brief 
+        * Fonction qui supprime tous les éléments, sans libérer le stockage.
+        */
+
+        void clear();
+
+        /* Getters */
+
+        iterator begin(){ return donnees; } /**< Début des éléments. */
+        iterator end(){ return donnees + taille; } /**< Fin des éléments. */
+        const_iterator begin() const{ return donnees; } /**< Début constant des éléments. */
+        const_iterator end() const{ return donnees + taille; } /**< Fin constante des éléments. */
+        const_iterator cbegin() const{ return donnees; } /**< Début constant des éléments. */
+        const_iterator cend() const{ return donnees + taille; } /**< Fin constante des éléments. */
+        T& operator[](size_t i){ return donnees[i]; } /**< Élément d'indice i. */
+        const T& operator[](size_t i) const{ return donnees[i]; } /**< Élément constant d'indice i. */
+        T& front(){ return donnees[0]; } /**< Premier élément. */
+        const T& front() const{ return donnees[0]; } /**< Premier élément constant. */
+        T& back(){ return donnees[taille - 1]; } /**< Dernier élément. */
+        const T& back() const{ return donnees[taille - 1]; } /**< Dernier élément constant. */
+        size_t size() const{ return taille; } /**< Nombre d'éléments. */
+        size_t capacity() const{ return capacite; } /**< Nombre d'éléments que le stockage courant peut contenir. */
+        bool empty() const{ return taille == 0; } /**< Indique si le vecteur est vide. */
+
+        /**
+        * @brief 
+        * Fonction qui indique si les éléments sont stockés dans l'objet.
+        * @return true si aucun tableau n'est alloué.
+        */
+
+        bool estLocal() const{ return donnees == local; }
+
+};
+
+/**
+* @brief 
+* Classe représentant un conteneur de pointeurs à emplacements
+* stables, dans l'esprit de plf::colony et de std::hive : une
+* suppression remplace le pointeur par nullptr et mémorise
+* l'emplacement libre, qui est réutilisé par l'insertion suivante.
+* Les suppressions sont donc en O(1) sans déplacer d'élément, et le
+* parcours saute les emplacements vides.
+* @tparam T est un type pointeur.
+*/
+
+template <typename T>
+class Colonie{
+
+    static_assert(std::is_pointer<T>::value, "Colonie requiert un type pointeur");
+
+    private:
+
+        std::vector<T> emplacements; /**< Emplacements, nuls s'ils sont libres. */
+        std::vector<size_t> libres; /**< Indices des emplacements libres. */
+        size_t taille; /**< Nombre d'éléments. */
+
+    public:
+
+        /**
+        * @brief 
+        * Itérateur constant qui saute les emplacements libres.
+        */
+
+        class const_iterator{
+
+            private:
+
+                const T* courant; /**< Emplacement courant. */
+                const T* fin; /**< Fin des emplacements. */
+
+            public:
+
+                using iterator_category = std::forward_iterator_tag;
+                using value_type = T;
+                using difference_type = std::ptrdiff_t;
+                using pointer = const T*;
+                using reference = const T&;
+
+                const_iterator(const T* courant = nullptr, const T* fin = nullptr) : courant(courant), fin(fin){
+                    while(this->courant != this->fin && *this->courant == nullptr){
+                        ++this->courant;
+                    }
+                }
+                const T& operator*() const{ return *courant; }
+                const_iterator& operator++(){
+                    do{
+                        ++courant;
+                    }while(courant != fin && *courant == nullptr);
+                    return *this;
+                }
+                const_iterator operator++(int){ const_iterator copie = *this; ++(*this); return copie; }
+                bool operator==(const const_iterator& autre) const{ return courant == autre.courant; }
+                bool operator!=(const const_iterator& autre) const{ return courant != autre.courant; }
+                const T* getEmplacement() const{ return courant; }
+
+        };
+
+        using value_type = T; /**< Type des éléments. */
+        using iterator = const_iterator; /**< Les éléments ne sont modifiables que par insertion et suppression. */
+
+        /* Constructeur */
+
+        /**
+        * @brief 
+        * Constructeur par défaut de la classe Colonie.
+        */
+
+        Colonie() : taille(0){}
+
+        /* Méthodes publiques */
+
+        /**
+        * @brief 
+        * Fonction qui insère un élément dans un emplacement libre, ou à
+        * la fin s'il n'y en a pas. La position est ignorée.
+        * @param position est ignorée, l'ordre n'étant pas conservé.
+        * @param valeur est l'élément non nul à insérer.
+        * @return Itérateur vers l'élément inséré.
+        */
+
+        const_iterator insert(const_iterator position, T valeur);
+
+        /**
+        * @brief 
+        * Fonction qui libère l'emplacement d'un élément.
+        * @param position est la position de l'élément.
+        * @return Itérateur vers l'élément suivant.
+        */
+
+        const_iterator erase(const_iterator position);
+
+        /**
+        * @brief 
+        * Fonction qui supprime tous les éléments.
+        */
+
+        void clear();
+
+        /* Getters */
+
+        const_iterator begin() const{ return const_iterator(emplacements.data(), emplacements.data() + emplacements.size()); } /**< Premier élément. */
+        const_iterator end() const{ return const_iterator(emplacements.data() + emplacements.size(), emplacements.data() + emplacements.size()); } /**< Fin des emplacements. */
+        const_iterator cbegin() const{ return begin(); } /**< Premier élément. */
+        const_iterator cend() const{ return end(); } /**< Fin des emplacements. */
+        T front() const{ return *begin(); } /**< Premier élément. */
+        size_t size() const{ return taille; } /**< Nombre d'éléments. */
+        bool empty() const{ return taille == 0; } /**< Indique si la colonie est vide. */
+
+        /**
+        * @brief 
+        * Fonction qui obtient le nombre d'emplacements, libres ou non.
+        * @return Nombre d'emplacements parcourus par les itérateurs.
+        */
+
+        size_t getNombreEmplacements() const{ return emplacements.size(); }
+
+};
+
+#include "conteneurs.txx"
@@ -0,0 +1,123 @@
+/* PetitVecteur */
+
+/* Constructeur */
+
+template <typename T, size_t N>
+PetitVecteur<T, N>::PetitVecteur() : donnees(local), taille(0), capacite(N){}
+
+template <typename T, size_t N>
+PetitVecteur<T, N>::PetitVecteur(const PetitVecteur& autre) : donnees(local), taille(0), capacite(N){
+    *this = autre;
+}
+
+template <typename T, size_t N>
+PetitVecteur<T, N>& PetitVecteur<T, N>::operator=(const PetitVecteur& autre){
+    if(this != &autre){
+        taille = 0;
+        reserver(autre.taille);
+        std::memcpy(donnees, autre.donnees, autre.taille * sizeof(T));
+        taille = autre.taille;
+    }
+    return *this;
+}
+
+template <typename T, size_t N>
+PetitVecteur<T, N>::~PetitVecteur(){
+    if(donnees != local){
+        delete[] donnees;
+    }
+}
+
+/* Méthodes privées */
+
+template <typename T, size_t N>
+void PetitVecteur<T, N>::reserver(size_t n){
+    if(n <= capacite){
+        return;
+    }
+    size_t nouvelleCapacite = std::max(n, 2 * capacite);
+    T* nouvellesDonnees = new T[nouvelleCapacite];
+    std::memcpy(nouvellesDonnees, donnees, taille * sizeof(T));
+    if(donnees != local){
+        delete[] donnees;
+    }
+    donnees = nouvellesDonnees;
+    capacite = nouvelleCapacite;
+}
+
+/* Méthodes publiques */
+
+template <typename T, size_t N>
+typename PetitVecteur<T, N>::iterator PetitVecteur<T, N>::insert(const_iterator position, const T& valeur){
+    size_t indice = position - donnees;
+    T copie = valeur;
+    reserver(taille + 1);
+    std::memmove(donnees + indice + 1, donnees + indice, (taille - indice) * sizeof(T));
+    donnees[indice] = copie;
+    taille++;
+    return donnees + indice;
+}
+
+template <typename T, size_t N>
+void PetitVecteur<T, N>::push_back(const T& valeur){
+    insert(end(), valeur);
+}
+
+template <typename T, size_t N>
+void PetitVecteur<T, N>::pop_back(){
+    taille--;
+}
+
+template <typename T, size_t N>
+typename PetitVecteur<T, N>::iterator PetitVecteur<T, N>::erase(const_iterator position){
+    size_t indice = position - donnees;
+    std::memmove(donnees + indice, donnees + indice + 1, (taille - indice - 1) * sizeof(T));
+    taille--;
+    return donnees + indice;
+}
+
+template <typename T, size_t N>
+void PetitVecteur<T, N>::clear(){
+    taille = 0;
+}
+
+/* Colonie */
+
+/* Méthodes publiques */
+
+template <typename T>
+typename Colonie<T>::const_iterator Colonie<T>::insert(const_iterator, T valeur){
+    size_t indice;
+    if(libres.empty()){
+        indice = emplacements.size();
+        emplacements.push_back(valeur);
+    }else{
+        indice = libres.back();
+        libres.pop_back();
+        emplacements[indice] = valeur;
+    }
+    taille++;
+    return const_iterator(emplacements.data() + indice, emplacements.data() + emplacements.size());
+}
+
+template <typename T>
+typename Colonie<T>::const_iterator Colonie<T>::erase(const_iterator position){
+    size_t indice = position.getEmplacement() - emplacements.data();
+    emplacements[indice] = nullptr;
+    taille--;
+
+    /* Une colonie vidée oublie ses emplacements pour ne plus les parcourir */
+    if(taille == 0){
+        clear();
+        return end();
+    }
+    libres.push_back(indice);
+    return const_iterator(emplacements.data() + indice + 1, emplacements.data() + emplacements.size());
+}
+
+template <typename T>
+void Colonie<T>::clear(){
+    emplacements.clear();
+    libres.clear();
+    taille = 0;
+}
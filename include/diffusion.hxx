@@ -0,0 +1,246 @@
+#pragma once
+
+#include <atomic>
+#include <string>
+#include <cstdint>
+#include "univers.hxx"
+
+/**
+* @brief
+* Structure de l'en-tête d'un segment de diffusion, placée au début
+* de la mémoire partagée. Les champs autres que derniereFrame et
+* terminee ne changent pas après la création du segment.
+*/
+
+struct EnteteDiffusion{
+    char magie[8]; /**< Nombre magique identifiant un segment de diffusion. */
+    uint32_t version; /**< Version du format du segment. */
+    uint32_t nombreEmplacements; /**< Nombre d'emplacements de l'anneau. */
+    uint64_t capacite; /**< Nombre maximal de particules d'un emplacement. */
+    uint64_t tailleEmplacement; /**< Taille d'un emplacement, en octets. */
+    double ld[3]; /**< Longueurs caractéristiques de l'univers. */
+    std::atomic<uint64_t> derniereFrame; /**< Numéro de la dernière frame publiée, 0 si aucune. */
+    std::atomic<uint32_t> terminee; /**< Vaut 1 lorsque la simulation est terminée. */
+};
+
+/**
+* @brief
+* Structure de l'en-tête d'un emplacement de l'anneau, suivie des
+* colonnes de la frame. La séquence est impaire pendant l'écriture
+* de l'emplacement et augmente de 2 à chaque frame.
+*/
+
+struct EnteteEmplacement{
+    std::atomic<uint64_t> sequence; /**< Séquence du verrou de l'emplacement. */
+    uint64_t numero; /**< Numéro de la frame, à partir de 1. */
+    int64_t iteration; /**< Numéro de l'itération. */
+    double temps; /**< Temps de simulation. */
+    uint64_t nombreParticules; /**< Nombre de particules de la frame. */
+    uint64_t nombreTotal; /**< Nombre de particules de l'univers, supérieur au précédent si la frame est tronquée. */
+};
+
+/**
+* @brief
+* Structure donnant accès, sans copie, aux colonnes d'une frame
+* dans la mémoire partagée. Les colonnes ne sont cohérentes que si
+* LecteurDiffusion::estValide le confirme après leur lecture.
+*/
+
+struct FrameDiffusion{
+    uint64_t sequence = 0; /**< Séquence de l'emplacement lors de l'accès. */
+    uint64_t numero = 0; /**< Numéro de la frame. */
+    int64_t iteration = 0; /**< Numéro de l'itération. */
+    double temps = 0; /**< Temps de simulation. */
+    uint64_t nombreParticules = 0; /**< Nombre de particules de la frame. */
+    uint64_t nombreTotal = 0; /**< Nombre de particules de l'univers. */
+    const int64_t* ids = nullptr; /**< Identifiants des particules. */
+    const float* positions = nullptr; /**< Positions (x, y, z) centrées sur l'origine. */
+    const float* vitesses = nullptr; /**< Vitesses (x, y, z). */
+    const float* masses = nullptr; /**< Masses des particules. */
+};
+
+/**
+* @brief
+* Classe qui publie l'état des particules dans un segment de mémoire
+* partagée POSIX, lisible en direct par un visualiseur local. Le
+* segment contient un anneau d'emplacements : la frame n est écrite
+* dans l'emplacement n modulo leur nombre, sous un verrou de séquence
+* (seqlock). L'écrivain n'attend jamais les lecteurs ; un lecteur
+* trop lent détecte qu'une frame a été réécrite pendant sa lecture.
+* Le segment est supprimé à la destruction, les lecteurs déjà
+* attachés conservant leur projection.
+*/
+
+class DiffusionEtat{
+
+    private:
+
+        std::string nom; /**< Nom du segment de mémoire partagée. */
+        char* donnees; /**< Début de la projection du segment. */
+        size_t taille; /**< Taille du segment, en octets. */
+        uint64_t numero; /**< Numéro de la dernière frame publiée. */
+
+        /**
+        * @brief
+        * Constructeur de copie supprimé, la projection étant unique.
+        */
+
+        DiffusionEtat(const DiffusionEtat&) = delete;
+
+        /**
+        * @brief
+        * Opérateur d'assignation supprimé, la projection étant unique.
+        */
+
+        void operator=(const DiffusionEtat&) = delete;
+
+    public:
+
+        /* Constructeur */
+
+        /**
+        * @brief
+        * Constructeur de la classe DiffusionEtat, qui crée le segment
+        * ou remplace un segment existant de même nom.
+        * @param nom est le nom du segment, préfixé par / s'il ne l'est pas.
+        * @param ld est le vecteur des longueurs caractéristiques de l'univers.
+        * @param capacite est le nombre maximal de particules d'une frame.
+        * @param nombreEmplacements est le nombre d'emplacements de l'anneau.
+        * @throw std::invalid_argument si la capacité ou le nombre d'emplacements est nul.
+        * @throw std::runtime_error si le segment ne peut pas être créé.
+        */
+
+        DiffusionEtat(const std::string& nom, const Vecteur<double>& ld, uint64_t capacite, uint32_t nombreEmplacements = 3);
+
+        /**
+        * @brief
+        * Destructeur de la classe DiffusionEtat, qui signale la fin de
+        * la simulation aux lecteurs puis supprime le segment.
+        */
+
+        ~DiffusionEtat();
+
+        /* Méthodes publiques */
+
+        /**
+        * @brief
+        * Fonction qui publie l'état des particules de la grille comme
+        * nouvelle frame. Au-delà de la capacité du segment, les
+        * particules suivantes sont omises et la frame est tronquée.
+        * @param[in] univers est l'univers à publier.
+        * @param[in] iteration est le numéro de l'itération.
+        * @param[in] temps est le temps de simulation.
+        */
+
+        void publier(const Univers& univers, int64_t iteration, double temps);
+
+        /* Getters */
+
+        /**
+        * @brief
+        * Fonction qui obtient le nom du segment.
+        * @return Référence au nom du segment, préfixé par /.
+        */
+
+        const std::string& getNom() const;
+
+        /**
+        * @brief
+        * Fonction qui obtient la taille du segment partagé.
+        * @return Nombre d'octets projetés.
+        */
+
+        size_t getOctets() const;
+
+};
+
+/**
+* @brief
+* Classe qui s'attache en lecture seule à un segment de diffusion.
+*/
+
+class LecteurDiffusion{
+
+    private:
+
+        const char* donnees; /**< Début de la projection du segment. */
+        size_t taille; /**< Taille du segment, en octets. */
+
+        /**
+        * @brief
+        * Constructeur de copie supprimé, la projection étant unique.
+        */
+
+        LecteurDiffusion(const LecteurDiffusion&) = delete;
+
+        /**
+        * @brief
+        * Opérateur d'assignation supprimé, la projection étant unique.
+        */
+
+        void operator=(const LecteurDiffusion&) = delete;
+
+    public:
+
+        /* Constructeur */
+
+        /**
+        * @brief
+        * Constructeur de la classe LecteurDiffusion.
+        * @param nom est le nom du segment, préfixé par / s'il ne l'est pas.
+        * @throw std::runtime_error si le segment n'existe pas.
+        * @throw std::invalid_argument si le segment n'est pas un segment de diffusion compatible.
+        */
+
+        LecteurDiffusion(const std::string& nom);
+
+        /**
+        * @brief
+        * Destructeur de la classe LecteurDiffusion, qui libère la projection.
+        */
+
+        ~LecteurDiffusion();
+
+        /* Méthodes publiques */
+
+        /**
+        * @brief
+        * Fonction qui donne accès à la dernière frame publiée sans
+        * copier ses colonnes.
+        * @param[out] frame est la description de la frame.
+        * @return Faux si aucune frame n'est publiée ou si la dernière
+        *         est en cours de réécriture.
+        */
+
+        bool lireDerniereFrame(FrameDiffusion& frame) const;
+
+        /**
+        * @brief
+        * Fonction qui vérifie que l'emplacement d'une frame n'a pas été
+        * réécrit depuis lireDerniereFrame : à appeler après avoir lu
+        * ses colonnes, qui sont à ignorer si la frame n'est plus valide.
+        * @param[in] frame est la frame lue.
+        * @return Vrai si les colonnes lues sont celles de la frame.
+        */
+
+        bool estValide(const FrameDiffusion& frame) const;
+
+        /* Getters */
+
+        /**
+        * @brief
+        * Fonction qui obtient l'en-tête du segment.
+        * @return Référence à l'en-tête dans la mémoire partagée.
+        */
+
+        const EnteteDiffusion& getEntete() const;
+
+        /**
+        * @brief
+        * Fonction qui indique si la simulation qui publie est terminée.
+        * @return Vrai si l'écrivain a été détruit.
+        */
+
+        bool estTerminee() const;
+
+};
@@ -0,0 +1,106 @@
+#pragma once
+
+#include <string>
+#include <vector>
+#include <cstdint>
+#include <stdexcept>
+
+/**
+* @brief
+* Fonction qui décode une suite de caractères encodée en base64.
+* Les espaces sont ignorés et les blocs complétés par '=' peuvent
+* se succéder, comme dans les fichiers VTU compressés.
+* @param[in] debut est le pointeur vers le premier caractère.
+* @param[in] taille est le nombre de caractères à décoder.
+* @return Octets décodés.
+*/
+
+std::vector<unsigned char> decoderBase64(const char* debut, size_t taille);
+
+/**
+* @brief
+* Fonction qui encode une suite d'octets en base64.
+* @param[in] octets est le pointeur vers le premier octet.
+* @param[in] taille est le nombre d'octets à encoder.
+* @return Chaîne encodée.
+*/
+
+std::string encoderBase64(const unsigned char* octets, size_t taille);
+
+/**
+* @brief
+* Fonction qui indique si la machine range les octets
+* en petit-boutiste (LittleEndian).
+* @return True si la machine est petit-boutiste, False sinon.
+*/
+
+bool estPetitBoutiste();
+
+/**
+* @brief
+* Fonction qui inverse l'ordre des octets de chaque élément d'un tableau.
+* @param[in,out] octets est le pointeur vers le premier octet du tableau.
+* @param[in] taille est le nombre total d'octets du tableau.
+* @param[in] tailleElement est la taille en octets d'un élément.
+*/
+
+void inverserOctets(unsigned char* octets, size_t taille, size_t tailleElement);
+
+/**
+* @brief
+* Fonction qui indique si le programme a été compilé avec zlib.
+* @return True si la décompression zlib est disponible, False sinon.
+*/
+
+bool zlibDisponible();
+
+/**
+* @brief
+* Fonction qui décompresse un bloc compressé avec zlib.
+* @param[in] octets est le pointeur vers le bloc compressé.
+* @param[in] taille est la taille du bloc compressé.
+* @param[in] tailleDecompressee est la taille attendue du bloc décompressé.
+* @return Octets décompressés.
+*/
+
+std::vector<unsigned char> decompresserZlib(const unsigned char* octets, size_t taille, size_t tailleDecompressee);
+
+/**
+* @brief
+* Fonction qui transforme un entier signé en entier non signé de
+* sorte que les petites valeurs absolues donnent de petits entiers
+* (codage zigzag : 0, -1, 1, -2, ... devient 0, 1, 2, 3, ...).
+* @param[in] valeur est l'entier signé.
+* @return Entier non signé correspondant.
+*/
+
+uint64_t encoderZigzag(int64_t valeur);
+
+/**
+* @brief
+* Fonction inverse de encoderZigzag.
+* @param[in] valeur est l'entier codé en zigzag.
+* @return Entier signé correspondant.
+*/
+
+int64_t decoderZigzag(uint64_t valeur);
+
+/**
+* @brief
+* Fonction qui ajoute un entier à longueur variable (varint LEB128,
+* 7 bits par octet) à la fin d'un tampon.
+* @param[in,out] sortie est le tampon.
+* @param[in] valeur est l'entier à ajouter.
+*/
+
+void ajouterVarint(std::vector<char>& sortie, uint64_t valeur);
+
+/**
+* @brief
+* Fonction qui lit un entier à longueur variable et avance le curseur.
+* @param[in,out] curseur est la position de lecture.
+* @param[in] fin est la fin des données lisibles.
+* @return Entier lu.
+*/
+
+uint64_t lireVarint(const char*& curseur, const char* fin);
@@ -8,9 +8,11 @@
 * @brief 
 * Fonction qui ouvre un fichier de sortie.
 * @param[in] adresseFichier est l'adresse du fichier.
+* @param[in] ajouter indique si les écritures sont ajoutées à la fin
+* du fichier existant au lieu de le remplacer.
 */
 
-std::ofstream ouvrirFichierDeSortie(const std::string& adresseFichier);
+std::ofstream ouvrirFichierDeSortie(const std::string& adresseFichier, bool ajouter = false);
 
 /**
 * @brief 
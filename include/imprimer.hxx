@@ -3,6 +3,8 @@
 #include <iostream>
 #include "cellule.hxx"
 
+class Univers;
+
 /**
 * @brief 
 * Fonction pour imprimer sur la console l'univers de particules.
@@ -15,7 +17,19 @@ void imprimerParticulesSurConsole(const std::vector<Particule>& particules);
 * @brief 
 * Fonction pour imprimer sur la console les cellules
 * qui composent l'univers avec leurs voisins.
-* @param[in] grille est la grille à imprimer.
+* @param[in] univers est l'univers dont la grille est imprimée.
+*/
+
+void imprimerGrilleSurConsole(const Univers& univers);
+
+/**
+* @brief 
+* Fonction qui écrit un texte UTF-8 complété par des espaces jusqu'à
+* une largeur donnée en caractères, pour aligner les colonnes d'un tableau.
+* @param[in,out] flux est le flux de sortie.
+* @param[in] texte est le texte à écrire.
+* @param[in] largeur est la largeur de la colonne.
+* @param[in] aGauche indique si le texte est aligné à gauche plutôt qu'à droite.
 */
 
-void imprimerGrilleSurConsole(const std::vector<Cellule>& grille);
+void imprimerColonne(std::ostream& flux, const std::string& texte, size_t largeur, bool aGauche = true);
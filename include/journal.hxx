@@ -0,0 +1,175 @@
+#pragma once
+
+#include <string>
+#include <vector>
+#include <cstdint>
+#include "configuration.hxx"
+#include "univers.hxx"
+#include "fichier.hxx"
+
+/**
+* @brief
+* Champs pouvant être sélectionnés dans le journal des particules.
+* L'itération et le temps sont toujours écrits.
+*/
+
+enum ChampJournal : uint32_t {
+    JOURNAL_ID = 1, /**< Identifiant de la particule. */
+    JOURNAL_CATEGORIE = 2, /**< Catégorie de la particule (CSV uniquement). */
+    JOURNAL_POSITION = 4, /**< Position (x, y, z). */
+    JOURNAL_VITESSE = 8, /**< Vitesse (x, y, z). */
+    JOURNAL_FORCE = 16, /**< Force (x, y, z). */
+    JOURNAL_MASSE = 32 /**< Masse. */
+};
+
+/**
+* @brief
+* Fonction qui convertit une liste de champs séparés par des virgules
+* (id, categorie, position, vitesse, force, masse) en masque de champs.
+* @param[in] liste est la liste des champs.
+* @return Masque des champs sélectionnés.
+*/
+
+uint32_t lireChampsJournal(const std::string& liste);
+
+/**
+* @brief
+* Classe qui écrit l'état des particules sous forme de table, une
+* ligne par particule et par itération sauvegardée. En CSV, la
+* première ligne nomme les colonnes ; en binaire, le fichier commence
+* par un en-tête décrivant les champs puis chaque ligne est un
+* enregistrement de taille fixe (itération en int64, identifiant en
+* int64, autres champs en double). Les lignes sont formatées dans un
+* tampon qui n'est écrit dans le fichier que lorsqu'il est plein.
+*/
+
+class JournalParticules{
+
+    private:
+
+        std::ofstream fichier; /**< Descripteur du fichier du journal. */
+        FormatJournal format; /**< Format du journal. */
+        uint32_t champs; /**< Masque des champs écrits. */
+        int echantillonnage; /**< Seules les particules dont l'identifiant est multiple de cette valeur sont écrites. */
+        std::vector<char> tampon; /**< Tampon de sortie. */
+        size_t utilise; /**< Nombre d'octets occupés dans le tampon. */
+
+        /**
+        * @brief
+        * Fonction qui garantit qu'au moins n octets sont libres dans le
+        * tampon, en le vidant si nécessaire.
+        * @param[in] n est le nombre d'octets requis.
+        * @return Pointeur vers le premier octet libre.
+        */
+
+        char* reserver(size_t n);
+
+        /**
+        * @brief
+        * Fonction qui ajoute un nombre réel formaté en texte suivi d'un séparateur.
+        * @param[in] valeur est le nombre à écrire.
+        * @param[in] separateur est le caractère qui suit le nombre.
+        */
+
+        void ajouterTexte(double valeur, char separateur);
+
+        /**
+        * @brief
+        * Fonction qui ajoute un entier formaté en texte suivi d'un séparateur.
+        * @param[in] valeur est l'entier à écrire.
+        * @param[in] separateur est le caractère qui suit l'entier.
+        */
+
+        void ajouterTexte(int64_t valeur, char separateur);
+
+        /**
+        * @brief
+        * Fonction qui ajoute la représentation binaire d'une valeur.
+        * @param[in] valeur est la valeur à écrire.
+        */
+
+        template <typename T>
+        void ajouterBinaire(const T& valeur);
+
+        /**
+        * @brief
+        * Fonction qui écrit l'en-tête du journal.
+        */
+
+        void ecrireEntete();
+
+        /**
+        * @brief
+        * Fonction qui recherche, dans un journal existant, la fin de la
+        * dernière ligne complète antérieure à l'itération de reprise.
+        * Les lignes suivantes et une éventuelle ligne tronquée par
+        * l'interruption sont ainsi écartées.
+        * @param[in] adresseFichier est l'adresse du fichier du journal.
+        * @param[in] iterationReprise est la première itération à réécrire.
+        * @return Taille à conserver, en octets, nulle si l'en-tête est incomplet.
+        */
+
+        uint64_t chercherFinReprise(const std::string& adresseFichier, int64_t iterationReprise) const;
+
+    public:
+
+        /* Constructeur */
+
+        /**
+        * @brief
+        * Constructeur de la classe JournalParticules.
+        * @param adresseFichier est l'adresse du fichier du journal.
+        * @param format est le format du journal (Csv ou Binaire).
+        * @param champs est le masque des champs écrits.
+        * @param echantillonnage est le pas d'échantillonnage des particules.
+        * @param iterationReprise est, en cas de reprise, la première itération
+        * à écrire : les lignes antérieures du fichier existant sont conservées
+        * et les suivantes supprimées. Négative, le fichier est recréé.
+        * @param tailleTampon est la taille du tampon de sortie, en octets.
+        */
+
+        JournalParticules(const std::string& adresseFichier, FormatJournal format, uint32_t champs, int echantillonnage = 1, int64_t iterationReprise = -1, size_t tailleTampon = 1 << 22);
+
+        /**
+        * @brief
+        * Destructeur de la classe JournalParticules, qui vide le tampon.
+        */
+
+        ~JournalParticules();
+
+        /* Méthodes publiques */
+
+        /**
+        * @brief
+        * Fonction qui ajoute au journal l'état des particules échantillonnées.
+        * @param[in] univers est l'univers à sauvegarder.
+        * @param[in] iteration est le numéro de l'itération.
+        * @param[in] temps est le temps de simulation.
+        */
+
+        void ecrire(const Univers& univers, int64_t iteration, double temps);
+
+        /**
+        * @brief
+        * Fonction qui écrit le contenu du tampon dans le fichier.
+        */
+
+        void vider();
+
+        /**
+        * @brief
+        * Fonction qui calcule la taille d'un enregistrement binaire.
+        * @return Taille d'une ligne du journal binaire, en octets.
+        */
+
+        size_t getTailleEnregistrement() const;
+
+        /**
+        * @brief
+        * Fonction qui calcule la mémoire occupée par le tampon de sortie.
+        * @return Nombre d'octets alloués.
+        */
+
+        size_t getOctets() const;
+
+};
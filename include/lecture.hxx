@@ -1,13 +1,23 @@
 #pragma once
 
 #include <sstream>
+#include <cstring>
+#include <cctype>
+#include <cstdlib>
+#include <algorithm>
+#include <type_traits>
 #include "univers.hxx"
 #include "fichier.hxx"
+#include "encodage.hxx"
 
 /**
 * @brief 
 * Fonction qui crée et charge des particules dans
 * l'univers à partir des informations lues dans un fichier VTU.
+* Les tableaux peuvent être au format ascii, binary (base64, 
+* éventuellement compressé avec zlib) ou appended (raw ou base64),
+* en Float32 ou Float64 et dans les deux ordres d'octets. Les
+* tableaux optionnels Categorie et Id sont aussi lus.
 * @param[in] adresseFichier est l'adresse du fichier d'entrée.
 * @param[in] univers est l'univers.
 */
@@ -0,0 +1,249 @@
+#pragma once
+
+#include <cstddef>
+#include <deque>
+#include <iostream>
+#include <list>
+#include <vector>
+#include "conteneurs.hxx"
+#include "vecteur.hxx"
+
+/**
+* @brief
+* Énumération des postes de mémoire comptabilisés.
+*/
+
+enum class PosteMemoire{ Particules, Cellules, Voisines, ParticulesCellules, Parois, Sorties, Nombre };
+
+/**
+* @brief
+* Structure contenant l'estimation de la mémoire d'un univers avant
+* sa construction.
+*/
+
+struct EstimationMemoire{
+    size_t octets[static_cast<int>(PosteMemoire::Nombre)] = {}; /**< Octets estimés pour chaque poste. */
+    size_t nombreCellules = 0; /**< Nombre de cellules de la grille. */
+
+    /**
+    * @brief
+    * Fonction qui calcule le total de l'estimation.
+    * @return Nombre total d'octets estimés.
+    */
+
+    size_t getTotal() const;
+};
+
+/**
+* @brief
+* Classe singleton qui comptabilise la mémoire de chaque poste de la
+* simulation, mesurée à partir de la capacité des conteneurs, et qui
+* échantillonne la mémoire résidente (RSS) du processus.
+*/
+
+class Memoire{
+
+    private:
+
+        size_t octets[static_cast<int>(PosteMemoire::Nombre)]; /**< Dernière mesure de chaque poste. */
+        size_t pics[static_cast<int>(PosteMemoire::Nombre)]; /**< Plus grande mesure de chaque poste. */
+        size_t rss; /**< Dernière mémoire résidente échantillonnée. */
+        size_t picRSS; /**< Plus grande mémoire résidente échantillonnée. */
+
+        /**
+        * @brief
+        * Constructeur privé par défaut de la classe Memoire.
+        */
+
+        Memoire();
+
+        /**
+        * @brief
+        * Constructeur de copie supprimé pour empêcher la copie de l'instance.
+        */
+
+        Memoire(const Memoire&) = delete;
+
+        /**
+        * @brief
+        * Opérateur d'assignation supprimé pour empêcher l'assignation de l'instance.
+        */
+
+        void operator=(const Memoire&) = delete;
+
+    public:
+
+        /**
+        * @brief
+        * Fonction qui obtient l'instance unique de la classe Memoire.
+        * @return L'instance unique de Memoire.
+        */
+
+        static Memoire& getInstance();
+
+        /* Méthodes publiques */
+
+        /**
+        * @brief
+        * Fonction qui remet à zéro les mesures et les pics.
+        */
+
+        void reinitialiser();
+
+        /**
+        * @brief
+        * Fonction qui enregistre la mesure d'un poste et met à jour son pic.
+        * @param[in] poste est le poste mesuré.
+        * @param[in] n est le nombre d'octets du poste.
+        */
+
+        void enregistrer(PosteMemoire poste, size_t n);
+
+        /**
+        * @brief
+        * Fonction qui lit la mémoire résidente du processus et met à jour son pic.
+        * @return Mémoire résidente, en octets.
+        */
+
+        size_t echantillonnerRSS();
+
+        /**
+        * @brief
+        * Fonction qui affiche la mémoire de chaque poste, la mémoire
+        * résidente et le pic de mémoire résidente relevé par le noyau.
+        * @param[out] flux est le flux de sortie.
+        */
+
+        void afficherResume(std::ostream& flux) const;
+
+        /* Getters */
+
+        /**
+        * @brief
+        * Fonction qui obtient la dernière mesure d'un poste.
+        * @param[in] poste est le poste.
+        * @return Nombre d'octets.
+        */
+
+        size_t getOctets(PosteMemoire poste) const;
+
+        /**
+        * @brief
+        * Fonction qui obtient la plus grande mesure d'un poste.
+        * @param[in] poste est le poste.
+        * @return Nombre d'octets.
+        */
+
+        size_t getPic(PosteMemoire poste) const;
+
+        /**
+        * @brief
+        * Fonction qui obtient la somme des dernières mesures des postes.
+        * @return Nombre d'octets.
+        */
+
+        size_t getTotal() const;
+
+        /**
+        * @brief
+        * Fonction qui obtient la plus grande mémoire résidente échantillonnée.
+        * @return Nombre d'octets.
+        */
+
+        size_t getPicRSS() const;
+
+        /**
+        * @brief
+        * Fonction qui lit la mémoire résidente du processus (/proc/self/statm).
+        * @return Nombre d'octets, 0 si elle n'est pas disponible.
+        */
+
+        static size_t lireRSS();
+
+        /**
+        * @brief
+        * Fonction qui lit le pic de mémoire résidente relevé par le noyau
+        * (VmHWM de /proc/self/status), qui inclut les pics entre deux
+        * échantillons.
+        * @return Nombre d'octets, 0 s'il n'est pas disponible.
+        */
+
+        static size_t lireRSSMaximal();
+
+        /**
+        * @brief
+        * Fonction qui obtient la mémoire physique de la machine.
+        * @return Nombre d'octets, 0 si elle n'est pas disponible.
+        */
+
+        static size_t lireMemoirePhysique();
+
+        /**
+        * @brief
+        * Fonction qui obtient le nom d'un poste.
+        * @param[in] poste est le poste.
+        * @return Nom affichable du poste.
+        */
+
+        static const char* getNom(PosteMemoire poste);
+
+};
+
+/**
+* @brief
+* Fonction qui estime la taille réellement réservée par l'allocateur
+* pour une demande de n octets (en-tête et alignement de glibc).
+* @param[in] n est le nombre d'octets demandés.
+* @return Nombre d'octets réservés, 0 si n est nul.
+*/
+
+size_t octetsAllocation(size_t n);
+
+/**
+* @brief
+* Fonctions qui calculent la mémoire dynamique d'un conteneur,
+* hors objet conteneur lui-même.
+* @param[in] conteneur est le conteneur mesuré.
+* @return Nombre d'octets alloués.
+*/
+
+template <typename T, typename Alloc>
+size_t octetsConteneur(const std::vector<T, Alloc>& conteneur);
+
+template <typename T, typename Alloc>
+size_t octetsConteneur(const std::list<T, Alloc>& conteneur);
+
+template <typename T, typename Alloc>
+size_t octetsConteneur(const std::deque<T, Alloc>& conteneur);
+
+template <typename T, size_t N>
+size_t octetsConteneur(const PetitVecteur<T, N>& conteneur);
+
+template <typename T>
+size_t octetsConteneur(const Colonie<T>& conteneur);
+
+/**
+* @brief
+* Fonction qui estime la mémoire d'un univers avant de le construire,
+* avec les mêmes règles que le constructeur d'Univers pour la grille
+* et ses voisines, et une répartition uniforme des particules.
+* @param[in] ld est le vecteur des longueurs caractéristiques.
+* @param[in] rCut est le rayon de coupure.
+* @param[in] nombreParticules est le nombre de particules.
+* @param[in] subdivision est le nombre de cellules par rayon de coupure.
+* @return Estimation par poste.
+*/
+
+EstimationMemoire estimerMemoire(const Vecteur<double>& ld, double rCut, size_t nombreParticules, int subdivision = 1);
+
+/**
+* @brief
+* Fonction qui refuse une estimation supérieure à la mémoire autorisée
+* (MEMOIRE_MAXIMALE, ou la mémoire physique de la machine).
+* @param[in] estimation est l'estimation à vérifier.
+* @throw std::invalid_argument si l'estimation dépasse la mémoire autorisée.
+*/
+
+void verifierMemoire(const EstimationMemoire& estimation);
+
+#include "memoire.txx"
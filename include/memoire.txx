@@ -0,0 +1,30 @@
+template <typename T, typename Alloc>
+size_t octetsConteneur(const std::vector<T, Alloc>& conteneur){
+    return octetsAllocation(conteneur.capacity() * sizeof(T));
+}
+
+template <typename T, typename Alloc>
+size_t octetsConteneur(const std::list<T, Alloc>& conteneur){
+    
+    /* Un nœud par élément, chaîné dans les deux sens */
+    return conteneur.size() * octetsAllocation(sizeof(T) + 2 * sizeof(void*));
+}
+
+template <typename T, typename Alloc>
+size_t octetsConteneur(const std::deque<T, Alloc>& conteneur){
+    
+    /* Blocs de 512 octets de libstdc++ et leur table d'au moins 8 pointeurs */
+    size_t parBloc = sizeof(T) < 512 ? 512 / sizeof(T) : 1;
+    size_t blocs = conteneur.size() / parBloc + 1;
+    return blocs * octetsAllocation(parBloc * sizeof(T)) + octetsAllocation(std::max<size_t>(8, blocs + 2) * sizeof(T*));
+}
+
+template <typename T, size_t N>
+size_t octetsConteneur(const PetitVecteur<T, N>& conteneur){
+    return conteneur.estLocal() ? 0 : octetsAllocation(conteneur.capacity() * sizeof(T));
+}
+
+template <typename T>
+size_t octetsConteneur(const Colonie<T>& conteneur){
+    return octetsAllocation(conteneur.getNombreEmplacements() * sizeof(T));
+}
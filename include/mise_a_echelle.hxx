@@ -0,0 +1,60 @@
+#pragma once
+
+#include <iostream>
+#include <vector>
+#include "scenarios.hxx"
+
+/**
+* @brief
+* Structure regroupant la mesure d'une exécution de l'harnais de mise à l'échelle.
+*/
+
+struct MesureMiseAEchelle{
+    int threads; /**< Nombre de threads utilisés. */
+    int nombreParticules; /**< Nombre de particules effectivement générées. */
+    int pas; /**< Nombre de pas de temps effectués. */
+    double duree; /**< Durée de l'intégration, en secondes. */
+    double pasParSeconde; /**< Pas de temps par seconde. */
+    double particulesPasParSeconde; /**< Produit des particules et des pas par seconde. */
+    double efficacite; /**< Efficacité parallèle par rapport à la mesure sur un thread. */
+};
+
+/**
+* @brief
+* Fonction qui génère un scénario et mesure la durée de pas itérations
+* de l'algorithme de Stromer-Verlet, sans sortie.
+* @param[in] scenario est le scénario à générer.
+* @param[in] nombreParticules est le nombre de particules souhaité.
+* @param[in] pas est le nombre de pas de temps.
+* @param[in] threads est le nombre de threads OpenMP.
+* @param[in] deterministe indique si le mode déterministe est activé.
+* @return Mesure de l'exécution, avec une efficacité de 1.
+*/
+
+MesureMiseAEchelle mesurerExecution(Scenario scenario, int nombreParticules, int pas, int threads, bool deterministe = false);
+
+/**
+* @brief
+* Fonction qui exécute une matrice de mesures de mise à l'échelle et
+* écrit une ligne CSV par mesure. En mise à l'échelle forte, chaque
+* taille est mesurée pour chaque nombre de threads et l'efficacité vaut
+* T1 / (p Tp). En mise à l'échelle faible, chaque taille est un nombre
+* de particules par thread, et l'efficacité compare le débit en
+* particules-pas par thread à celui obtenu sur un thread. En mode
+* déterministe, la mise à l'échelle est forte et la référence est le
+* mode par défaut sur le premier nombre de threads, écrite sur sa propre
+* ligne : l'efficacité multipliée par p donne alors l'accélération par
+* rapport à la boucle de Newton séquentielle.
+* @param[in,out] csv est le flux de sortie CSV.
+* @param[in] scenario est le scénario à générer.
+* @param[in] faible indique une mise à l'échelle faible plutôt que forte.
+* @param[in] tailles sont les nombres de particules, ou de particules par thread.
+* @param[in] threads sont les nombres de threads, le premier servant de référence.
+* @param[in] pas est le nombre de pas de temps par mesure.
+* @param[in] deterministe indique une mesure du mode déterministe, ignoré en mise à l'échelle faible.
+* @return Mesures effectuées, dans l'ordre des lignes CSV.
+*/
+
+std::vector<MesureMiseAEchelle> mesurerMiseAEchelle(std::ostream& csv, Scenario scenario, bool faible,
+                                                    const std::vector<int>& tailles, const std::vector<int>& threads, int pas,
+                                                    bool deterministe = false);
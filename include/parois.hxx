@@ -0,0 +1,307 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+#include <cstdint>
+#include "vecteur.hxx"
+
+/**
+* @brief
+* Énumération des types d'obstacles statiques.
+*/
+
+enum class TypeObstacle{
+    Plan, /**< Demi-espace limité par un plan. */
+    Sphere, /**< Sphère pleine. */
+    Boite, /**< Boîte pleine alignée sur les axes. */
+    Champ /**< Champ de distance signée échantillonné sur une grille. */
+};
+
+/**
+* @brief
+* Classe représentant un champ de distance signée échantillonné sur
+* une grille régulière. La distance est positive dans le fluide et
+* négative dans l'obstacle ; les normales sont précalculées à partir
+* de son gradient, et les deux sont interpolées linéairement entre
+* les points de la grille.
+*/
+
+class ChampDistance{
+
+    private:
+
+        Vecteur<int> dimensions; /**< Nombre de points de la grille par direction. */
+        Vecteur<double> origine; /**< Position du premier point de la grille. */
+        double pas; /**< Distance entre deux points voisins de la grille. */
+        std::vector<float> distances; /**< Distances signées aux points de la grille. */
+        std::vector<Vecteur<float>> normales; /**< Normales unitaires aux points de la grille, orientées vers le fluide. */
+
+        /**
+        * @brief
+        * Fonction qui calcule les normales par différences finies
+        * centrées (décentrées sur les bords de la grille).
+        */
+
+        void calculerNormales();
+
+    public:
+
+        /* Constructeur */
+
+        /**
+        * @brief
+        * Constructeur de la classe ChampDistance.
+        * @param dimensions est le nombre de points de la grille par direction.
+        * @param origine est la position du premier point de la grille.
+        * @param pas est la distance entre deux points voisins.
+        * @param distances sont les distances signées, l'indice z variant
+        *        le plus vite, comme pour les cellules de l'univers.
+        * @throw std::invalid_argument si les tailles ne correspondent pas.
+        */
+
+        ChampDistance(const Vecteur<int>& dimensions, const Vecteur<double>& origine, double pas, std::vector<float> distances);
+
+        /* Méthodes publiques */
+
+        /**
+        * @brief
+        * Fonction qui interpole la distance et la normale en une position.
+        * @param[in] position est la position.
+        * @param[out] distance est la distance signée interpolée.
+        * @param[out] normale est la normale interpolée.
+        * @return Faux si la position est hors de la grille.
+        */
+
+        bool mesurer(const Vecteur<double>& position, double& distance, Vecteur<double>& normale) const;
+
+        /**
+        * @brief
+        * Fonction qui calcule la mémoire occupée par les distances et les normales.
+        * @return Nombre d'octets alloués.
+        */
+
+        size_t getOctets() const;
+
+};
+
+/**
+* @brief
+* Classe représentant un obstacle statique, décrit par sa distance
+* signée : positive dans le fluide, négative dans l'obstacle.
+*/
+
+class Obstacle{
+
+    private:
+
+        TypeObstacle type; /**< Type de l'obstacle. */
+        Vecteur<double> a; /**< Point du plan, centre de la sphère ou coin minimal de la boîte. */
+        Vecteur<double> b; /**< Normale du plan ou coin maximal de la boîte. */
+        double rayon; /**< Rayon de la sphère. */
+        std::shared_ptr<const ChampDistance> champ; /**< Champ de distance, nul pour les autres types. */
+
+        /**
+        * @brief
+        * Constructeur privé, les obstacles étant créés par les fonctions creer.
+        */
+
+        Obstacle(TypeObstacle type);
+
+    public:
+
+        /* Méthodes publiques */
+
+        /**
+        * @brief
+        * Fonction qui crée un plan. Le fluide est du côté de la normale.
+        * @param point est un point du plan.
+        * @param normale est la normale du plan, normalisée à la création.
+        * @return Obstacle créé.
+        */
+
+        static Obstacle creerPlan(const Vecteur<double>& point, const Vecteur<double>& normale);
+
+        /**
+        * @brief
+        * Fonction qui crée une sphère pleine.
+        * @param centre est le centre de la sphère.
+        * @param rayon est le rayon de la sphère.
+        * @return Obstacle créé.
+        */
+
+        static Obstacle creerSphere(const Vecteur<double>& centre, double rayon);
+
+        /**
+        * @brief
+        * Fonction qui crée une boîte pleine alignée sur les axes.
+        * @param minimum est le coin minimal de la boîte.
+        * @param maximum est le coin maximal de la boîte.
+        * @return Obstacle créé.
+        */
+
+        static Obstacle creerBoite(const Vecteur<double>& minimum, const Vecteur<double>& maximum);
+
+        /**
+        * @brief
+        * Fonction qui crée un obstacle à partir d'un champ de distance.
+        * @param champ est le champ de distance, partagé entre les copies.
+        * @return Obstacle créé.
+        */
+
+        static Obstacle creerChamp(std::shared_ptr<const ChampDistance> champ);
+
+        /**
+        * @brief
+        * Fonction qui calcule la distance signée d'une position à
+        * l'obstacle et la normale orientée vers le fluide.
+        * @param[in] position est la position.
+        * @param[out] distance est la distance signée.
+        * @param[out] normale est la normale unitaire.
+        * @return Faux si la distance n'est pas définie (hors d'un champ).
+        */
+
+        bool mesurer(const Vecteur<double>& position, double& distance, Vecteur<double>& normale) const;
+
+        /**
+        * @brief
+        * Fonction qui obtient le type de l'obstacle.
+        * @return Type de l'obstacle.
+        */
+
+        TypeObstacle getType() const;
+
+        /**
+        * @brief
+        * Fonction qui calcule la mémoire occupée par le champ de distance.
+        * @return Nombre d'octets alloués.
+        */
+
+        size_t getOctets() const;
+
+};
+
+/**
+* @brief
+* Classe regroupant les obstacles statiques de l'univers et, pour
+* chaque cellule à portée d'un obstacle, la liste des obstacles
+* qu'elle doit consulter. Seules ces cellules sont visitées lors du
+* calcul des forces des parois.
+*/
+
+class Parois{
+
+    private:
+
+        std::vector<Obstacle> obstacles; /**< Obstacles de l'univers. */
+        double portee; /**< Distance au-delà de laquelle un obstacle n'agit plus. */
+        std::vector<int> cellulesProches; /**< Indices des cellules à portée d'au moins un obstacle. */
+        std::vector<uint32_t> debuts; /**< Début, dans indicesObstacles, des obstacles de chaque cellule proche. */
+        std::vector<uint16_t> indicesObstacles; /**< Indices des obstacles à portée de chaque cellule proche. */
+
+    public:
+
+        /* Constructeur */
+
+        /**
+        * @brief
+        * Constructeur de la classe Parois, sans obstacle.
+        */
+
+        Parois();
+
+        /* Méthodes publiques */
+
+        /**
+        * @brief
+        * Fonction qui ajoute un obstacle. Les cellules doivent
+        * ensuite être indexées à nouveau.
+        * @param[in] obstacle est l'obstacle.
+        */
+
+        void ajouterObstacle(const Obstacle& obstacle);
+
+        /**
+        * @brief
+        * Fonction qui lit les obstacles d'un fichier texte, un par ligne :
+        * PLAN x y z nx ny nz, SPHERE x y z r, BOITE xmin ymin zmin xmax ymax zmax
+        * ou CHAMP adresse. Les lignes vides et celles commençant par # sont
+        * ignorées. Les coordonnées sont centrées sur l'origine, comme les
+        * particules d'entrée.
+        * @param[in] adresseFichier est l'adresse du fichier des obstacles.
+        * @param[in] decalage est la translation vers le repère de la grille.
+        * @throw std::runtime_error si le fichier ne peut pas être ouvert.
+        * @throw std::invalid_argument si le fichier est mal formé.
+        */
+
+        void lireFichier(const std::string& adresseFichier, const Vecteur<double>& decalage);
+
+        /**
+        * @brief
+        * Fonction qui repère les cellules à portée des obstacles. Une
+        * cellule est retenue si la distance à son centre, diminuée de sa
+        * demi-diagonale, est inférieure à la portée.
+        * @param[in] nc est le nombre de cellules par direction.
+        * @param[in] tailleCellule est la taille des cellules par direction,
+        *            nulle selon un axe de longueur nulle.
+        * @param[in] portee est la distance au-delà de laquelle un obstacle n'agit plus.
+        */
+
+        void indexerCellules(const Vecteur<int>& nc, const Vecteur<double>& tailleCellule, double portee);
+
+        /**
+        * @brief
+        * Fonction qui applique une fonction à chaque obstacle de la
+        * cellule proche k dont la distance à une position est comprise
+        * strictement entre 0 et la portée.
+        * @param[in] k est le rang de la cellule dans getCellulesProches.
+        * @param[in] position est la position de la particule.
+        * @param[in] fonction est appelée avec la distance et la normale.
+        */
+
+        template <typename Fonction>
+        void pourChaqueContact(size_t k, const Vecteur<double>& position, Fonction&& fonction) const;
+
+        /**
+        * @brief
+        * Fonction qui calcule la mémoire occupée par les obstacles et l'index.
+        * @return Nombre d'octets alloués.
+        */
+
+        size_t getOctets() const;
+
+        /* Getters */
+
+        /**
+        * @brief
+        * Fonction qui obtient les obstacles.
+        * @return Référence au vecteur des obstacles.
+        */
+
+        const std::vector<Obstacle>& getObstacles() const;
+
+        /**
+        * @brief
+        * Fonction qui obtient les indices des cellules à portée d'un obstacle.
+        * @return Référence au vecteur des indices.
+        */
+
+        const std::vector<int>& getCellulesProches() const;
+
+};
+
+/**
+* @brief
+* Fonction qui lit un champ de distance signée dans un fichier texte :
+* les dimensions nx ny nz, l'origine ox oy oz, le pas, puis les
+* nx*ny*nz distances, l'indice z variant le plus vite.
+* @param[in] adresseFichier est l'adresse du fichier.
+* @param[in] decalage est la translation vers le repère de la grille.
+* @return Champ de distance lu.
+* @throw std::runtime_error si le fichier ne peut pas être ouvert.
+* @throw std::invalid_argument si le fichier est mal formé.
+*/
+
+std::shared_ptr<const ChampDistance> lireChampDistance(const std::string& adresseFichier, const Vecteur<double>& decalage);
+
+#include "parois.txx"
@@ -0,0 +1,10 @@
+template <typename Fonction>
+void Parois::pourChaqueContact(size_t k, const Vecteur<double>& position, Fonction&& fonction) const{
+    double distance;
+    Vecteur<double> normale;
+    for(uint32_t j = debuts[k]; j < debuts[k + 1]; j++){
+        if(obstacles[indicesObstacles[j]].mesurer(position, distance, normale) && distance > 0 && distance < portee){
+            fonction(distance, normale);
+        }
+    }
+}
@@ -1,8 +1,46 @@
 #pragma once
 
 #include <string>
+#include <cstdint>
 #include "vecteur.hxx"
 
+/**
+* @brief 
+* Type des identifiants des particules, sur 64 bits pour
+* dépasser 2^31 particules.
+*/
+
+using IdentifiantParticule = int64_t;
+
+#ifdef GRAND_SYSTEME
+
+/**
+* @brief 
+* Type des réels stockés dans une particule, hors position. En mode
+* grand système, la vitesse, la force et la masse sont stockées en
+* simple précision pour que l'enregistrement d'une particule tienne
+* dans 64 octets ; la position reste en double précision, un
+* déplacement de l'ordre de 10^-6 étant sinon perdu loin de l'origine,
+* et les calculs restent faits en double précision.
+*/
+
+using ReelParticule = float;
+
+/**
+* @brief 
+* Type des vecteurs renvoyés par les getters, convertis en
+* double précision et donc renvoyés par valeur.
+*/
+
+using VecteurParticule = Vecteur<double>;
+
+#else
+
+using ReelParticule = double;
+using VecteurParticule = const Vecteur<double>&;
+
+#endif
+
 /**
 * @brief 
 * Classe représentant une particule de l'univers.
@@ -12,17 +50,27 @@ class Particule{
     
     private:
 
-        int id; /**< Identifiant unique de la particule. */
-        static int nextId; /**< Prochain identifiant unique disponible à attribuer à une nouvelle particule. */
-        bool celluleConfirmee; /**< Booléen indiquant si la particule est classée dans la cellule correcte */
-        std::string categorie; /**< Catégorie de la particule. */
+        IdentifiantParticule id; /**< Identifiant unique de la particule, attribué par l'univers (0 si non attribué). */
         
         Vecteur<double> position; /**< Position de la particule dans l'univers. */
-        Vecteur<double> vitesse; /**< Vitesse de la particule. */
-        Vecteur<double> force; /**< Force appliquée à la particule. */
-        Vecteur<double> Fold; /**< Force précédente appliquée à la particule. */
+        Vecteur<ReelParticule> vitesse; /**< Vitesse de la particule. */
+        Vecteur<ReelParticule> force; /**< Force appliquée à la particule. */
         
-        double masse; /**< Masse de la particule. */
+        ReelParticule masse; /**< Masse de la particule. */
+        uint16_t categorie; /**< Indice de la catégorie de la particule dans la table des catégories. */
+        bool celluleConfirmee; /**< Booléen indiquant si la particule est classée dans la cellule correcte */
+
+        /**
+        * @brief 
+        * Fonction qui obtient l'indice d'une catégorie dans la table
+        * des catégories, partagée par toutes les particules, en l'y
+        * ajoutant si elle est nouvelle.
+        * @param nom est le nom de la catégorie.
+        * @return Indice de la catégorie.
+        * @throw std::length_error si la table est pleine.
+        */
+
+        static uint16_t indexerCategorie(const std::string& nom);
 
     public:
         
@@ -79,7 +127,7 @@ class Particule{
         * @return Identifiant unique de la particule.
         */
 
-        int getId() const;
+        IdentifiantParticule getId() const;
 
         /**
         * @brief 
@@ -112,7 +160,7 @@ class Particule{
         * @return Vitesse de la particule.
         */
         
-        const Vecteur<double>& getVitesse() const;
+        VecteurParticule getVitesse() const;
         
         /**
         * @brief 
@@ -120,16 +168,7 @@ class Particule{
         * @return Force appliquée à la particule.
         */
         
-        const Vecteur<double>& getForce() const;
-        
-        /**
-        * @brief 
-        * Fonction qui obtient
-        * la force précédente appliquée à la particule.
-        * @return Force précédente appliquée à la particule.
-        */
-        
-        const Vecteur<double>& getFold() const;
+        VecteurParticule getForce() const;
         
         /**
         * @brief 
@@ -147,7 +186,7 @@ class Particule{
         * @param newId est le nouvel identifiant unique.
         */
         
-        void setId(int newId);        
+        void setId(IdentifiantParticule newId);        
         
         /**
         * @brief 
@@ -158,6 +197,14 @@ class Particule{
 
         void setCelluleConfirmee(bool newCelluleConfirmee);
 
+        /**
+        * @brief 
+        * Fonction qui définit la catégorie de la particule.
+        * @param newCategorie est la nouvelle catégorie de la particule.
+        */
+
+        void setCategorie(const std::string& newCategorie);
+
         /**
         * @brief 
         * Fonction qui définit la position de la particule.
@@ -182,14 +229,6 @@ class Particule{
         
         void setForce(const Vecteur<double>& newForce);
         
-        /**
-        * @brief 
-        * Fonction qui définit la force précédente appliquée à la particule.
-        * @param newFold est la force précédente appliquée à la particule.
-        */
-        
-        void setFold(const Vecteur<double>& newFold);
-        
         /**
         * @brief 
         * Fonction qui définit la masse de la particule.
@@ -225,3 +264,7 @@ class Particule{
         friend std::ostream& operator<<(std::ostream& os, const Particule& particule);
 
 };
+
+#ifdef GRAND_SYSTEME
+static_assert(sizeof(Particule) <= 64, "Une particule doit tenir dans 64 octets en mode grand système");
+#endif
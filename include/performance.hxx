@@ -2,8 +2,11 @@
 
 #include <chrono>
 #include <iostream>
+#include <random>
 #include "configuration.hxx"
+#include "cellule.hxx"
 #include "collections.hxx"
+#include "philox.hxx"
 #include "univers.hxx"
 
 /**
@@ -49,4 +52,19 @@ void mesurerPerformanceComptage(Collection& particules);
 template <typename Collection>
 void mesurerPerformanceSuppression(Collection& particules);
 
+/**
+* @brief Fonction permettant de mesurer les opérations que la simulation
+*        fait réellement sur les cellules : ajout des particules, parcours
+*        des paires de cellules voisines, puis migration d'une fraction des
+*        particules avec suppression en cours de parcours et ajout dans la
+*        cellule d'arrivée, comme dans Univers::corrigerCellules.
+* @tparam Conteneur est le conteneur des particules d'une cellule.
+* @param[in] nombreCellules est le nombre de cellules par côté de la grille périodique.
+* @param[in] densite est le nombre moyen de particules par cellule.
+* @param[in] tauxMigration est la fraction des particules qui changent de cellule.
+*/
+
+template <typename Conteneur>
+void mesurerPerformanceCellules(int nombreCellules, int densite, double tauxMigration);
+
 #include "performance.txx"
\ No newline at end of file
@@ -2,12 +2,12 @@ template <typename Collection>
 void mesurerPerformanceInsertion(Collection& particules, int size){
     auto start = std::chrono::steady_clock::now();
 
-    std::random_device rd;
-    std::mt19937 mt(rd());
-    std::uniform_real_distribution<double> dist(-1, 1);
-
+    /* Positions reproductibles dans [-1, 1) */
+    const Philox philox(Configuration::getInstance().getGraine());
     for(int i = 0; i < size; i++){
-        Particule particule(dist(mt), dist(mt), dist(mt));
+        std::array<double, 2> xy = philox.uniformes(i, 0);
+        std::array<double, 2> z = philox.uniformes(i, 1);
+        Particule particule(2*xy[0] - 1, 2*xy[1] - 1, 2*z[0] - 1);
         particules.insert(particules.end(), particule);
     }
     
@@ -43,3 +43,98 @@ void mesurerPerformanceSuppression(Collection& particules){
               << " : " << elapsed_seconds.count() << " secondes\n";
 
 }
+
+template <typename Conteneur>
+void mesurerPerformanceCellules(int nombreCellules, int densite, double tauxMigration){
+    int n = nombreCellules;
+    auto indiceCellule = [n](int x, int y, int z){
+        return ((x + n) % n) * n * n + ((y + n) % n) * n + (z + n) % n;
+    };
+
+    /* Grille périodique de cellules de côté 1 */
+    std::vector<CelluleGenerique<Conteneur>> grille(n * n * n);
+    for(int x = 0; x < n; x++){
+        for(int y = 0; y < n; y++){
+            for(int z = 0; z < n; z++){
+                grille[indiceCellule(x, y, z)].setIndices(x, y, z);
+            }
+        }
+    }
+
+    /* Tirage reproductible pour comparer les conteneurs sur les mêmes données */
+    std::mt19937 mt(42);
+    std::uniform_real_distribution<double> dist(0, n);
+    std::vector<Particule> particules;
+    particules.reserve(static_cast<size_t>(n) * n * n * densite);
+    for(int i = 0; i < n * n * n * densite; i++){
+        particules.emplace_back(dist(mt), dist(mt), dist(mt));
+    }
+    auto indicesParticule = [](const Particule& particule){
+        const Vecteur<double>& position = particule.getPosition();
+        return Vecteur<int>(floor(position.getX()), floor(position.getY()), floor(position.getZ()));
+    };
+
+    /* Ajout */
+    auto start = std::chrono::steady_clock::now();
+    for(Particule& particule : particules){
+        Vecteur<int> indices = indicesParticule(particule);
+        grille[indiceCellule(indices.getX(), indices.getY(), indices.getZ())].ajouterParticule(&particule);
+    }
+    std::chrono::duration<double> ajout = std::chrono::steady_clock::now() - start;
+
+    /* Parcours des paires des 27 cellules voisines, comme le calcul des forces */
+    start = std::chrono::steady_clock::now();
+    long paires = 0;
+    for(const auto& cellule : grille){
+        const Vecteur<int>& indices = cellule.getIndices();
+        for(Particule* particule : cellule.getParticules()){
+            for(int dx = -1; dx <= 1; dx++){
+                for(int dy = -1; dy <= 1; dy++){
+                    for(int dz = -1; dz <= 1; dz++){
+                        const auto& voisine = grille[indiceCellule(indices.getX() + dx, indices.getY() + dy, indices.getZ() + dz)];
+                        for(Particule* autre : voisine.getParticules()){
+                            if((particule->getPosition() - autre->getPosition()).normeCarre() < 1){
+                                paires++;
+                            }
+                        }
+                    }
+                }
+            }
+        }
+    }
+    std::chrono::duration<double> parcours = std::chrono::steady_clock::now() - start;
+
+    /* Déplacement d'une fraction des particules vers une cellule voisine */
+    std::uniform_real_distribution<double> tirage(0, 1);
+    for(Particule& particule : particules){
+        if(tirage(mt) < tauxMigration){
+            Vecteur<double> position = particule.getPosition();
+            position.setX(fmod(position.getX() + 1, n));
+            particule.setPosition(position);
+        }
+    }
+
+    /* Migration : suppression en cours de parcours et ajout à l'arrivée */
+    start = std::chrono::steady_clock::now();
+    int migrations = 0;
+    for(auto& cellule : grille){
+        const auto& particulesCellule = cellule.getParticules();
+        for(auto it = particulesCellule.begin(); it != particulesCellule.end();){
+            Vecteur<int> indices = indicesParticule(**it);
+            if(cellule.comparerIndices(indices.getX(), indices.getY(), indices.getZ())){
+                it++;
+                continue;
+            }
+            grille[indiceCellule(indices.getX(), indices.getY(), indices.getZ())].ajouterParticule(*it);
+            it = cellule.suprimerParticule(it);
+            migrations++;
+        }
+    }
+    std::chrono::duration<double> migration = std::chrono::steady_clock::now() - start;
+
+    std::cout << "Cellules " << TypeCollection<Conteneur>::name << " (" << particules.size() << " particules, "
+              << densite << " par cellule) : ajout " << ajout.count() << " s, parcours de "
+              << paires << " paires " << parcours.count() << " s, migration de "
+              << migrations << " particules " << migration.count() << " s\n";
+
+}
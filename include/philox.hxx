@@ -0,0 +1,108 @@
+#pragma once
+
+#include <array>
+#include <cmath>
+#include <cstdint>
+
+/**
+* @brief
+* Classe représentant le générateur Philox4x32-10 (Salmon et al.,
+* Random123) : un bloc de quatre entiers de 32 bits est une fonction
+* pure de la graine et d'un compteur. Chaque particule tire ses
+* nombres avec son propre indice comme compteur, si bien que le
+* résultat ne dépend ni de l'ordre des tirages ni du nombre de threads.
+*/
+
+class Philox{
+
+    private:
+
+        uint32_t cle[2]; /**< Clé dérivée de la graine. */
+
+    public:
+
+        /* Constructeur */
+
+        /**
+        * @brief
+        * Constructeur de la classe Philox.
+        * @param graine est la graine, dont les 64 bits forment la clé.
+        */
+
+        explicit Philox(uint64_t graine) : cle{static_cast<uint32_t>(graine), static_cast<uint32_t>(graine >> 32)}{}
+
+        /* Méthodes publiques */
+
+        /**
+        * @brief
+        * Fonction qui calcule le bloc associé à un compteur de 128 bits
+        * formé de l'indice (64 bits), du flux et du numéro de bloc.
+        * @param indice est l'indice de l'objet tiré, par exemple la particule.
+        * @param flux distingue les usages d'un même indice (position, vitesse...).
+        * @param bloc est le numéro du bloc dans le flux.
+        * @return Quatre entiers de 32 bits uniformes.
+        */
+
+        std::array<uint32_t, 4> generer(uint64_t indice, uint32_t flux, uint32_t bloc = 0) const{
+            uint32_t c0 = static_cast<uint32_t>(indice), c1 = static_cast<uint32_t>(indice >> 32), c2 = flux, c3 = bloc;
+            uint32_t k0 = cle[0], k1 = cle[1];
+            for(int tour = 0; tour < 10; tour++){
+                uint64_t produit0 = static_cast<uint64_t>(0xD2511F53u) * c0;
+                uint64_t produit1 = static_cast<uint64_t>(0xCD9E8D57u) * c2;
+                uint32_t n0 = static_cast<uint32_t>(produit1 >> 32) ^ c1 ^ k0;
+                uint32_t n2 = static_cast<uint32_t>(produit0 >> 32) ^ c3 ^ k1;
+                c1 = static_cast<uint32_t>(produit1);
+                c3 = static_cast<uint32_t>(produit0);
+                c0 = n0;
+                c2 = n2;
+                k0 += 0x9E3779B9u;
+                k1 += 0xBB67AE85u;
+            }
+            return {c0, c1, c2, c3};
+        }
+
+        /**
+        * @brief
+        * Fonction qui tire deux réels uniformes dans [0, 1), de 53 bits chacun.
+        * @param indice est l'indice de l'objet tiré.
+        * @param flux distingue les usages d'un même indice.
+        * @param bloc est le numéro du bloc dans le flux.
+        * @return Deux réels uniformes.
+        */
+
+        std::array<double, 2> uniformes(uint64_t indice, uint32_t flux, uint32_t bloc = 0) const{
+            std::array<uint32_t, 4> bits = generer(indice, flux, bloc);
+            return {versReel(bits[0], bits[1]), versReel(bits[2], bits[3])};
+        }
+
+        /**
+        * @brief
+        * Fonction qui tire deux réels de loi normale centrée réduite
+        * par la transformation de Box-Muller.
+        * @param indice est l'indice de l'objet tiré.
+        * @param flux distingue les usages d'un même indice.
+        * @param bloc est le numéro du bloc dans le flux.
+        * @return Deux réels normaux indépendants.
+        */
+
+        std::array<double, 2> normales(uint64_t indice, uint32_t flux, uint32_t bloc = 0) const{
+            std::array<double, 2> u = uniformes(indice, flux, bloc);
+            double rayon = std::sqrt(-2 * std::log(1 - u[0]));
+            double angle = 2 * M_PI * u[1];
+            return {rayon * std::cos(angle), rayon * std::sin(angle)};
+        }
+
+        /**
+        * @brief
+        * Fonction qui convertit deux entiers de 32 bits en un réel
+        * uniforme dans [0, 1) avec 53 bits de mantisse.
+        * @param a fournit les 27 bits de poids fort.
+        * @param b fournit les 26 bits de poids faible.
+        * @return Réel uniforme.
+        */
+
+        static double versReel(uint32_t a, uint32_t b){
+            return ((a >> 5) * 67108864.0 + (b >> 6)) * (1.0 / 9007199254740992.0);
+        }
+
+};
@@ -0,0 +1,115 @@
+#pragma once
+
+#include <string>
+#include <vector>
+#include "univers.hxx"
+#include "fichier.hxx"
+
+/**
+* @brief
+* Structure regroupant les champs moyens calculés sur chaque voxel.
+* Les voxels sont rangés avec l'axe X variant le plus vite, comme
+* dans un fichier VTI.
+*/
+
+struct ChampsReduits{
+    std::vector<double> nombres; /**< Nombre moyen de particules par voxel. */
+    std::vector<double> densites; /**< Masse par unité de volume (de surface en 2D). */
+    std::vector<double> vitesses; /**< Vitesse moyenne pondérée par la masse (x, y, z). */
+    std::vector<double> temperatures; /**< Température cinétique (kB = 1) autour de la vitesse moyenne. */
+};
+
+/**
+* @brief
+* Classe qui réduit l'état des particules à des champs grossiers
+* pendant la simulation. Chaque voxel regroupe facteur cellules de
+* l'univers par direction : les particules sont attribuées aux voxels
+* à partir de leur cellule, sans recalculer leur position dans la
+* grille. Les sommes sont accumulées à chaque appel de accumuler puis
+* moyennées lors de l'écriture.
+*/
+
+class ReductionChamps{
+
+    private:
+
+        Vecteur<int> nv; /**< Nombre de voxels par direction. */
+        Vecteur<double> pas; /**< Dimensions d'un voxel complet. */
+        Vecteur<double> origine; /**< Coin inférieur de la grille de voxels, centré comme les sorties VTU. */
+        int dimension; /**< Nombre de directions de longueur non nulle. */
+
+        std::vector<int> voxelsDesCellules; /**< Indice du voxel de chaque cellule de la grille. */
+        std::vector<double> volumes; /**< Volume de chaque voxel, les derniers pouvant être incomplets. */
+
+        std::vector<double> nombres; /**< Somme des nombres de particules. */
+        std::vector<double> masses; /**< Somme des masses. */
+        std::vector<double> quantitesMouvement; /**< Somme des quantités de mouvement (x, y, z). */
+        std::vector<double> energies; /**< Somme des m*v². */
+        int echantillons; /**< Nombre d'appels à accumuler depuis la dernière réinitialisation. */
+
+    public:
+
+        /* Constructeur */
+
+        /**
+        * @brief
+        * Constructeur de la classe ReductionChamps.
+        * @param univers est l'univers dont la grille est réduite.
+        * @param facteur est le nombre de cellules par voxel et par direction.
+        */
+
+        ReductionChamps(const Univers& univers, int facteur = 1);
+
+        /* Méthodes publiques */
+
+        /**
+        * @brief
+        * Fonction qui ajoute l'état courant des particules aux sommes.
+        * @param[in] univers est l'univers à réduire.
+        */
+
+        void accumuler(const Univers& univers);
+
+        /**
+        * @brief
+        * Fonction qui calcule les champs moyens à partir des sommes accumulées.
+        * @return Champs moyens de chaque voxel.
+        */
+
+        ChampsReduits calculerChamps() const;
+
+        /**
+        * @brief
+        * Fonction qui sauvegarde les champs moyens dans un fichier VTI
+        * puis réinitialise les sommes.
+        * @param[in] adresseFichier est l'adresse du fichier VTI.
+        */
+
+        void sauvegarderEnVTI(const std::string& adresseFichier);
+
+        /**
+        * @brief
+        * Fonction qui remet les sommes à zéro.
+        */
+
+        void reinitialiser();
+
+        /* Getters */
+
+        /**
+        * @brief
+        * Fonction qui obtient le nombre de voxels par direction.
+        * @return Référence au vecteur des dimensions de la grille de voxels.
+        */
+
+        const Vecteur<int>& getNv() const;
+
+        /**
+        * @brief
+        * Fonction qui obtient le nombre d'échantillons accumulés.
+        * @return Nombre d'échantillons.
+        */
+
+        int getEchantillons() const;
+
+};
@@ -0,0 +1,46 @@
+#pragma once
+
+#include <string>
+#include <cstdint>
+#include "univers.hxx"
+#include "fichier.hxx"
+
+/**
+* @brief
+* Structure regroupant l'état de la simulation, hors particules,
+* stocké dans un point de reprise.
+*/
+
+struct EtatReprise{
+    double temps = 0; /**< Temps de simulation au début de l'itération reprise. */
+    int64_t iteration = 0; /**< Numéro de l'itération reprise. */
+    uint64_t hashConfiguration = 0; /**< Empreinte de la configuration utilisée. */
+    IdentifiantParticule prochainId = 0; /**< Prochain identifiant de l'univers, qui sert aussi de compteur aux tirages des sources. */
+};
+
+/**
+* @brief
+* Fonction qui sauvegarde un point de reprise binaire contenant
+* toutes les particules de la grille (identifiant, catégorie, masse,
+* position, vitesse et force) et l'état de la simulation. Les
+* particules sont écrites dans l'ordre de la grille afin que la
+* reprise soit identique au bit près, sauf avec des cellules de type
+* Colonie, dont les emplacements libres ne sont pas sauvegardés. Le
+* fichier est d'abord écrit sous un nom temporaire puis renommé.
+* @param[in] adresseFichier est l'adresse du fichier de reprise.
+* @param[in] univers est l'univers à sauvegarder.
+* @param[in] etat est l'état de la simulation.
+*/
+
+void sauvegarderReprise(const std::string& adresseFichier, const Univers& univers, const EtatReprise& etat);
+
+/**
+* @brief
+* Fonction qui lit un point de reprise et restaure ses
+* particules dans un univers vide.
+* @param[in] adresseFichier est l'adresse du fichier de reprise.
+* @param[in] univers est l'univers à remplir.
+* @return État de la simulation stocké dans le fichier.
+*/
+
+EtatReprise lireReprise(const std::string& adresseFichier, Univers& univers);
@@ -1,25 +1,70 @@
 #pragma once
 
 #include <string>
+#include <vector>
+#include <utility>
 #include "univers.hxx"
 #include "fichier.hxx"
 
 /**
 * @brief 
-* Fonction qui sauvegarde l'état de l'univers dans un fichier texte.
-* @param[in] fichierTexte est le descripteur du fichier de sortie.
+* Fonction qui sauvegarde l’état de l’univers dans un fichier VTU.
+* @param[in] nomDossier est le nom du dossier où les fichiers seront sauvegardés.
 * @param[in] univers est l'univers à sauvegarder.
 * @param[in] i est le numéro de l'itération.
 */
 
-void sauvegarderEtatEnTexte(std::ofstream& fichierTexte, const Univers& univers, int i);
+void sauvegarderEtatEnVTU(const std::string& nomDossier, const Univers& univers, int i);
 
 /**
 * @brief 
-* Fonction qui sauvegarde l’état de l’univers dans un fichier VTU.
-* @param[in] nomDossier est le nom du dossier où les fichiers seront sauvegardés.
-* @param[in] univers est l'univers à sauvegarder.
-* @param[in] i est le numéro de l'itération.
+* Classe qui tient à jour un fichier de collection ParaView (.pvd)
+* associant chaque fichier de sortie à son temps de simulation. Le
+* fichier est réécrit à chaque ajout afin de rester lisible pendant
+* la simulation.
 */
 
-void sauvegarderEtatEnVTU(const std::string& nomDossier, const Univers& univers, int i);
+class CollectionPVD{
+
+    private:
+
+        std::string adresseFichier; /**< Adresse du fichier de collection. */
+        std::vector<std::pair<double, std::string>> entrees; /**< Temps et nom relatif de chaque fichier. */
+
+    public:
+
+        /* Constructeur */
+
+        /**
+        * @brief 
+        * Constructeur de la classe CollectionPVD.
+        * @param adresseFichier est l'adresse du fichier de collection.
+        * @param tempsReprise est, en cas de reprise, le temps à partir duquel
+        * les entrées existantes sont supprimées. Une valeur négative crée une
+        * collection vide.
+        */
+
+        CollectionPVD(const std::string& adresseFichier, double tempsReprise = -1);
+
+        /* Méthodes publiques */
+
+        /**
+        * @brief 
+        * Fonction qui ajoute un fichier à la collection et réécrit le fichier.
+        * @param[in] temps est le temps de simulation du fichier.
+        * @param[in] nomFichier est le nom du fichier, relatif au dossier de la collection.
+        */
+
+        void ajouter(double temps, const std::string& nomFichier);
+
+        /* Getters */
+
+        /**
+        * @brief 
+        * Fonction qui obtient les entrées de la collection.
+        * @return Référence aux couples (temps, nom de fichier).
+        */
+
+        const std::vector<std::pair<double, std::string>>& getEntrees() const;
+
+};
@@ -0,0 +1,70 @@
+#pragma once
+
+#include <string>
+#include <vector>
+#include "configuration.hxx"
+#include "particule.hxx"
+
+/**
+* @brief
+* Énumération des scénarios de collision générés procéduralement.
+*/
+
+enum class Scenario{
+    CarreSurRectangle, /**< Carré régulier de particules tombant sur un rectangle au repos. */
+    DisqueSurDalle /**< Disque de particules lourdes tombant sur une dalle, sous gravité. */
+};
+
+/**
+* @brief
+* Structure décrivant un scénario généré : ses particules, exprimées
+* dans le repère centré de l'univers, et les paramètres de
+* configuration qu'il requiert.
+*/
+
+struct DescriptionScenario{
+    std::vector<Particule> particules; /**< Particules du scénario. */
+    Vecteur<double> ld; /**< Longueurs caractéristiques de l'univers. */
+    ConditionLimite conditionLimite; /**< Traitement au bord de l'univers. */
+    bool forcePG; /**< Indique si le potentiel gravitationnel est utilisé. */
+};
+
+/**
+* @brief
+* Fonction qui convertit un nom de scénario en valeur de l'énumération.
+* @param[in] nom est 'carre' ou 'disque'.
+* @return Scénario correspondant.
+*/
+
+Scenario lireScenario(const std::string& nom);
+
+/**
+* @brief
+* Fonction qui obtient le nom d'un scénario.
+* @param[in] scenario est le scénario.
+* @return Nom du scénario, tel qu'accepté par lireScenario.
+*/
+
+std::string getNomScenario(Scenario scenario);
+
+/**
+* @brief
+* Fonction qui génère un scénario d'environ nombreParticules particules.
+* Les dimensions du scénario et de l'univers sont mises à l'échelle de
+* sorte que la densité et l'espacement des réseaux restent ceux des
+* fichiers colision1.vtu et colision2.vtu.
+* @param[in] scenario est le scénario à générer.
+* @param[in] nombreParticules est le nombre de particules souhaité.
+* @return Description du scénario.
+*/
+
+DescriptionScenario genererScenario(Scenario scenario, int nombreParticules);
+
+/**
+* @brief
+* Fonction qui applique à la configuration les paramètres d'un scénario.
+* L'univers doit être créé après cet appel.
+* @param[in] description est la description du scénario.
+*/
+
+void configurerScenario(const DescriptionScenario& description);
@@ -1,9 +1,22 @@
 #pragma once
 
+#include <algorithm>
+#include <csignal>
+#include <memory>
 #include "configuration.hxx"
 #include "sauvegardage.hxx"
+#include "reprise.hxx"
+#include "trajectoire.hxx"
+#include "journal.hxx"
+#include "reduction.hxx"
+#include "cadence.hxx"
+#include "compteurs_materiels.hxx"
+#include "trace.hxx"
 #include "fichier.hxx"
 #include "univers.hxx"
+#include "sources.hxx"
+#include "sommation.hxx"
+#include "diffusion.hxx"
 
 /**
 * @brief 
@@ -30,45 +43,101 @@ class Simulation{
         double delta; /**< Définit la valeur de delta. */
         double tFinal; /**< Définit la valeur de tFinal. */
 
+        double temps; /**< Temps de simulation au début de l'itération courante. */
+        int iteration; /**< Numéro de l'itération courante. */
+        bool forcesCalculees; /**< Indique si les forces initiales sont déjà connues (reprise). */
+        int intervalleReprise; /**< Définit le nombre d'itérations entre deux points de reprise. */
+        int intervalleChronometrage; /**< Définit le nombre d'itérations entre deux affichages des chronomètres (0 pour aucun). */
+        bool compteursMateriels; /**< Indique si les compteurs de performance matériels sont lus pour chaque phase. */
+        bool trace; /**< Indique si la chronologie des phases est écrite dans trace.json. */
+        int traceDebut; /**< Première itération enregistrée dans la trace. */
+        int traceFin; /**< Dernière itération enregistrée dans la trace, négative pour aller jusqu'à la fin. */
+
         std::string nomDossier; /**< Définit le nom du dossier dans lequel les fichiers de sortie seront créés. */
-        std::ofstream fichierTexte; /**< Définit le descripteur du fichier texte dans lequel l'état des particules est sauvegardé */
+        std::unique_ptr<JournalParticules> journal; /**< Journal tabulaire de l'état des particules, nul s'il est désactivé. */
+        std::unique_ptr<ReductionChamps> reduction; /**< Réduction en champs grossiers, nulle si elle est désactivée. */
+        std::unique_ptr<CollectionPVD> collectionVTU; /**< Collection ParaView des fichiers VTU. */
+        std::unique_ptr<CollectionPVD> collectionReduction; /**< Collection ParaView des fichiers VTI des champs réduits. */
+
+        bool sorties; /**< Indique si les fichiers de sortie et les points de reprise sont écrits. */
+        Cadence cadenceJournal; /**< Cadence d'écriture du journal des particules. */
+        Cadence cadenceVTU; /**< Cadence d'écriture des fichiers VTU ou des frames de trajectoire. */
+        Cadence cadenceReduction; /**< Cadence d'écriture des champs réduits. */
+        std::unique_ptr<EcrivainTrajectoire> trajectoire; /**< Fichier de trajectoire remplaçant les fichiers VTU, nul s'il est désactivé. */
+        std::unique_ptr<Sources> sources; /**< Sources de particules, nulles s'il n'y en a pas. */
+        int intervalleCompaction; /**< Définit le nombre d'itérations entre deux compactions des particules absorbées (0 pour aucune). */
+        bool deterministe; /**< Indique si les résultats sont identiques bit à bit quel que soit le nombre de threads. */
+        std::vector<double> energiesCellules; /**< Énergie cinétique de chaque cellule, sommée par paires en mode déterministe. */
+        std::unique_ptr<DiffusionEtat> diffusion; /**< Diffusion en direct de l'état des particules, nulle si elle est désactivée. */
+        Cadence cadenceDiffusion; /**< Cadence de publication des frames diffusées. */
 
         /* Méthodes privées */
 
-        /**
-        * @brief 
-        * Fonction qui calcule toutes les forces impliquées dans le système.
-        */
-
-        void calculerForcesDuSysteme();
-        
         /**
         * @brief 
         * Fonction qui calcule les forces réfléchissantes qui
-        * affectent une particule lorsqu'elle se trouve très près du bord.
+        * affectent une particule lorsqu'elle se trouve très près d'une
+        * paroi : faces de la boîte en condition de réflexion ou obstacle.
+        * Chaque paroi agit comme une particule image à la distance 2d.
         * @param[in] particule est la particule.
+        * @param[in] k est le rang de sa cellule parmi les cellules proches des parois.
         */
         
-        void calculerForceReflexive(Particule* particule);
+        void calculerForceReflexive(Particule* particule, size_t k);
         
+        /**
+        * @brief 
+        * Fonction qui mesure la mémoire de l'univers et des tampons de
+        * sortie, et échantillonne la mémoire résidente du processus.
+        */
+
+        void mesurerMemoire();
+
+        /* Noyaux de calcul */
+
+        /**
+        * @brief 
+        * Fonction qui calcule toutes les forces impliquées dans le système.
+        */
+
+        void calculerForcesDuSysteme();
+
         /**
         * @brief 
         * Fonction qui calcule les forces qui affectent une 
         * particule appartenant à une cellule donnée. Les forces
         * peuvent être dues au potentiel de Lennard-Jones, à l'interaction
-        * gravitationnelle ou au potentiel gravitationnel.
+        * gravitationnelle ou au potentiel gravitationnel. La même
+        * boucle sert à toutes les conditions limites : en condition
+        * périodique, les voisines repliées sont translatées par
+        * pourChaqueVoisine.
         * @param[in] cellule est la cellule.
         * @param[in] particule est la particule.
         */
         
         void calculerForceSurParticule(const Cellule& cellule, Particule* particule);
+
+        /**
+        * @brief 
+        * Fonction qui calcule les forces qui affectent une particule
+        * en parcourant toutes ses voisines, sans mettre à jour ces
+        * dernières. Chaque paire est donc évaluée deux fois, mais la
+        * particule accumule ses forces dans l'ordre fixe du stencil :
+        * les particules peuvent être réparties entre les threads sans
+        * que le résultat dépende de leur nombre (mode déterministe).
+        * @param[in] cellule est la cellule.
+        * @param[in] particule est la particule.
+        */
         
+        void calculerForceCompleteSurParticule(const Cellule& cellule, Particule* particule);
+
         /**
-        * @brief Fonction qui calcule l'énergie cinétique
-        * du système à un moment donné.
+        * @brief
+        * Classe d'accès aux noyaux de calcul privés, définie par les
+        * microbenchmarks.
         */
 
-        double calculerEnergieCinetique();
+        friend class AccesNoyauxSimulation;
 
     public:
 
@@ -87,9 +156,39 @@ class Simulation{
 
         /**
         * @brief 
-        * Fonction qui exécute l’algorithme Stromer verlet.
+        * Fonction qui exécute l’algorithme Stromer verlet. Si des
+        * points de reprise sont activés, un point est écrit toutes
+        * les intervalleReprise itérations ainsi qu'à la réception de
+        * SIGUSR1 ; à la réception de SIGTERM, un point est écrit et
+        * la simulation s'arrête.
         */
 
         void stromerVerlet();
 
+        /**
+        * @brief 
+        * Fonction qui sauvegarde un point de reprise de l'état courant.
+        * @param[in] adresseFichier est l'adresse du fichier de reprise.
+        */
+
+        void sauvegarderPointDeReprise(const std::string& adresseFichier) const;
+
+        /* Getters */
+
+        /**
+        * @brief 
+        * Fonction qui obtient le temps de simulation courant.
+        * @return Temps au début de l'itération courante.
+        */
+
+        double getTemps() const;
+
+        /**
+        * @brief 
+        * Fonction qui obtient le numéro de l'itération courante.
+        * @return Numéro de l'itération courante.
+        */
+
+        int getIteration() const;
+
 };
@@ -0,0 +1,17 @@
+#pragma once
+
+#include <cstddef>
+
+/**
+* @brief
+* Fonction qui somme des réels par paires : les deux moitiés sont
+* sommées récursivement puis additionnées, les blocs d'au plus huit
+* valeurs étant sommés en séquence. L'ordre des additions ne dépend
+* que du nombre de valeurs, et l'erreur d'arrondi croît comme log(n)
+* au lieu de n pour une somme séquentielle.
+* @param[in] valeurs est le pointeur vers la première valeur.
+* @param[in] n est le nombre de valeurs.
+* @return Somme des valeurs.
+*/
+
+double sommerParPaires(const double* valeurs, size_t n);
@@ -0,0 +1,120 @@
+#pragma once
+
+#include <string>
+#include <vector>
+#include "philox.hxx"
+#include "univers.hxx"
+
+/**
+* @brief
+* Énumération des faces de l'univers sur lesquelles une source
+* peut injecter des particules.
+*/
+
+enum class FaceSource{
+    XMin, /**< Face x = 0. */
+    XMax, /**< Face x = ldX. */
+    YMin, /**< Face y = 0. */
+    YMax, /**< Face y = ldY. */
+    ZMin, /**< Face z = 0. */
+    ZMax /**< Face z = ldZ. */
+};
+
+/**
+* @brief
+* Structure décrivant une source qui injecte des particules
+* identiques sur une face de l'univers.
+*/
+
+struct Source{
+    FaceSource face; /**< Face sur laquelle les particules sont injectées. */
+    double debit; /**< Nombre de particules injectées par unité de temps. */
+    Vecteur<double> vitesse; /**< Vitesse des particules injectées. */
+    double masse; /**< Masse des particules injectées. */
+    std::string categorie; /**< Catégorie des particules injectées. */
+};
+
+/**
+* @brief
+* Classe regroupant les sources de particules d'un univers ouvert.
+* Les particules sont placées à la distance rCutReflexion/2 de leur
+* face, où la force d'une paroi réfléchissante s'annule, et à une
+* position tirée uniformément sur la face. Le nombre de particules
+* injectées et leurs positions ne dépendent que de l'itération, de
+* la graine et des identifiants, comme les particules aléatoires.
+*/
+
+class Sources{
+
+    private:
+
+        std::vector<Source> sources; /**< Sources de l'univers. */
+        Vecteur<double> ld; /**< Vecteur des longueurs caractéristiques de l'univers. */
+        double distanceFace; /**< Distance entre la face et les particules injectées. */
+        Philox philox; /**< Générateur des positions sur la face. */
+
+    public:
+
+        /* Constructeur */
+
+        /**
+        * @brief
+        * Constructeur de la classe Sources, sans source.
+        * @param ld est le vecteur des longueurs caractéristiques de l'univers.
+        * @param distanceFace est la distance entre la face et les particules injectées.
+        * @param graine est la graine des positions tirées.
+        */
+
+        Sources(const Vecteur<double>& ld, double distanceFace, uint64_t graine);
+
+        /* Méthodes publiques */
+
+        /**
+        * @brief
+        * Fonction qui ajoute une source.
+        * @param[in] source est la source.
+        * @throw std::invalid_argument si le débit est négatif ou si
+        *        l'axe de la face est de longueur nulle.
+        */
+
+        void ajouterSource(const Source& source);
+
+        /**
+        * @brief
+        * Fonction qui lit les sources d'un fichier texte, une par ligne :
+        * SOURCE face debit vx vy vz [masse [categorie]], la face étant
+        * X-, X+, Y-, Y+, Z- ou Z+. La masse vaut 1 et la catégorie N/A
+        * par défaut. Les lignes vides et celles commençant par # sont
+        * ignorées.
+        * @param[in] adresseFichier est l'adresse du fichier des sources.
+        * @throw std::runtime_error si le fichier ne peut pas être ouvert.
+        * @throw std::invalid_argument si le fichier est mal formé.
+        */
+
+        void lireFichier(const std::string& adresseFichier);
+
+        /**
+        * @brief
+        * Fonction qui injecte dans l'univers les particules d'une
+        * itération : floor(debit*delta*(i+1)) - floor(debit*delta*i)
+        * particules par source, si bien que le débit moyen est exact
+        * même s'il est inférieur à une particule par itération.
+        * @param[in] univers est l'univers, dont les cellules sont remplies.
+        * @param[in] iteration est le numéro de l'itération.
+        * @param[in] delta est le pas de temps.
+        * @return Nombre de particules injectées.
+        */
+
+        int64_t injecter(Univers& univers, int iteration, double delta) const;
+
+        /* Getters */
+
+        /**
+        * @brief
+        * Fonction qui obtient les sources.
+        * @return Référence au vecteur des sources.
+        */
+
+        const std::vector<Source>& getSources() const;
+
+};
@@ -0,0 +1,245 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+#include "chronometrage.hxx"
+
+/**
+* @brief
+* Structure décrivant un intervalle de temps enregistré dans la trace.
+*/
+
+struct EvenementTrace{
+    const char* nom; /**< Nom de l'événement (chaîne statique). */
+    const char* categorie; /**< Catégorie de l'événement (chaîne statique). */
+    int64_t debut; /**< Début, en nanosecondes depuis l'activation de la trace. */
+    int64_t duree; /**< Durée, en nanosecondes. */
+};
+
+/**
+* @brief
+* Classe singleton qui enregistre une chronologie des phases, des
+* tâches de chaque thread et des opérations d'entrée-sortie, puis
+* l'écrit au format Chrome Trace (JSON), lisible dans Perfetto ou
+* chrome://tracing.
+*
+* Chaque thread écrit dans son propre tampon circulaire, sans verrou :
+* seul ce thread avance l'indice d'écriture, et les tampons ne sont lus
+* qu'une fois les threads de calcul arrêtés. Lorsqu'un tampon est plein,
+* les événements les plus anciens sont écrasés.
+*/
+
+class Trace{
+
+    private:
+
+        /**
+        * @brief
+        * Structure regroupant le tampon circulaire d'un thread.
+        */
+
+        struct TamponTrace{
+            std::vector<EvenementTrace> evenements; /**< Événements, indexés modulo la capacité. */
+            std::atomic<uint64_t> ecrits{0}; /**< Nombre total d'événements écrits par le thread. */
+        };
+
+        std::atomic<bool> enregistrement; /**< Indique si l'itération courante est dans la plage enregistrée. */
+        bool actif; /**< Indique si la trace est activée. */
+        int iterationDebut; /**< Première itération enregistrée. */
+        int iterationFin; /**< Dernière itération enregistrée, négative pour aller jusqu'à la fin. */
+        std::chrono::steady_clock::time_point origine; /**< Instant d'activation de la trace. */
+        std::vector<std::unique_ptr<TamponTrace>> tampons; /**< Tampons de chaque thread. */
+        std::atomic<int> nombreThreads; /**< Nombre de threads ayant obtenu un tampon. */
+        uint64_t generation; /**< Numéro d'activation, pour réattribuer les tampons aux threads. */
+
+        /**
+        * @brief
+        * Constructeur privé par défaut de la classe Trace.
+        */
+
+        Trace();
+
+        /**
+        * @brief
+        * Constructeur de copie supprimé pour empêcher la copie de l'instance.
+        */
+
+        Trace(const Trace&) = delete;
+
+        /**
+        * @brief
+        * Opérateur d'assignation supprimé pour empêcher l'assignation de l'instance.
+        */
+
+        void operator=(const Trace&) = delete;
+
+        /**
+        * @brief
+        * Fonction qui obtient le tampon du thread appelant, en lui en
+        * attribuant un lors de son premier événement.
+        * @return Pointeur vers le tampon, nul si tous les tampons sont attribués.
+        */
+
+        TamponTrace* getTamponThread();
+
+    public:
+
+        /**
+        * @brief
+        * Fonction qui obtient l'instance unique de la classe Trace.
+        * @return Référence à l'instance unique.
+        */
+
+        static Trace& getInstance();
+
+        /* Méthodes publiques */
+
+        /**
+        * @brief
+        * Fonction qui active la trace et vide les tampons.
+        * @param[in] iterationDebut est la première itération enregistrée.
+        * @param[in] iterationFin est la dernière itération enregistrée, négative pour aller jusqu'à la fin.
+        * @param[in] capacite est le nombre d'événements conservés par thread.
+        * @param[in] nombreTampons est le nombre maximal de threads suivis.
+        */
+
+        void activer(int iterationDebut, int iterationFin, size_t capacite = 1 << 16, int nombreTampons = 64);
+
+        /**
+        * @brief
+        * Fonction qui désactive la trace.
+        */
+
+        void desactiver();
+
+        /**
+        * @brief
+        * Fonction qui indique l'itération courante, afin de n'enregistrer
+        * que la plage demandée.
+        * @param[in] iteration est le numéro de l'itération.
+        */
+
+        void setIteration(int iteration);
+
+        /**
+        * @brief
+        * Fonction qui enregistre un intervalle de temps dans le tampon du thread appelant.
+        * @param[in] nom est le nom de l'événement (chaîne statique).
+        * @param[in] categorie est la catégorie de l'événement (chaîne statique).
+        * @param[in] debut est l'instant de début.
+        * @param[in] fin est l'instant de fin.
+        */
+
+        void enregistrer(const char* nom, const char* categorie,
+                         std::chrono::steady_clock::time_point debut, std::chrono::steady_clock::time_point fin);
+
+        /**
+        * @brief
+        * Fonction qui écrit les événements de tous les threads dans un
+        * fichier JSON au format Chrome Trace. Elle ne doit pas être
+        * appelée pendant que d'autres threads enregistrent.
+        * @param[in] adresseFichier est l'adresse du fichier JSON.
+        */
+
+        void ecrire(const std::string& adresseFichier) const;
+
+        /* Getters */
+
+        /**
+        * @brief
+        * Fonction qui indique si les événements sont actuellement enregistrés.
+        * @return true si la trace est active et l'itération dans la plage.
+        */
+
+        bool estEnregistree() const{
+            return enregistrement.load(std::memory_order_relaxed);
+        }
+
+        /**
+        * @brief
+        * Fonction qui obtient les événements conservés pour un thread,
+        * du plus ancien au plus récent.
+        * @param[in] thread est le numéro du tampon.
+        * @return Copie des événements conservés.
+        */
+
+        std::vector<EvenementTrace> getEvenements(int thread) const;
+
+        /**
+        * @brief
+        * Fonction qui obtient le nombre de threads ayant enregistré des événements.
+        * @return Nombre de tampons attribués.
+        */
+
+        int getNombreThreads() const;
+
+        /**
+        * @brief
+        * Fonction qui obtient le nombre d'événements écrasés faute de place.
+        * @return Nombre d'événements perdus, tous threads confondus.
+        */
+
+        uint64_t getEvenementsPerdus() const;
+
+        /**
+        * @brief
+        * Fonction qui calcule la mémoire occupée par les tampons.
+        * @return Nombre d'octets alloués.
+        */
+
+        size_t getOctets() const;
+
+};
+
+/**
+* @brief
+* Classe qui enregistre dans la trace un événement couvrant sa durée de vie.
+*/
+
+class PorteeTrace{
+
+    private:
+
+        const char* nom; /**< Nom de l'événement. */
+        const char* categorie; /**< Catégorie de l'événement. */
+        bool enregistree; /**< Indique si la trace était enregistrée au début. */
+        std::chrono::steady_clock::time_point debut; /**< Instant de début. */
+
+    public:
+
+        /**
+        * @brief
+        * Constructeur de la classe PorteeTrace.
+        * @param nom est le nom de l'événement (chaîne statique).
+        * @param categorie est la catégorie de l'événement (chaîne statique).
+        */
+
+        PorteeTrace(const char* nom, const char* categorie) : nom(nom), categorie(categorie), enregistree(Trace::getInstance().estEnregistree()){
+            if(enregistree){
+                debut = std::chrono::steady_clock::now();
+            }
+        }
+
+        /**
+        * @brief
+        * Destructeur de la classe PorteeTrace, qui enregistre l'événement.
+        */
+
+        ~PorteeTrace(){
+            if(enregistree){
+                Trace::getInstance().enregistrer(nom, categorie, debut, std::chrono::steady_clock::now());
+            }
+        }
+
+};
+
+#ifdef AVEC_CHRONOMETRAGE
+    /** Enregistrer dans la trace une tâche couvrant la fin du bloc courant. */
+    #define TRACER(nom) PorteeTrace CONCATENER(portee, __LINE__)(nom, "tache")
+#else
+    #define TRACER(nom)
+#endif
@@ -0,0 +1,341 @@
+#pragma once
+
+#include <string>
+#include <map>
+#include <memory>
+#include <vector>
+#include <cstdint>
+#include "univers.hxx"
+#include "fichier.hxx"
+#include "encodage.hxx"
+
+/**
+* @brief
+* Champs optionnels pouvant être stockés dans une frame de trajectoire.
+* Les identifiants, positions, vitesses, masses et catégories sont
+* toujours présents.
+*/
+
+enum ChampTrajectoire : uint32_t {
+    CHAMP_FORCES = 1 /**< Forces appliquées aux particules. */
+};
+
+/**
+* @brief
+* Structure décrivant une entrée de la table d'index des frames.
+*/
+
+struct EntreeIndexTrajectoire{
+    uint64_t position; /**< Position de la frame dans le fichier, en octets. */
+    int64_t iteration; /**< Numéro de l'itération de la frame. */
+    double temps; /**< Temps de simulation de la frame. */
+};
+
+/**
+* @brief
+* Structure regroupant l'état quantifié des particules d'une frame
+* compressée, triées par identifiant. Chaque frame compressée est
+* codée par différence avec l'état de la frame précédente.
+*/
+
+struct EtatCodecTrajectoire{
+    std::vector<int64_t> ids; /**< Identifiants triés par ordre croissant. */
+    std::vector<int64_t> positions; /**< Positions quantifiées (x, y, z). */
+    std::vector<int64_t> vitesses; /**< Vitesses quantifiées (x, y, z). */
+    std::vector<uint32_t> forces; /**< Représentation binaire des forces en simple précision. */
+    std::vector<uint32_t> masses; /**< Représentation binaire des masses en simple précision. */
+    std::vector<uint32_t> categories; /**< Indices des catégories. */
+};
+
+/**
+* @brief
+* Structure donnant accès aux colonnes d'une frame. Pour une frame
+* non compressée, les pointeurs désignent directement la projection
+* mémoire du fichier et restent valides tant que le lecteur existe ;
+* pour une frame compressée, ils désignent les colonnes décodées
+* conservées dans stockage.
+*/
+
+struct FrameTrajectoire{
+    int64_t iteration = 0; /**< Numéro de l'itération. */
+    double temps = 0; /**< Temps de simulation. */
+    uint64_t nombreParticules = 0; /**< Nombre de particules de la frame. */
+    uint32_t champs = 0; /**< Champs optionnels présents (ChampTrajectoire). */
+    const int64_t* ids = nullptr; /**< Identifiants des particules. */
+    const float* positions = nullptr; /**< Positions (x, y, z) centrées sur l'origine. */
+    const float* vitesses = nullptr; /**< Vitesses (x, y, z). */
+    const float* forces = nullptr; /**< Forces (x, y, z), nul si absentes. */
+    const float* masses = nullptr; /**< Masses des particules. */
+    const uint32_t* categories = nullptr; /**< Indices des catégories dans nomsCategories. */
+    std::vector<std::string> nomsCategories; /**< Noms des catégories de la frame. */
+    std::shared_ptr<const std::vector<char>> stockage; /**< Colonnes décodées d'une frame compressée. */
+};
+
+/**
+* @brief
+* Classe qui écrit une trajectoire dans un fichier unique. Le fichier
+* contient un en-tête, puis les frames ajoutées les unes à la suite des
+* autres sous forme de colonnes, puis à la fermeture une table d'index
+* des frames et un pied de page qui pointe vers elle.
+*
+* Si la compression est activée, les positions et les vitesses sont
+* quantifiées à une précision donnée et chaque frame ne contient que
+* les différences avec la frame précédente, codées en entiers à
+* longueur variable. Une image clé, codée sans référence, est écrite
+* périodiquement pour borner le décodage lors d'un accès direct.
+*/
+
+class EcrivainTrajectoire{
+
+    private:
+
+        std::ofstream fichier; /**< Descripteur du fichier de trajectoire. */
+        std::vector<EntreeIndexTrajectoire> index; /**< Index des frames déjà écrites. */
+        std::vector<char> tampon; /**< Tampon dans lequel chaque frame est construite. */
+        uint64_t position; /**< Taille courante du fichier, en octets. */
+        bool avecForces; /**< Indique si les forces sont écrites. */
+        bool ouvert; /**< Indique si le fichier n'est pas encore fermé. */
+
+        std::map<std::string, uint32_t> indicesCategories; /**< Indices des catégories déjà rencontrées. */
+        std::vector<std::string> categories; /**< Noms des catégories, dans l'ordre de leurs indices. */
+
+        bool compression; /**< Indique si les frames sont compressées. */
+        double precision; /**< Pas de quantification des positions et des vitesses. */
+        int intervalleImagesCles; /**< Nombre de frames entre deux images clés. */
+        int framesDepuisImageCle; /**< Nombre de frames écrites depuis la dernière image clé. */
+        bool precedentValide; /**< Indique si l'état de la frame précédente est connu. */
+        EtatCodecTrajectoire precedent; /**< État quantifié de la frame précédente. */
+
+        /**
+        * @brief
+        * Fonction qui obtient l'indice d'une catégorie, en l'ajoutant
+        * à la table si elle est nouvelle.
+        * @param[in] categorie est le nom de la catégorie.
+        * @return Indice de la catégorie.
+        */
+
+        uint32_t indiceCategorie(const std::string& categorie);
+
+        /**
+        * @brief
+        * Fonction qui construit dans le tampon les données d'une frame
+        * non compressée.
+        * @param[in] univers est l'univers à sauvegarder.
+        */
+
+        void construireFrameBrute(const Univers& univers);
+
+        /**
+        * @brief
+        * Fonction qui construit dans le tampon les données d'une frame
+        * compressée.
+        * @param[in] univers est l'univers à sauvegarder.
+        */
+
+        void construireFrameCompressee(const Univers& univers);
+
+    public:
+
+        /* Constructeur */
+
+        /**
+        * @brief
+        * Constructeur de la classe EcrivainTrajectoire.
+        * @param adresseFichier est l'adresse du fichier de trajectoire.
+        * @param ld est le vecteur des longueurs caractéristiques de l'univers.
+        * @param avecForces indique si les forces sont écrites.
+        * @param iterationReprise est, en cas de reprise, la première itération
+        * à écrire : les frames précédentes du fichier existant sont conservées
+        * et les suivantes supprimées. Une valeur négative crée un nouveau fichier.
+        */
+
+        EcrivainTrajectoire(const std::string& adresseFichier, const Vecteur<double>& ld, bool avecForces, int64_t iterationReprise = -1);
+
+        /**
+        * @brief
+        * Destructeur de la classe EcrivainTrajectoire, qui ferme le fichier.
+        */
+
+        ~EcrivainTrajectoire();
+
+        /* Méthodes publiques */
+
+        /**
+        * @brief
+        * Fonction qui ajoute l'état des particules de la grille comme
+        * nouvelle frame à la fin du fichier.
+        * @param[in] univers est l'univers à sauvegarder.
+        * @param[in] iteration est le numéro de l'itération.
+        * @param[in] temps est le temps de simulation.
+        */
+
+        void ajouterFrame(const Univers& univers, int64_t iteration, double temps);
+
+        /**
+        * @brief
+        * Fonction qui active la compression des frames suivantes.
+        * La première frame compressée est toujours une image clé.
+        * @param[in] precision est le pas de quantification des positions et des vitesses.
+        * @param[in] intervalleImagesCles est le nombre de frames entre deux images clés.
+        */
+
+        void activerCompression(double precision, int intervalleImagesCles);
+
+        /**
+        * @brief
+        * Fonction qui écrit la table d'index et le pied de page puis
+        * ferme le fichier.
+        */
+
+        void fermer();
+
+        /**
+        * @brief
+        * Fonction qui calcule la mémoire occupée par le tampon de
+        * construction des frames, par l'index et par l'état de la
+        * frame précédente.
+        * @return Nombre d'octets alloués.
+        */
+
+        size_t getOctets() const;
+
+};
+
+/**
+* @brief
+* Classe qui lit un fichier de trajectoire par projection mémoire.
+* Si la table d'index est absente, par exemple après un arrêt brutal,
+* les frames sont retrouvées en parcourant le fichier.
+*/
+
+class LecteurTrajectoire{
+
+    private:
+
+        const char* donnees; /**< Début de la projection mémoire du fichier. */
+        size_t taille; /**< Taille du fichier, en octets. */
+        Vecteur<double> ld; /**< Longueurs caractéristiques de l'univers. */
+        std::vector<EntreeIndexTrajectoire> index; /**< Index des frames du fichier. */
+
+        mutable size_t frameDecodee; /**< Numéro de la dernière frame compressée décodée. */
+        mutable EtatCodecTrajectoire etat; /**< État quantifié de la dernière frame compressée décodée. */
+
+        /**
+        * @brief
+        * Fonction qui décode les frames compressées depuis l'image clé
+        * précédente, ou depuis la dernière frame décodée, jusqu'à la frame k.
+        * @param[in] k est le numéro de la frame à décoder.
+        */
+
+        void decoderJusqua(size_t k) const;
+
+        /**
+        * @brief
+        * Fonction qui vérifie qu'une frame entière, en-tête compris,
+        * commence à une position donnée et se termine avant une limite.
+        * @param[in] position est la position supposée de la frame.
+        * @param[in] limite est la position que la frame ne doit pas dépasser.
+        * @return Vrai si la frame est entièrement contenue avant la limite.
+        */
+
+        bool contientFrame(uint64_t position, uint64_t limite) const;
+
+        /**
+        * @brief
+        * Constructeur de copie supprimé, la projection mémoire étant unique.
+        */
+
+        LecteurTrajectoire(const LecteurTrajectoire&) = delete;
+
+        /**
+        * @brief
+        * Opérateur d'assignation supprimé, la projection mémoire étant unique.
+        */
+
+        void operator=(const LecteurTrajectoire&) = delete;
+
+    public:
+
+        /* Constructeur */
+
+        /**
+        * @brief
+        * Constructeur de la classe LecteurTrajectoire.
+        * @param adresseFichier est l'adresse du fichier de trajectoire.
+        */
+
+        LecteurTrajectoire(const std::string& adresseFichier);
+
+        /**
+        * @brief
+        * Destructeur de la classe LecteurTrajectoire, qui libère la projection.
+        */
+
+        ~LecteurTrajectoire();
+
+        /* Méthodes publiques */
+
+        /**
+        * @brief
+        * Fonction qui donne accès à la frame numéro k sans copier ses colonnes.
+        * @param[in] k est le numéro de la frame.
+        * @return Description de la frame.
+        */
+
+        FrameTrajectoire lireFrame(size_t k) const;
+
+        /**
+        * @brief
+        * Fonction qui calcule la position de fin de la frame numéro k.
+        * @param[in] k est le numéro de la frame.
+        * @return Position, en octets, qui suit la dernière donnée de la frame.
+        */
+
+        uint64_t getFinFrame(size_t k) const;
+
+        /* Getters */
+
+        /**
+        * @brief
+        * Fonction qui obtient le nombre de frames du fichier.
+        * @return Nombre de frames.
+        */
+
+        size_t getNombreFrames() const;
+
+        /**
+        * @brief
+        * Fonction qui obtient la table d'index des frames.
+        * @return Référence à la table d'index.
+        */
+
+        const std::vector<EntreeIndexTrajectoire>& getIndex() const;
+
+        /**
+        * @brief
+        * Fonction qui obtient les longueurs caractéristiques de l'univers.
+        * @return Référence au vecteur des longueurs caractéristiques.
+        */
+
+        const Vecteur<double>& getLd() const;
+
+};
+
+/**
+* @brief
+* Fonction qui sauvegarde une frame de trajectoire dans un fichier VTU.
+* @param[in] adresseFichier est l'adresse du fichier VTU.
+* @param[in] frame est la frame à sauvegarder.
+*/
+
+void sauvegarderFrameEnVTU(const std::string& adresseFichier, const FrameTrajectoire& frame);
+
+/**
+* @brief
+* Fonction qui convertit toutes les frames d'une trajectoire en
+* fichiers Iteration.<i>.vtu lisibles par ParaView.
+* @param[in] adresseTrajectoire est l'adresse du fichier de trajectoire.
+* @param[in] nomDossier est le dossier dans lequel écrire les fichiers VTU.
+*/
+
+void convertirTrajectoireEnVTU(const std::string& adresseTrajectoire, const std::string& nomDossier);
@@ -1,10 +1,11 @@
 #pragma once
 
-#include <random>
 #include "configuration.hxx"
 #include "collections.hxx"
 #include "imprimer.hxx"
 #include "cellule.hxx"
+#include "memoire.hxx"
+#include "parois.hxx"
 
 /**
 * @brief 
@@ -19,34 +20,101 @@ class Univers{
         std::vector<Particule> particules; /**< Vecteur contenant les particules de l'univers. */
 
         ConditionLimite conditionLimite; /**< Définit le type de condition limite. */
-        int nombreParticules; /**< Définit le nombre total de particules dans l'univers. */
+        int64_t nombreParticules; /**< Définit le nombre total de particules dans l'univers. */
+        IdentifiantParticule prochainId; /**< Prochain identifiant à attribuer à une particule sans identifiant. */
         double rCutReflexion;  /**< Définit la distance de coupure pour calculer la force de réflexion. */
         double rCut; /**< Définit la distance de coupure pour calculer les forces d'interaction. */
 
         Vecteur<int> nc; /**< Vecteur définissant les dimensions de la grille de cellules qui divisent l'univers. */
+        int subdivision; /**< Nombre de cellules par rayon de coupure et par direction. */
+        Vecteur<double> tailleCellule; /**< Taille des cellules par direction, ld/nc, nulle selon un axe de longueur nulle. */
         Vecteur<double> ld; /**< Vecteur des longueurs caractéristiques de l'univers. */
+        uint64_t graine; /**< Graine des particules aléatoires. */
+
+        std::vector<Vecteur<int>> stencil; /**< Décalages des indices des cellules voisines, communs à toutes les cellules. */
+        std::vector<int> stencilLineaire; /**< Décalages des indices linéaires des voisines d'une cellule intérieure. */
+        std::vector<char> cellulesSignalees; /**< Cellules dont une particule est sortie lors de la dernière dérive. */
+        std::vector<size_t> emplacementsLibres; /**< Indices dans particules des particules absorbées, réutilisables par l'injection. */
+        Parois parois; /**< Obstacles statiques et cellules à leur portée. */
         
         /* Méthodes privées */
 
         /**
         * @brief 
-        * Fonction qui ajoute les voisins d'une cellule avec un indice
-        * dont la position tridimensionnelle est (x, y, z).
-        * @param[in] indice est l’indice de la cellule.
-        * @param[in] x est le composant X de la cellule.
-        * @param[in] y est le composant Y de la cellule.
-        * @param[in] z est le composant Z de la cellule.
+        * Fonction qui replace dans leur cellule les particules non
+        * confirmées d'une cellule, et retire de l'univers celles qui
+        * sont sorties de la grille. Leur emplacement est libéré.
+        * @param[in] cellule est la cellule à corriger.
+        */
+
+        void corrigerCellule(Cellule& cellule);
+
+        /**
+        * @brief 
+        * Fonction qui relève l'emplacement, dans le vecteur des
+        * particules, de chaque particule des cellules, dans l'ordre
+        * de parcours des cellules.
+        * @return Emplacements des particules des cellules.
+        */
+
+        std::vector<size_t> releverEmplacements() const;
+
+        /**
+        * @brief 
+        * Fonction qui remplace, après une réallocation du vecteur des
+        * particules, les pointeurs des cellules par ceux des mêmes
+        * emplacements dans le nouveau vecteur, sans changer l'ordre
+        * des particules de chaque cellule.
+        * @param[in] emplacements sont les emplacements relevés avant la réallocation.
         */
 
-        void ajouterVoisines(int indice, int x, int y, int z);
+        void relierCellules(const std::vector<size_t>& emplacements);
+
+        /**
+        * @brief 
+        * Fonction qui ramène dans [0, ld) une position sortie de la
+        * grille en condition périodique.
+        * @param[in] particule est la particule.
+        */
+
+        void replierParticule(Particule* particule) const;
+
+        /**
+        * @brief 
+        * Fonction qui construit le stencil des voisines : les décalages
+        * de -k à +k par direction, k étant la subdivision, dont la
+        * distance minimale à la cellule centrale est inférieure à rCut.
+        * Un axe de longueur nulle ne garde que le décalage 0, et hors
+        * condition périodique un axe ne garde que les décalages qui
+        * peuvent rester dans la grille. En condition périodique, deux
+        * décalages peuvent désigner la même cellule, mais avec des
+        * translations différentes.
+        */
+
+        void construireStencil();
+
+        /**
+        * @brief 
+        * Fonction qui construit les parois : les six faces de la boîte
+        * en condition de réflexion, puis les obstacles du fichier de
+        * configuration, et repère les cellules à leur portée.
+        */
+
+        void construireParois();
         
     public:
 
+        static constexpr int subdivisionMaximale = 4; /**< Plus grand nombre de cellules par rayon de coupure. */
+
         /* Constructeur */
 
         /**
         * @brief 
-        * Constructeur de la classe Univers.
+        * Constructeur de la classe Univers. Les nc cellules d'un axe
+        * pavent exactement sa longueur ld, nc étant floor(ld*k/rCut).
+        * @throw std::invalid_argument si la subdivision n'est pas comprise
+        *        entre 1 et subdivisionMaximale, ou si une longueur non nulle
+        *        est inférieure à rCut.
         */
 
         Univers();
@@ -55,7 +123,8 @@ class Univers{
 
         /**
         * @brief 
-        * Fonction qui ajoute une particule à l'univers.
+        * Fonction qui ajoute une particule à l'univers. Une particule
+        * sans identifiant reçoit le prochain identifiant de l'univers.
         * @param[in] particule est la particule.
         */
 
@@ -63,12 +132,76 @@ class Univers{
 
         /**
         * @brief 
-        * Fonction qui ajoute un nombre donné
-        * de particules aléatoires à l'univers.
+        * Fonction qui ajoute un nombre donné de particules aléatoires
+        * à l'univers, avec des identifiants consécutifs. La position et la vitesse de la particule
+        * d'indice i sont tirées par Philox avec le compteur i : elles
+        * ne dépendent que de la graine, de l'indice et des dimensions,
+        * et sont calculées en parallèle.
         * @param[in] n est le nombre de particules à créer.
+        * @param[in] ecartTypeVitesse est l'écart type de chaque composante
+        *            de la vitesse, tirée selon une loi normale (0 pour des
+        *            particules immobiles).
+        */
+
+        void ajouterParticulesAleatoires(int64_t n, double ecartTypeVitesse = 0);
+
+        /**
+        * @brief 
+        * Fonction qui ajoute à l'univers une particule dont la position
+        * est déjà exprimée dans le repère de la grille, par exemple
+        * lors de la lecture d'un point de reprise. Son identifiant est
+        * conservé.
+        * @param[in] particule est la particule.
+        */
+
+        void restaurerParticule(const Particule& particule);
+
+        /**
+        * @brief 
+        * Fonction qui restaure le prochain identifiant lors de la
+        * lecture d'un point de reprise, celui des particules restaurées
+        * pouvant être inférieur si les dernières ont été absorbées.
+        * @param[in] prochain est le prochain identifiant sauvegardé.
         */
 
-        void ajouterParticulesAleatoires(int n);
+        void restaurerProchainId(IdentifiantParticule prochain);
+
+        /**
+        * @brief 
+        * Fonction qui injecte une particule pendant la simulation, une
+        * fois les cellules remplies. Sa position est exprimée dans le
+        * repère de la grille ; elle occupe l'emplacement d'une particule
+        * absorbée s'il y en a un, et reçoit le prochain identifiant si
+        * elle n'en a pas.
+        * @param[in] particule est la particule.
+        * @return Faux si la position est hors de la grille, la particule
+        *         n'étant alors pas ajoutée.
+        */
+
+        bool injecterParticule(Particule particule);
+
+        /**
+        * @brief 
+        * Fonction qui retire du vecteur des particules celles qui ont été
+        * absorbées, en déplaçant les dernières dans les emplacements
+        * libres et en remplaçant leur pointeur à sa place dans leur
+        * cellule, dont l'ordre ne change pas. Les identifiants sont
+        * conservés. Elle doit être appelée lorsque
+        * chaque particule est dans sa cellule, après corrigerCellules.
+        */
+
+        void compacterParticules();
+
+        /**
+        * @brief 
+        * Fonction qui réserve la place de n particules supplémentaires,
+        * après avoir vérifié que l'univers ainsi rempli tient dans la
+        * mémoire autorisée.
+        * @param[in] n est le nombre de particules à ajouter.
+        * @throw std::invalid_argument si l'estimation dépasse la mémoire autorisée.
+        */
+
+        void reserverParticules(size_t n);
 
         /**
         * @brief 
@@ -91,13 +224,38 @@ class Univers{
 
         void deplacerParticule(Particule* particule, const Vecteur<double>& vec);
 
+        /**
+        * @brief 
+        * Fonction qui déplace une particule de la cellule d'indice
+        * donné et calcule aussitôt sa nouvelle cellule : la particule
+        * est confirmée si elle y reste, sinon la cellule est signalée
+        * pour corrigerCellulesSignalees, qui replie aussi sa position en
+        * condition périodique. Elle peut être appelée en
+        * parallèle tant que chaque cellule est traitée par un seul thread.
+        * @param[in] indiceCellule est l'indice de la cellule de la particule.
+        * @param[in] particule est la particule.
+        * @param[in] vec est la direction à déplacer.
+        */
+
+        void deriverParticule(size_t indiceCellule, Particule* particule, const Vecteur<double>& vec);
+
         /**
         * @brief 
         * Une fonction qui remplit le vecteur de pointeurs de
         * chaque cellule avec les particules correspondantes. 
+        * L'emplacement des particules hors de la grille est libéré.
         */
 
         void remplirCellules();
+
+        /**
+        * @brief 
+        * Fonction qui enregistre dans le singleton Memoire la mémoire
+        * occupée par les particules, les cellules, leurs voisines et
+        * les conteneurs de particules des cellules.
+        */
+
+        void mesurerMemoire() const;
         
         /**
         * @brief 
@@ -107,6 +265,24 @@ class Univers{
 
         void corrigerCellules();
 
+        /**
+        * @brief 
+        * Fonction qui ne corrige que les cellules signalées par
+        * deriverParticule, puis efface les signalements.
+        */
+
+        void corrigerCellulesSignalees();
+
+        /**
+        * @brief 
+        * Fonction qui calcule l'indice linéaire de la cellule
+        * contenant une position.
+        * @param[in] position est la position dans le repère de la grille.
+        * @return Indice de la cellule, ou -1 si la position est hors de la grille.
+        */
+
+        int getIndiceCellule(const Vecteur<double>& position) const;
+
         /**
         * @brief 
         * Fonction qui renvoie une référence constante à
@@ -125,6 +301,52 @@ class Univers{
         */
 
         const std::vector<Cellule>& getGrille() const;
+
+        /**
+        * @brief 
+        * Fonction qui applique une fonction à chaque voisine d'une
+        * cellule, elle comprise. Les voisines sont calculées à partir
+        * du stencil, sans être stockées dans les cellules. En condition
+        * périodique, une voisine repliée est accompagnée de la translation
+        * (±ld selon chaque axe) qui donne l'image de ses particules
+        * adjacente à la cellule : le calcul des paires n'a alors pas de
+        * correction d'image minimale, quelle que soit la condition limite.
+        * @param[in] cellule est la cellule de la grille.
+        * @param[in] fonction est appelée avec une référence constante à
+        *            chaque voisine et la translation à ajouter aux positions
+        *            de ses particules (nulle sans repliement).
+        */
+
+        template <typename Fonction>
+        void pourChaqueVoisine(const Cellule& cellule, Fonction&& fonction) const;
+
+        /**
+        * @brief 
+        * Fonction qui obtient les voisines d'une cellule, elle comprise.
+        * Elle alloue un vecteur et n'est pas destinée aux boucles de calcul.
+        * En condition périodique, une cellule est répétée pour chacune de
+        * ses images voisines.
+        * @param[in] cellule est la cellule de la grille.
+        * @return Vecteur de pointeurs vers les cellules voisines.
+        */
+
+        std::vector<const Cellule*> getVoisines(const Cellule& cellule) const;
+
+        /**
+        * @brief 
+        * Fonction qui obtient les décalages des indices des voisines.
+        * @return Référence au stencil.
+        */
+
+        const std::vector<Vecteur<int>>& getStencil() const;
+
+        /**
+        * @brief 
+        * Fonction qui obtient les parois de l'univers.
+        * @return Référence aux parois.
+        */
+
+        const Parois& getParois() const;
             
         /**
         * @brief 
@@ -142,7 +364,24 @@ class Univers{
         * @return Nombre total de particules dans l'univers.
         */
         
-        int getNombreParticules() const;
+        int64_t getNombreParticules() const;
+
+        /**
+        * @brief 
+        * Fonction qui obtient le nombre d'emplacements du vecteur des
+        * particules, y compris ceux des particules absorbées.
+        * @return Nombre d'emplacements occupés ou libres.
+        */
+
+        size_t getNombreEmplacements() const;
+
+        /**
+        * @brief 
+        * Fonction qui obtient le prochain identifiant attribué.
+        * @return Prochain identifiant.
+        */
+
+        IdentifiantParticule getProchainId() const;
 
         /**
         * @brief 
@@ -171,4 +410,32 @@ class Univers{
 
         const Vecteur<double>& getLd() const;
 
+        /**
+        * @brief 
+        * Fonction qui obtient une référence au vecteur
+        * des nombres de cellules par direction.
+        * @return Référence au vecteur des dimensions de la grille.
+        */
+
+        const Vecteur<int>& getNc() const;
+
+        /**
+        * @brief 
+        * Fonction qui obtient le nombre de cellules par rayon de coupure.
+        * @return Subdivision des cellules.
+        */
+
+        int getSubdivision() const;
+
+        /**
+        * @brief 
+        * Fonction qui obtient une référence au vecteur des tailles des
+        * cellules par direction.
+        * @return Référence au vecteur des tailles, nulles selon un axe de longueur nulle.
+        */
+
+        const Vecteur<double>& getTailleCellule() const;
+
 };
+
+#include "univers.txx"
@@ -0,0 +1,53 @@
+template <typename Fonction>
+void Univers::pourChaqueVoisine(const Cellule& cellule, Fonction&& fonction) const{
+    const Vecteur<int>& indices = cellule.getIndices();
+    const int nx = nc.getX();
+    const int ny = nc.getY();
+    const int nz = nc.getZ();
+
+    /* Une cellule intérieure a toutes ses voisines dans la grille, sans repliement */
+    if(!cellule.isBord()){
+        static const Vecteur<double> sansTranslation;
+        const Cellule* centre = &grille[indices.getX()*ny*nz + indices.getY()*nz + indices.getZ()];
+        for(int decalage : stencilLineaire){
+            fonction(centre[decalage], sansTranslation);
+        }
+        return;
+    }
+
+    /* Replier ou invalider une fois par axe les 2k+1 indices voisins. Une
+    voisine repliée par le bas est vue à sa position moins ld, par le haut
+    à sa position plus ld ; nc étant au moins k, un repliement suffit */
+    const bool periodique = conditionLimite == ConditionLimite::Periodique;
+    const int k = subdivision;
+    int voisinsX[2*subdivisionMaximale + 1], voisinsY[2*subdivisionMaximale + 1], voisinsZ[2*subdivisionMaximale + 1];
+    double imagesX[2*subdivisionMaximale + 1] = {}, imagesY[2*subdivisionMaximale + 1] = {}, imagesZ[2*subdivisionMaximale + 1] = {};
+    for(int d = -k; d <= k; d++){
+        int x = indices.getX() + d;
+        int y = indices.getY() + d;
+        int z = indices.getZ() + d;
+        if(periodique){
+            imagesX[d + k] = (x < 0) ? -ld.getX() : (x >= nx) ? ld.getX() : 0;
+            imagesY[d + k] = (y < 0) ? -ld.getY() : (y >= ny) ? ld.getY() : 0;
+            imagesZ[d + k] = (z < 0) ? -ld.getZ() : (z >= nz) ? ld.getZ() : 0;
+            x += (x < 0) ? nx : (x >= nx) ? -nx : 0;
+            y += (y < 0) ? ny : (y >= ny) ? -ny : 0;
+            z += (z < 0) ? nz : (z >= nz) ? -nz : 0;
+        }
+        voisinsX[d + k] = (x >= 0 && x < nx) ? x : -1;
+        voisinsY[d + k] = (y >= 0 && y < ny) ? y : -1;
+        voisinsZ[d + k] = (z >= 0 && z < nz) ? z : -1;
+    }
+
+    /* Ignorer les voisines hors de la grille */
+    for(const auto& decalage : stencil){
+        int x = voisinsX[decalage.getX() + k];
+        int y = voisinsY[decalage.getY() + k];
+        int z = voisinsZ[decalage.getZ() + k];
+        if(x < 0 || y < 0 || z < 0){
+            continue;
+        }
+        const Vecteur<double> translation(imagesX[decalage.getX() + k], imagesY[decalage.getY() + k], imagesZ[decalage.getZ() + k]);
+        fonction(grille[x*ny*nz + y*nz + z], translation);
+    }
+}
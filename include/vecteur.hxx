@@ -39,6 +39,16 @@ class Vecteur{
 
         Vecteur<T>(T x, T y, T z);
 
+        /**
+        * @brief 
+        * Constructeur de conversion depuis un vecteur d'un autre type,
+        * par exemple entre simple et double précision.
+        * @param autre est le vecteur à convertir.
+        */
+
+        template <typename S>
+        Vecteur<T>(const Vecteur<S>& autre);
+
         /* Méthodes publiques */
 
         /**
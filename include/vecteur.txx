@@ -6,6 +6,11 @@ Vecteur<T>::Vecteur() : x(0), y(0), z(0) {}
 template <typename T>
 Vecteur<T>::Vecteur(T x, T y, T z) : x(x), y(y), z(z) {}
 
+template <typename T>
+template <typename S>
+Vecteur<T>::Vecteur(const Vecteur<S>& autre) : 
+    x(static_cast<T>(autre.getX())), y(static_cast<T>(autre.getY())), z(static_cast<T>(autre.getZ())) {}
+
 /* Méthodes publiques */
 
 template <typename T>
@@ -1,4 +1,33 @@
 #include "configuration.hxx"
+#include <iterator>
+
+/* Appliquer FNV-1a sur des octets à partir d'une empreinte */
+static uint64_t melangerOctets(uint64_t hash, const void* donnees, size_t taille){
+    const unsigned char* octets = static_cast<const unsigned char*>(donnees);
+    for(size_t i = 0; i < taille; i++){
+        hash = (hash ^ octets[i]) * 1099511628211ULL;
+    }
+    return hash;
+}
+
+/* Ajouter une chaîne précédée de sa longueur, pour que deux chaînes
+consécutives ne puissent pas se confondre */
+static uint64_t melangerChaine(uint64_t hash, const std::string& chaine){
+    const uint64_t longueur = chaine.size();
+    hash = melangerOctets(hash, &longueur, sizeof(longueur));
+    return melangerOctets(hash, chaine.data(), chaine.size());
+}
+
+/* Ajouter l'adresse d'un fichier puis son contenu, vide s'il est illisible */
+static uint64_t melangerFichier(uint64_t hash, const std::string& adresseFichier){
+    hash = melangerChaine(hash, adresseFichier);
+    std::string contenu;
+    if(!adresseFichier.empty()){
+        std::ifstream fichier(adresseFichier, std::ios::binary);
+        contenu.assign(std::istreambuf_iterator<char>(fichier), std::istreambuf_iterator<char>());
+    }
+    return melangerChaine(hash, contenu);
+}
 
 /* Méthodes publiques */
 
@@ -81,6 +110,76 @@ void Configuration::lireFichierConfiguration(){
             delta = std::stod(value);
         }else if(key == "T_FINAL"){
             tFinal = std::stod(value);
+        }else if(key == "SORTIES"){
+            sorties = (value == "OUI");
+        }else if(key == "INTERVALLE_JOURNAL"){
+            intervalleJournal = std::stoi(value);
+        }else if(key == "INTERVALLE_JOURNAL_TEMPS"){
+            intervalleJournalTemps = std::stod(value);
+        }else if(key == "INTERVALLE_VTU"){
+            intervalleVTU = std::stoi(value);
+        }else if(key == "INTERVALLE_VTU_TEMPS"){
+            intervalleVTUTemps = std::stod(value);
+        }else if(key == "INTERVALLE_REPRISE"){
+            intervalleReprise = std::stoi(value);
+        }else if(key == "FICHIER_REPRISE"){
+            fichierReprise = value;
+        }else if(key == "TRAJECTOIRE"){
+            trajectoire = (value == "OUI");
+        }else if(key == "TRAJECTOIRE_FORCES"){
+            trajectoireForces = (value == "OUI");
+        }else if(key == "TRAJECTOIRE_COMPRESSION"){
+            trajectoireCompression = (value == "OUI");
+        }else if(key == "TRAJECTOIRE_PRECISION"){
+            trajectoirePrecision = std::stod(value);
+        }else if(key == "TRAJECTOIRE_IMAGES_CLES"){
+            trajectoireImagesCles = std::stoi(value);
+        }else if(key == "JOURNAL_FORMAT"){
+            if(value == "CSV"){
+                formatJournal = FormatJournal::Csv;
+            }else if(value == "BINAIRE"){
+                formatJournal = FormatJournal::Binaire;
+            }else if(value == "AUCUN"){
+                formatJournal = FormatJournal::Aucun;
+            }else{
+                throw std::invalid_argument("Format de journal non valide: " + value);
+            }
+        }else if(key == "JOURNAL_CHAMPS"){
+            champsJournal = value;
+        }else if(key == "JOURNAL_ECHANTILLONNAGE"){
+            echantillonnageJournal = std::stoi(value);
+        }else if(key == "REDUCTION_INTERVALLE"){
+            intervalleReduction = std::stoi(value);
+        }else if(key == "REDUCTION_FACTEUR"){
+            facteurReduction = std::stoi(value);
+        }else if(key == "INTERVALLE_CHRONOMETRAGE"){
+            intervalleChronometrage = std::stoi(value);
+        }else if(key == "COMPTEURS_MATERIELS"){
+            compteursMateriels = (value == "OUI");
+        }else if(key == "TRACE"){
+            trace = (value == "OUI");
+        }else if(key == "TRACE_DEBUT"){
+            traceDebut = std::stoi(value);
+        }else if(key == "TRACE_FIN"){
+            traceFin = std::stoi(value);
+        }else if(key == "MEMOIRE_MAXIMALE"){
+            memoireMaximale = std::stod(value);
+        }else if(key == "GRAINE"){
+            graine = std::stoull(value);
+        }else if(key == "FICHIER_OBSTACLES"){
+            fichierObstacles = value;
+        }else if(key == "FICHIER_SOURCES"){
+            fichierSources = value;
+        }else if(key == "INTERVALLE_COMPACTION"){
+            intervalleCompaction = std::stoi(value);
+        }else if(key == "SUBDIVISION_CELLULES"){
+            subdivisionCellules = std::stoi(value);
+        }else if(key == "DETERMINISTE"){
+            deterministe = (value == "OUI");
+        }else if(key == "DIFFUSION"){
+            diffusion = value;
+        }else if(key == "INTERVALLE_DIFFUSION"){
+            intervalleDiffusion = std::stoi(value);
         }else if(key == "ADRESSE_FICHIER"){
             adresseFichier = value;
         }else if(key == "CONDITION_LIMITE"){
@@ -163,7 +262,80 @@ void Configuration::afficherParametresChoisis(){
         std::cout << "\tG : " << G << "\n";
     }
 
-    std::cout << "\tDelta : " << delta << "\n" << "\ttFinal : " << tFinal << "\n\n";
+    std::cout << "\tDelta : " << delta << "\n" << "\ttFinal : " << tFinal << "\n";
+
+    if(!sorties){
+        std::cout << "\tSorties : désactivées\n";
+    }else{
+        std::cout << "\tIntervalle du journal : ";
+        if(intervalleJournalTemps > 0){
+            std::cout << "temps " << intervalleJournalTemps << "\n";
+        }else{
+            std::cout << intervalleJournal << " itérations\n";
+        }
+        std::cout << "\tIntervalle des fichiers VTU : ";
+        if(intervalleVTUTemps > 0){
+            std::cout << "temps " << intervalleVTUTemps << "\n";
+        }else{
+            std::cout << intervalleVTU << " itérations\n";
+        }
+    }
+    if(intervalleReprise > 0){
+        std::cout << "\tIntervalle des points de reprise : " << intervalleReprise << "\n";
+    }
+    if(!fichierReprise.empty()){
+        std::cout << "\tReprise à partir de : " << fichierReprise << "\n";
+    }
+    if(trajectoire){
+        std::cout << "\tFichier de trajectoire : oui" << (trajectoireForces ? " (avec forces)" : "") << "\n";
+        if(trajectoireCompression){
+            std::cout << "\tCompression de la trajectoire : précision " << trajectoirePrecision
+                      << ", une image clé toutes les " << trajectoireImagesCles << " frames\n";
+        }
+    }
+    if(formatJournal != FormatJournal::Aucun){
+        std::cout << "\tJournal des particules : " << (formatJournal == FormatJournal::Csv ? "CSV" : "binaire")
+                  << " (" << champsJournal << ", une particule sur " << echantillonnageJournal << ")\n";
+    }
+    if(intervalleReduction > 0){
+        std::cout << "\tChamps réduits : toutes les " << intervalleReduction << " itérations, "
+                  << facteurReduction << " cellule(s) par voxel et par direction\n";
+    }
+    if(intervalleChronometrage > 0){
+        std::cout << "\tAffichage des chronomètres : toutes les " << intervalleChronometrage << " itérations\n";
+    }
+    if(compteursMateriels){
+        std::cout << "\tCompteurs matériels : oui\n";
+    }
+    if(trace){
+        std::cout << "\tTrace : itérations " << traceDebut << " à " << (traceFin < 0 ? std::string("la fin") : std::to_string(traceFin)) << "\n";
+    }
+    if(memoireMaximale > 0){
+        std::cout << "\tMémoire maximale : " << memoireMaximale << " Mo\n";
+    }
+    if(graine != 0){
+        std::cout << "\tGraine : " << graine << "\n";
+    }
+    if(!fichierObstacles.empty()){
+        std::cout << "\tObstacles : " << fichierObstacles << "\n";
+    }
+    if(!fichierSources.empty()){
+        std::cout << "\tSources de particules : " << fichierSources << "\n";
+    }
+    if(subdivisionCellules > 1){
+        std::cout << "\tSubdivision des cellules : " << subdivisionCellules << " cellules par rayon de coupure\n";
+    }
+    if(!diffusion.empty()){
+        std::cout << "\tDiffusion en direct : segment " << diffusion << ", toutes les " << intervalleDiffusion << " itérations\n";
+    }
+    if(deterministe){
+        std::cout << "\tMode déterministe : résultats identiques quel que soit le nombre de threads\n";
+    }
+    if(conditionLimite == ConditionLimite::Absorption && intervalleCompaction > 0){
+        std::cout << "\tCompaction des particules absorbées : toutes les " << intervalleCompaction << " itérations\n";
+    }
+
+    std::cout << "\n";
 }
 
 void Configuration::afficherParametresPossibles(){
@@ -185,7 +357,39 @@ void Configuration::afficherParametresPossibles(){
     std::cout << " - SIGMA = Définit la valeur de sigma (défaut : 1.0)\n";
     std::cout << " - G = Définit la valeur de G (défaut : -12)\n";
     std::cout << " - DELTA = Définit la valeur de delta avec laquelle le temps est incrémenté dans la simulation (défaut : 0.00005)\n";
-    std::cout << " - T_FINAL = Définit le temps de fin de la simulation (défaut : 19.5)\n\n";
+    std::cout << " - T_FINAL = Définit le temps de fin de la simulation (défaut : 19.5)\n";
+    std::cout << " - SORTIES = NON pour n'écrire aucun fichier de sortie, par exemple pour mesurer le débit (défaut : OUI)\n";
+    std::cout << " - INTERVALLE_JOURNAL = Définit le nombre d'itérations entre deux écritures du journal, 0 pour le désactiver (défaut : 1000)\n";
+    std::cout << " - INTERVALLE_JOURNAL_TEMPS = Définit le temps simulé entre deux écritures du journal, prioritaire s'il est positif (défaut : 0)\n";
+    std::cout << " - INTERVALLE_VTU = Définit le nombre d'itérations entre deux fichiers VTU ou frames de trajectoire, 0 pour les désactiver (défaut : 1000)\n";
+    std::cout << " - INTERVALLE_VTU_TEMPS = Définit le temps simulé entre deux fichiers VTU ou frames de trajectoire, prioritaire s'il est positif (défaut : 0)\n";
+    std::cout << " - INTERVALLE_REPRISE = Définit le nombre d'itérations entre deux points de reprise, 0 pour les désactiver (défaut : 0)\n";
+    std::cout << " - FICHIER_REPRISE = Définit le point de reprise à partir duquel la simulation redémarre (défaut : aucun)\n";
+    std::cout << " - TRAJECTOIRE = OUI pour écrire les états dans un fichier de trajectoire unique au lieu de fichiers VTU (défaut : NON)\n";
+    std::cout << " - TRAJECTOIRE_FORCES = OUI pour écrire aussi les forces dans le fichier de trajectoire (défaut : NON)\n";
+    std::cout << " - TRAJECTOIRE_COMPRESSION = OUI pour quantifier les frames de la trajectoire et les coder par différence (défaut : NON)\n";
+    std::cout << " - TRAJECTOIRE_PRECISION = Définit le pas de quantification des positions et des vitesses de la trajectoire compressée (défaut : 0.0001)\n";
+    std::cout << " - TRAJECTOIRE_IMAGES_CLES = Définit le nombre de frames entre deux images clés de la trajectoire compressée (défaut : 10)\n";
+    std::cout << " - JOURNAL_FORMAT = Définit le format du journal des particules. 'CSV', 'BINAIRE' ou 'AUCUN' (défaut : CSV)\n";
+    std::cout << " - JOURNAL_CHAMPS = Définit les champs du journal parmi id, categorie, position, vitesse, force et masse (défaut : id,categorie,position,vitesse,masse)\n";
+    std::cout << " - JOURNAL_ECHANTILLONNAGE = Définit le pas d'échantillonnage : seules les particules d'identifiant multiple de ce pas sont écrites (défaut : 1)\n";
+    std::cout << " - REDUCTION_INTERVALLE = Définit le nombre d'itérations entre deux fichiers VTI de champs réduits (densité, vitesse, température), 0 pour les désactiver (défaut : 0)\n";
+    std::cout << " - REDUCTION_FACTEUR = Définit le nombre de cellules par voxel et par direction des champs réduits (défaut : 1)\n";
+    std::cout << " - INTERVALLE_CHRONOMETRAGE = Définit le nombre d'itérations entre deux affichages des chronomètres des phases, 0 pour un affichage en fin de simulation uniquement (défaut : 0)\n";
+    std::cout << " - COMPTEURS_MATERIELS = OUI pour lire les compteurs de performance matériels (cycles, instructions, défauts de cache et de branchement) de chaque phase et de chaque thread (défaut : NON)\n";
+    std::cout << " - TRACE = OUI pour écrire la chronologie des phases, des tâches de chaque thread et des entrées-sorties dans trace.json, lisible dans Perfetto (défaut : NON)\n";
+    std::cout << " - TRACE_DEBUT = Définit la première itération enregistrée dans la trace (défaut : 0)\n";
+    std::cout << " - TRACE_FIN = Définit la dernière itération enregistrée dans la trace, négative pour aller jusqu'à la fin (défaut : 100)\n";
+    std::cout << " - MEMOIRE_MAXIMALE = Définit la mémoire autorisée en Mo : une configuration dont l'estimation la dépasse est refusée avant d'être construite, 0 pour la mémoire physique de la machine (défaut : 0)\n";
+    std::cout << " - GRAINE = Définit la graine des particules aléatoires : un même couple (graine, indice de particule) donne toujours le même tirage, quel que soit le nombre de threads (défaut : 0)\n";
+    std::cout << " - FICHIER_OBSTACLES = Définit le fichier des obstacles statiques (PLAN, SPHERE, BOITE ou CHAMP de distance signée, un par ligne) (défaut : aucun)\n";
+    std::cout << " - FICHIER_SOURCES = Définit le fichier des sources qui injectent des particules sur une face de l'univers (SOURCE face débit vx vy vz [masse [catégorie]], une par ligne) (défaut : aucun)\n";
+    std::cout << " - SUBDIVISION_CELLULES = Définit le nombre k de cellules par rayon de coupure et par direction, de 1 à 4 : des cellules plus petites réduisent le nombre de distances calculées (défaut : 1)\n";
+    std::cout << " - DETERMINISTE = OUI pour obtenir des résultats identiques bit à bit quel que soit le nombre de threads : chaque particule accumule ses forces dans un ordre fixe et l'énergie cinétique est sommée par paires, au prix de deux fois plus de distances calculées (défaut : NON)\n";
+    std::cout << " - DIFFUSION = Définit le nom du segment de mémoire partagée dans lequel l'état des particules est publié en direct, lisible par lire_diffusion (défaut : aucun)\n";
+    std::cout << " - INTERVALLE_DIFFUSION = Définit le nombre d'itérations entre deux frames diffusées (défaut : 100)\n";
+    std::cout << " - INTERVALLE_COMPACTION = Définit le nombre d'itérations entre deux compactions, qui retirent du stockage les particules absorbées, 0 pour aucune (défaut : 1000)\n";
+    std::cout << "\n";
     std::cout << "Entrez la lettre (Y) pour confirmer la simulation. Toute autre entrée terminera l'exécution >> ";
 
     std::string confirmation;
@@ -197,6 +401,24 @@ void Configuration::afficherParametresPossibles(){
 
 }
 
+uint64_t Configuration::calculerHash() const{
+    
+    /* Rassembler les paramètres qui déterminent la dynamique */
+    const double reels[] = {ldX, ldY, ldZ, G, epsilon, sigma, rCutReflexion, rCut, delta, energieDesiree};
+    const int entiers[] = {forceLJ, forceIG, forcePG, limiterVitesse, static_cast<int>(conditionLimite),
+                           subdivisionCellules, deterministe, intervalleCompaction};
+
+    /* Appliquer FNV-1a sur leurs octets, puis sur les fichiers d'obstacles
+    et de sources dont le contenu détermine aussi la dynamique */
+    uint64_t hash = 14695981039346656037ULL;
+    hash = melangerOctets(hash, reels, sizeof(reels));
+    hash = melangerOctets(hash, entiers, sizeof(entiers));
+    hash = melangerOctets(hash, &graine, sizeof(graine));
+    hash = melangerFichier(hash, fichierObstacles);
+    hash = melangerFichier(hash, fichierSources);
+    return hash;
+}
+
 /* getters */
 
 bool Configuration::getForceLJ() const{
@@ -271,6 +493,130 @@ const std::string& Configuration::getNomDossier() const{
     return nomDossier;
 }
 
+bool Configuration::getSorties() const{
+    return sorties;
+}
+
+int Configuration::getIntervalleJournal() const{
+    return intervalleJournal;
+}
+
+double Configuration::getIntervalleJournalTemps() const{
+    return intervalleJournalTemps;
+}
+
+int Configuration::getIntervalleVTU() const{
+    return intervalleVTU;
+}
+
+double Configuration::getIntervalleVTUTemps() const{
+    return intervalleVTUTemps;
+}
+
+int Configuration::getIntervalleReprise() const{
+    return intervalleReprise;
+}
+
+const std::string& Configuration::getFichierReprise() const{
+    return fichierReprise;
+}
+
+bool Configuration::getTrajectoire() const{
+    return trajectoire;
+}
+
+bool Configuration::getTrajectoireForces() const{
+    return trajectoireForces;
+}
+
+bool Configuration::getTrajectoireCompression() const{
+    return trajectoireCompression;
+}
+
+double Configuration::getTrajectoirePrecision() const{
+    return trajectoirePrecision;
+}
+
+int Configuration::getTrajectoireImagesCles() const{
+    return trajectoireImagesCles;
+}
+
+FormatJournal Configuration::getFormatJournal() const{
+    return formatJournal;
+}
+
+const std::string& Configuration::getChampsJournal() const{
+    return champsJournal;
+}
+
+int Configuration::getEchantillonnageJournal() const{
+    return echantillonnageJournal;
+}
+
+int Configuration::getIntervalleReduction() const{
+    return intervalleReduction;
+}
+
+int Configuration::getFacteurReduction() const{
+    return facteurReduction;
+}
+
+int Configuration::getIntervalleChronometrage() const{
+    return intervalleChronometrage;
+}
+
+bool Configuration::getCompteursMateriels() const{
+    return compteursMateriels;
+}
+
+bool Configuration::getTrace() const{
+    return trace;
+}
+
+int Configuration::getTraceDebut() const{
+    return traceDebut;
+}
+
+int Configuration::getTraceFin() const{
+    return traceFin;
+}
+
+double Configuration::getMemoireMaximale() const{
+    return memoireMaximale;
+}
+
+uint64_t Configuration::getGraine() const{
+    return graine;
+}
+
+const std::string& Configuration::getFichierObstacles() const{
+    return fichierObstacles;
+}
+
+const std::string& Configuration::getFichierSources() const{
+    return fichierSources;
+}
+
+int Configuration::getIntervalleCompaction() const{
+    return intervalleCompaction;
+}
+
+int Configuration::getSubdivisionCellules() const{
+    return subdivisionCellules;
+}
+
+bool Configuration::getDeterministe() const{
+    return deterministe;
+}
+
+const std::string& Configuration::getDiffusion() const{
+    return diffusion;
+}
+
+int Configuration::getIntervalleDiffusion() const{
+    return intervalleDiffusion;
+}
+
 /* Setters */
 
 void Configuration::setLd(double newLdX, double newLdY, double newLdZ){
@@ -285,6 +631,11 @@ void Configuration::setForces(bool newForceLJ, bool newForceIG, bool newForcePG)
     forcePG = newForcePG;
 }
 
+void Configuration::setLimiterVitesse(bool newLimiterVitesse, double newEnergieDesiree){
+    limiterVitesse = newLimiterVitesse;
+    energieDesiree = newEnergieDesiree;
+}
+
 void Configuration::setConditionLimite(ConditionLimite newConditionLimite){
     conditionLimite = newConditionLimite;
 }
@@ -304,3 +655,91 @@ void Configuration::setTFinal(double newTFinal){
 void Configuration::setNomDossier(const std::string& newNomDossier){
     nomDossier = newNomDossier;
 }
+
+void Configuration::setSorties(bool newSorties){
+    sorties = newSorties;
+}
+
+void Configuration::setIntervallesSortie(int newIntervalleJournal, double newIntervalleJournalTemps, int newIntervalleVTU, double newIntervalleVTUTemps){
+    intervalleJournal = newIntervalleJournal;
+    intervalleJournalTemps = newIntervalleJournalTemps;
+    intervalleVTU = newIntervalleVTU;
+    intervalleVTUTemps = newIntervalleVTUTemps;
+}
+
+void Configuration::setIntervalleReprise(int newIntervalleReprise){
+    intervalleReprise = newIntervalleReprise;
+}
+
+void Configuration::setFichierReprise(const std::string& newFichierReprise){
+    fichierReprise = newFichierReprise;
+}
+
+void Configuration::setTrajectoire(bool newTrajectoire, bool newTrajectoireForces){
+    trajectoire = newTrajectoire;
+    trajectoireForces = newTrajectoireForces;
+}
+
+void Configuration::setTrajectoireCompression(bool newTrajectoireCompression, double newTrajectoirePrecision, int newTrajectoireImagesCles){
+    trajectoireCompression = newTrajectoireCompression;
+    trajectoirePrecision = newTrajectoirePrecision;
+    trajectoireImagesCles = newTrajectoireImagesCles;
+}
+
+void Configuration::setJournal(FormatJournal newFormatJournal, const std::string& newChampsJournal, int newEchantillonnageJournal){
+    formatJournal = newFormatJournal;
+    champsJournal = newChampsJournal;
+    echantillonnageJournal = newEchantillonnageJournal;
+}
+
+void Configuration::setReduction(int newIntervalleReduction, int newFacteurReduction){
+    intervalleReduction = newIntervalleReduction;
+    facteurReduction = newFacteurReduction;
+}
+
+void Configuration::setIntervalleChronometrage(int newIntervalleChronometrage){
+    intervalleChronometrage = newIntervalleChronometrage;
+}
+
+void Configuration::setCompteursMateriels(bool newCompteursMateriels){
+    compteursMateriels = newCompteursMateriels;
+}
+
+void Configuration::setTrace(bool newTrace, int newTraceDebut, int newTraceFin){
+    trace = newTrace;
+    traceDebut = newTraceDebut;
+    traceFin = newTraceFin;
+}
+
+void Configuration::setMemoireMaximale(double newMemoireMaximale){
+    memoireMaximale = newMemoireMaximale;
+}
+
+void Configuration::setGraine(uint64_t newGraine){
+    graine = newGraine;
+}
+
+void Configuration::setFichierObstacles(const std::string& newFichierObstacles){
+    fichierObstacles = newFichierObstacles;
+}
+
+void Configuration::setFichierSources(const std::string& newFichierSources){
+    fichierSources = newFichierSources;
+}
+
+void Configuration::setIntervalleCompaction(int newIntervalleCompaction){
+    intervalleCompaction = newIntervalleCompaction;
+}
+
+void Configuration::setSubdivisionCellules(int newSubdivisionCellules){
+    subdivisionCellules = newSubdivisionCellules;
+}
+
+void Configuration::setDeterministe(bool newDeterministe){
+    deterministe = newDeterministe;
+}
+
+void Configuration::setDiffusion(const std::string& newDiffusion, int newIntervalleDiffusion){
+    diffusion = newDiffusion;
+    intervalleDiffusion = newIntervalleDiffusion;
+}
@@ -0,0 +1,225 @@
+#include "diffusion.hxx"
+#include <cstring>
+#include <new>
+#include <stdexcept>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+static_assert(std::atomic<uint64_t>::is_always_lock_free, "Le verrou de séquence partagé requiert des atomiques sans verrou");
+
+/* Format du segment : en-tête, puis emplacements alignés sur 64 octets
+contenant chacun un en-tête et les colonnes ids, positions, vitesses et masses */
+static const char magieDiffusion[8] = {'D', 'I', 'F', 'F', 'U', 'S', 'I', 'O'};
+static const uint32_t versionDiffusion = 1;
+static const size_t alignement = 64;
+
+static size_t arrondir(size_t octets){
+    return (octets + alignement - 1) / alignement * alignement;
+}
+
+static std::string nomSegment(const std::string& nom){
+    return nom.empty() || nom[0] != '/' ? "/" + nom : nom;
+}
+
+static size_t tailleEmplacement(uint64_t capacite){
+    return arrondir(arrondir(sizeof(EnteteEmplacement)) + capacite * (sizeof(int64_t) + 7*sizeof(float)));
+}
+
+static size_t debutEmplacement(uint64_t numero, const EnteteDiffusion& entete){
+    return arrondir(sizeof(EnteteDiffusion)) + (numero - 1) % entete.nombreEmplacements * entete.tailleEmplacement;
+}
+
+static void copierVecteur(float* destination, const Vecteur<double>& vecteur){
+    destination[0] = static_cast<float>(vecteur.getX());
+    destination[1] = static_cast<float>(vecteur.getY());
+    destination[2] = static_cast<float>(vecteur.getZ());
+}
+
+/* Constructeur */
+
+DiffusionEtat::DiffusionEtat(const std::string& nom, const Vecteur<double>& ld, uint64_t capacite, uint32_t nombreEmplacements) :
+    nom(nomSegment(nom)), donnees(nullptr), taille(0), numero(0){
+    if(capacite == 0 || nombreEmplacements == 0){
+        throw std::invalid_argument("Capacité ou nombre d'emplacements de la diffusion nul");
+    }
+
+    /* Créer le segment, en remplaçant celui d'une exécution interrompue */
+    int descripteur = shm_open(this->nom.c_str(), O_CREAT | O_RDWR | O_TRUNC, 0600);
+    if(descripteur < 0){
+        throw std::runtime_error("Erreur lors de la création du segment de diffusion " + this->nom);
+    }
+    taille = arrondir(sizeof(EnteteDiffusion)) + nombreEmplacements * tailleEmplacement(capacite);
+    void* projection = MAP_FAILED;
+    if(ftruncate(descripteur, taille) == 0){
+        projection = mmap(nullptr, taille, PROT_READ | PROT_WRITE, MAP_SHARED, descripteur, 0);
+    }
+    close(descripteur);
+    if(projection == MAP_FAILED){
+        shm_unlink(this->nom.c_str());
+        throw std::runtime_error("Erreur lors de la projection du segment de diffusion " + this->nom);
+    }
+    donnees = static_cast<char*>(projection);
+
+    /* Le segment est rempli de zéros : écrire l'en-tête, le nombre magique en dernier */
+    EnteteDiffusion* entete = new(donnees) EnteteDiffusion;
+    entete->version = versionDiffusion;
+    entete->nombreEmplacements = nombreEmplacements;
+    entete->capacite = capacite;
+    entete->tailleEmplacement = tailleEmplacement(capacite);
+    entete->ld[0] = ld.getX();
+    entete->ld[1] = ld.getY();
+    entete->ld[2] = ld.getZ();
+    entete->derniereFrame.store(0, std::memory_order_relaxed);
+    entete->terminee.store(0, std::memory_order_relaxed);
+    for(uint32_t e = 0; e < nombreEmplacements; e++){
+        new(donnees + debutEmplacement(e + 1, *entete)) EnteteEmplacement{};
+    }
+    std::atomic_thread_fence(std::memory_order_release);
+    std::memcpy(entete->magie, magieDiffusion, sizeof(magieDiffusion));
+}
+
+DiffusionEtat::~DiffusionEtat(){
+    reinterpret_cast<EnteteDiffusion*>(donnees)->terminee.store(1, std::memory_order_release);
+    munmap(donnees, taille);
+    shm_unlink(nom.c_str());
+}
+
+/* Méthodes publiques */
+
+void DiffusionEtat::publier(const Univers& univers, int64_t iteration, double temps){
+    EnteteDiffusion& entete = *reinterpret_cast<EnteteDiffusion*>(donnees);
+    numero++;
+    char* emplacement = donnees + debutEmplacement(numero, entete);
+    EnteteEmplacement& enteteEmplacement = *reinterpret_cast<EnteteEmplacement*>(emplacement);
+
+    /* Rendre la séquence impaire avant toute écriture des colonnes */
+    const uint64_t sequence = enteteEmplacement.sequence.load(std::memory_order_relaxed);
+    enteteEmplacement.sequence.store(sequence + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+
+    const uint64_t capacite = entete.capacite;
+    int64_t* ids = reinterpret_cast<int64_t*>(emplacement + arrondir(sizeof(EnteteEmplacement)));
+    float* positions = reinterpret_cast<float*>(ids + capacite);
+    float* vitesses = positions + 3*capacite;
+    float* masses = vitesses + 3*capacite;
+    const Vecteur<double> centre = univers.getLd() / 2;
+    uint64_t k = 0;
+    for(const auto& cellule : univers.getGrille()){
+        for(const auto particule : cellule.getParticules()){
+            if(k == capacite){
+                break;
+            }
+            ids[k] = particule->getId();
+            copierVecteur(positions + 3*k, particule->getPosition() - centre);
+            copierVecteur(vitesses + 3*k, particule->getVitesse());
+            masses[k] = particule->getMasse();
+            k++;
+        }
+    }
+    enteteEmplacement.numero = numero;
+    enteteEmplacement.iteration = iteration;
+    enteteEmplacement.temps = temps;
+    enteteEmplacement.nombreParticules = k;
+    enteteEmplacement.nombreTotal = univers.getNombreParticules();
+
+    /* Rendre la séquence paire, puis annoncer la frame */
+    enteteEmplacement.sequence.store(sequence + 2, std::memory_order_release);
+    entete.derniereFrame.store(numero, std::memory_order_release);
+}
+
+/* Getters */
+
+const std::string& DiffusionEtat::getNom() const{
+    return nom;
+}
+
+size_t DiffusionEtat::getOctets() const{
+    return taille;
+}
+
+/* Constructeur */
+
+LecteurDiffusion::LecteurDiffusion(const std::string& nom) : donnees(nullptr), taille(0){
+    std::string segment = nomSegment(nom);
+    int descripteur = shm_open(segment.c_str(), O_RDONLY, 0);
+    if(descripteur < 0){
+        throw std::runtime_error("Segment de diffusion " + segment + " introuvable");
+    }
+    struct stat info;
+    if(fstat(descripteur, &info) != 0 || static_cast<size_t>(info.st_size) < arrondir(sizeof(EnteteDiffusion))){
+        close(descripteur);
+        throw std::invalid_argument("Le segment " + segment + " n'est pas un segment de diffusion");
+    }
+    taille = info.st_size;
+    void* projection = mmap(nullptr, taille, PROT_READ, MAP_SHARED, descripteur, 0);
+    close(descripteur);
+    if(projection == MAP_FAILED){
+        throw std::runtime_error("Erreur lors de la projection du segment de diffusion " + segment);
+    }
+    donnees = static_cast<const char*>(projection);
+
+    /* Vérifier l'en-tête et la taille annoncée */
+    const EnteteDiffusion& entete = getEntete();
+    if(std::memcmp(entete.magie, magieDiffusion, sizeof(magieDiffusion)) != 0 || entete.version != versionDiffusion ||
+       entete.nombreEmplacements == 0 || entete.tailleEmplacement != tailleEmplacement(entete.capacite) ||
+       taille < arrondir(sizeof(EnteteDiffusion)) + entete.nombreEmplacements * entete.tailleEmplacement){
+        munmap(const_cast<char*>(donnees), taille);
+        throw std::invalid_argument("Le segment " + segment + " n'est pas un segment de diffusion compatible");
+    }
+}
+
+LecteurDiffusion::~LecteurDiffusion(){
+    munmap(const_cast<char*>(donnees), taille);
+}
+
+/* Méthodes publiques */
+
+bool LecteurDiffusion::lireDerniereFrame(FrameDiffusion& frame) const{
+    const EnteteDiffusion& entete = getEntete();
+    const uint64_t numero = entete.derniereFrame.load(std::memory_order_acquire);
+    if(numero == 0){
+        return false;
+    }
+    const char* emplacement = donnees + debutEmplacement(numero, entete);
+    const EnteteEmplacement& enteteEmplacement = *reinterpret_cast<const EnteteEmplacement*>(emplacement);
+    const uint64_t sequence = enteteEmplacement.sequence.load(std::memory_order_acquire);
+    if(sequence % 2 == 1){
+        return false;
+    }
+
+    frame.sequence = sequence;
+    frame.numero = numero;
+    frame.iteration = enteteEmplacement.iteration;
+    frame.temps = enteteEmplacement.temps;
+    frame.nombreParticules = enteteEmplacement.nombreParticules;
+    frame.nombreTotal = enteteEmplacement.nombreTotal;
+    const uint64_t capacite = entete.capacite;
+    frame.ids = reinterpret_cast<const int64_t*>(emplacement + arrondir(sizeof(EnteteEmplacement)));
+    frame.positions = reinterpret_cast<const float*>(frame.ids + capacite);
+    frame.vitesses = frame.positions + 3*capacite;
+    frame.masses = frame.vitesses + 3*capacite;
+
+    /* L'emplacement a pu être réécrit par une frame plus récente entre-temps */
+    return enteteEmplacement.numero == numero && frame.nombreParticules <= capacite && estValide(frame);
+}
+
+bool LecteurDiffusion::estValide(const FrameDiffusion& frame) const{
+    if(frame.numero == 0){
+        return false;
+    }
+    const EnteteEmplacement& enteteEmplacement = *reinterpret_cast<const EnteteEmplacement*>(donnees + debutEmplacement(frame.numero, getEntete()));
+    std::atomic_thread_fence(std::memory_order_acquire);
+    return enteteEmplacement.sequence.load(std::memory_order_relaxed) == frame.sequence;
+}
+
+/* Getters */
+
+const EnteteDiffusion& LecteurDiffusion::getEntete() const{
+    return *reinterpret_cast<const EnteteDiffusion*>(donnees);
+}
+
+bool LecteurDiffusion::estTerminee() const{
+    return getEntete().terminee.load(std::memory_order_acquire) == 1;
+}
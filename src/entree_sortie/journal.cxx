@@ -0,0 +1,298 @@
+#include "journal.hxx"
+#include <charconv>
+#include <cstring>
+#include <unistd.h>
+#include "memoire.hxx"
+
+static const char magieJournal[8] = {'S', 'I', 'M', 'J', 'R', 'N', 'L', '\0'};
+static const uint32_t versionJournal = 1;
+
+/* Plus grande longueur d'un nombre formaté par std::to_chars, séparateur compris */
+static const size_t longueurNombre = 32;
+
+/* Taille de l'en-tête du journal binaire : magie, version et champs */
+static const size_t tailleEnteteBinaire = sizeof(magieJournal) + 2*sizeof(uint32_t);
+
+uint32_t lireChampsJournal(const std::string& liste){
+    uint32_t champs = 0;
+    std::stringstream flux(liste);
+    std::string champ;
+    while(std::getline(flux, champ, ',')){
+        champ.erase(0, champ.find_first_not_of(" \t"));
+        champ.erase(champ.find_last_not_of(" \t") + 1);
+        if(champ == "id"){
+            champs |= JOURNAL_ID;
+        }else if(champ == "categorie"){
+            champs |= JOURNAL_CATEGORIE;
+        }else if(champ == "position"){
+            champs |= JOURNAL_POSITION;
+        }else if(champ == "vitesse"){
+            champs |= JOURNAL_VITESSE;
+        }else if(champ == "force"){
+            champs |= JOURNAL_FORCE;
+        }else if(champ == "masse"){
+            champs |= JOURNAL_MASSE;
+        }else if(!champ.empty()){
+            throw std::invalid_argument("Champ de journal inconnu '" + champ + "'");
+        }
+    }
+    return champs;
+}
+
+/* Constructeur */
+
+JournalParticules::JournalParticules(const std::string& adresseFichier, FormatJournal format, uint32_t champs, int echantillonnage, int64_t iterationReprise, size_t tailleTampon) :
+    format(format), champs(champs), echantillonnage(echantillonnage), tampon(std::max<size_t>(tailleTampon, 1024)), utilise(0){
+
+    if(format == FormatJournal::Aucun){
+        throw std::invalid_argument("Format de journal non valide");
+    }
+    if(echantillonnage < 1){
+        throw std::invalid_argument("Le pas d'échantillonnage du journal doit être positif");
+    }
+
+    /* La catégorie, de longueur variable, n'est écrite qu'en CSV */
+    if(format == FormatJournal::Binaire){
+        this->champs &= ~static_cast<uint32_t>(JOURNAL_CATEGORIE);
+    }
+
+    /* En reprise, conserver les lignes antérieures du fichier existant */
+    struct stat info;
+    if(iterationReprise >= 0 && stat(adresseFichier.c_str(), &info) == 0){
+        uint64_t fin = chercherFinReprise(adresseFichier, iterationReprise);
+        if(truncate(adresseFichier.c_str(), fin) != 0){
+            throw std::runtime_error("Erreur lors de la troncature du journal " + adresseFichier);
+        }
+        fichier = ouvrirFichierDeSortie(adresseFichier, true);
+        if(fin == 0){
+            ecrireEntete();
+        }
+        return;
+    }
+
+    fichier = ouvrirFichierDeSortie(adresseFichier);
+    ecrireEntete();
+}
+
+JournalParticules::~JournalParticules(){
+    try{
+        vider();
+    }catch(const std::exception& e){
+        std::cerr << "Erreur : " << e.what() << std::endl;
+    }
+}
+
+/* Méthodes publiques */
+
+void JournalParticules::ecrire(const Univers& univers, int64_t iteration, double temps){
+    const Vecteur<double> centre = univers.getLd() / 2;
+
+    for(const auto& cellule : univers.getGrille()){
+        for(const auto particule : cellule.getParticules()){
+            if(particule->getId() % echantillonnage != 0){
+                continue;
+            }
+            const Vecteur<double> position = particule->getPosition() - centre;
+            const Vecteur<double>& vitesse = particule->getVitesse();
+            const Vecteur<double>& force = particule->getForce();
+
+            if(format == FormatJournal::Csv){
+                ajouterTexte(iteration, ',');
+                ajouterTexte(temps, ',');
+                if(champs & JOURNAL_ID){
+                    ajouterTexte(static_cast<int64_t>(particule->getId()), ',');
+                }
+                if(champs & JOURNAL_CATEGORIE){
+                    const std::string& categorie = particule->getCategorie();
+                    char* libre = reserver(categorie.size() + 1);
+                    std::memcpy(libre, categorie.data(), categorie.size());
+                    libre[categorie.size()] = ',';
+                    utilise += categorie.size() + 1;
+                }
+                if(champs & JOURNAL_POSITION){
+                    ajouterTexte(position.getX(), ',');
+                    ajouterTexte(position.getY(), ',');
+                    ajouterTexte(position.getZ(), ',');
+                }
+                if(champs & JOURNAL_VITESSE){
+                    ajouterTexte(vitesse.getX(), ',');
+                    ajouterTexte(vitesse.getY(), ',');
+                    ajouterTexte(vitesse.getZ(), ',');
+                }
+                if(champs & JOURNAL_FORCE){
+                    ajouterTexte(force.getX(), ',');
+                    ajouterTexte(force.getY(), ',');
+                    ajouterTexte(force.getZ(), ',');
+                }
+                if(champs & JOURNAL_MASSE){
+                    ajouterTexte(particule->getMasse(), ',');
+                }
+                /* Remplacer le dernier séparateur par une fin de ligne */
+                tampon[utilise - 1] = '\n';
+            }else{
+                reserver(getTailleEnregistrement());
+                ajouterBinaire(iteration);
+                ajouterBinaire(temps);
+                if(champs & JOURNAL_ID){
+                    ajouterBinaire(static_cast<int64_t>(particule->getId()));
+                }
+                if(champs & JOURNAL_POSITION){
+                    ajouterBinaire(position.getX());
+                    ajouterBinaire(position.getY());
+                    ajouterBinaire(position.getZ());
+                }
+                if(champs & JOURNAL_VITESSE){
+                    ajouterBinaire(vitesse.getX());
+                    ajouterBinaire(vitesse.getY());
+                    ajouterBinaire(vitesse.getZ());
+                }
+                if(champs & JOURNAL_FORCE){
+                    ajouterBinaire(force.getX());
+                    ajouterBinaire(force.getY());
+                    ajouterBinaire(force.getZ());
+                }
+                if(champs & JOURNAL_MASSE){
+                    ajouterBinaire(particule->getMasse());
+                }
+            }
+        }
+    }
+}
+
+void JournalParticules::vider(){
+    if(utilise > 0){
+        fichier.write(tampon.data(), utilise);
+        utilise = 0;
+    }
+    fichier.flush();
+    if(!fichier){
+        throw std::runtime_error("Erreur lors de l'écriture du journal des particules");
+    }
+}
+
+size_t JournalParticules::getTailleEnregistrement() const{
+    size_t taille = sizeof(int64_t) + sizeof(double);
+    if(champs & JOURNAL_ID){
+        taille += sizeof(int64_t);
+    }
+    if(champs & JOURNAL_POSITION){
+        taille += 3*sizeof(double);
+    }
+    if(champs & JOURNAL_VITESSE){
+        taille += 3*sizeof(double);
+    }
+    if(champs & JOURNAL_FORCE){
+        taille += 3*sizeof(double);
+    }
+    if(champs & JOURNAL_MASSE){
+        taille += sizeof(double);
+    }
+    return taille;
+}
+
+size_t JournalParticules::getOctets() const{
+    return octetsConteneur(tampon);
+}
+
+/* Méthodes privées */
+
+char* JournalParticules::reserver(size_t n){
+    if(utilise + n > tampon.size()){
+        fichier.write(tampon.data(), utilise);
+        utilise = 0;
+        if(n > tampon.size()){
+            tampon.resize(n);
+        }
+    }
+    return tampon.data() + utilise;
+}
+
+void JournalParticules::ajouterTexte(double valeur, char separateur){
+    char* libre = reserver(longueurNombre);
+    std::to_chars_result resultat = std::to_chars(libre, libre + longueurNombre - 1, valeur);
+    *resultat.ptr = separateur;
+    utilise += resultat.ptr + 1 - libre;
+}
+
+void JournalParticules::ajouterTexte(int64_t valeur, char separateur){
+    char* libre = reserver(longueurNombre);
+    std::to_chars_result resultat = std::to_chars(libre, libre + longueurNombre - 1, valeur);
+    *resultat.ptr = separateur;
+    utilise += resultat.ptr + 1 - libre;
+}
+
+template <typename T>
+void JournalParticules::ajouterBinaire(const T& valeur){
+    std::memcpy(tampon.data() + utilise, &valeur, sizeof(T));
+    utilise += sizeof(T);
+}
+
+uint64_t JournalParticules::chercherFinReprise(const std::string& adresseFichier, int64_t iterationReprise) const{
+    std::ifstream existant = ouvrirFichierDEntree(adresseFichier);
+
+    if(format == FormatJournal::Csv){
+        /* Chaque ligne complète se termine par un saut de ligne et commence par l'itération */
+        std::string ligne;
+        if(!std::getline(existant, ligne) || existant.eof()){
+            return 0;
+        }
+        uint64_t fin = ligne.size() + 1;
+        while(std::getline(existant, ligne) && !existant.eof()){
+            int64_t iteration;
+            std::from_chars_result resultat = std::from_chars(ligne.data(), ligne.data() + ligne.size(), iteration);
+            if(resultat.ec != std::errc() || iteration >= iterationReprise){
+                break;
+            }
+            fin += ligne.size() + 1;
+        }
+        return fin;
+    }
+
+    /* En binaire, les enregistrements ont une taille fixe et commencent par l'itération */
+    const uint64_t taille = getTailleEnregistrement();
+    char entete[tailleEnteteBinaire];
+    if(!existant.read(entete, sizeof(entete))){
+        return 0;
+    }
+    uint64_t fin = tailleEnteteBinaire;
+    std::vector<char> enregistrement(taille);
+    while(existant.read(enregistrement.data(), taille)){
+        int64_t iteration;
+        std::memcpy(&iteration, enregistrement.data(), sizeof(iteration));
+        if(iteration >= iterationReprise){
+            break;
+        }
+        fin += taille;
+    }
+    return fin;
+}
+
+void JournalParticules::ecrireEntete(){
+    if(format == FormatJournal::Csv){
+        std::string entete = "iteration,temps";
+        if(champs & JOURNAL_ID){
+            entete += ",id";
+        }
+        if(champs & JOURNAL_CATEGORIE){
+            entete += ",categorie";
+        }
+        if(champs & JOURNAL_POSITION){
+            entete += ",x,y,z";
+        }
+        if(champs & JOURNAL_VITESSE){
+            entete += ",vx,vy,vz";
+        }
+        if(champs & JOURNAL_FORCE){
+            entete += ",fx,fy,fz";
+        }
+        if(champs & JOURNAL_MASSE){
+            entete += ",masse";
+        }
+        entete += "\n";
+        fichier.write(entete.data(), entete.size());
+    }else{
+        fichier.write(magieJournal, sizeof(magieJournal));
+        fichier.write(reinterpret_cast<const char*>(&versionJournal), sizeof(versionJournal));
+        fichier.write(reinterpret_cast<const char*>(&champs), sizeof(champs));
+    }
+}
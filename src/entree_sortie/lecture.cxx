@@ -1,96 +1,435 @@
 #include "lecture.hxx"
 
+/**
+* @brief
+* Structure décrivant un élément DataArray du fichier VTU.
+*/
+
+struct TableauVTU{
+    std::string nom; /**< Nom du tableau (attribut Name ou name). */
+    std::string type; /**< Type VTK des valeurs (Float32, Float64, Int32, ...). */
+    std::string format; /**< Format des données : ascii, binary ou appended. */
+    int nombreComposantes = 1; /**< Nombre de composantes par point. */
+    size_t decalage = 0; /**< Décalage des données dans la section AppendedData. */
+    size_t debutContenu = 0; /**< Position du début du contenu en ligne. */
+    size_t finContenu = 0; /**< Position de la fin du contenu en ligne. */
+    bool dansPoints = false; /**< Indique si le tableau appartient à l'élément Points. */
+};
+
+/**
+* @brief
+* Structure regroupant les propriétés du fichier VTU
+* nécessaires au décodage des données binaires.
+*/
+
+struct ContexteVTU{
+    bool inverser = false; /**< Indique si l'ordre des octets du fichier diffère de celui de la machine. */
+    size_t tailleEntete = 4; /**< Taille en octets des entiers d'en-tête (UInt32 ou UInt64). */
+    bool compresse = false; /**< Indique si les données sont compressées avec zlib. */
+    bool ajouteesEnBase64 = false; /**< Indique si la section AppendedData est encodée en base64. */
+    size_t debutAjoutees = std::string::npos; /**< Position du premier octet des données ajoutées. */
+    size_t finAjoutees = std::string::npos; /**< Position de la fin des données ajoutées. */
+    std::vector<size_t> decalages; /**< Décalages triés de tous les tableaux ajoutés. */
+};
+
+/* Lire la valeur d'un attribut dans une balise XML */
+static std::string lireAttribut(const std::string& balise, const std::string& nom){
+    size_t position = 0;
+    while((position = balise.find(nom + "=\"", position)) != std::string::npos){
+        if(position > 0 && std::isspace(static_cast<unsigned char>(balise[position - 1]))){
+            size_t debut = position + nom.size() + 2;
+            size_t fin = balise.find("\"", debut);
+            if(fin == std::string::npos){
+                throw std::invalid_argument("Attribut " + nom + " mal défini");
+            }
+            return balise.substr(debut, fin - debut);
+        }
+        position += nom.size();
+    }
+    return "";
+}
+
+/* Extraire la balise ouvrante commençant à une position donnée */
+static std::string lireBalise(const std::string& contenu, size_t debut, size_t& fin){
+    fin = contenu.find('>', debut);
+    if(fin == std::string::npos){
+        throw std::invalid_argument("Balise XML non fermée");
+    }
+    return contenu.substr(debut, fin - debut + 1);
+}
+
+/* Lire un entier d'en-tête du format binaire VTK */
+static uint64_t lireEntierEntete(const unsigned char* octets, const ContexteVTU& contexte){
+    unsigned char tampon[8] = {0};
+    std::copy(octets, octets + contexte.tailleEntete, tampon);
+    if(contexte.inverser){
+        inverserOctets(tampon, contexte.tailleEntete, contexte.tailleEntete);
+    }
+    if(contexte.tailleEntete == 8){
+        uint64_t valeur;
+        std::memcpy(&valeur, tampon, 8);
+        return valeur;
+    }
+    uint32_t valeur;
+    std::memcpy(&valeur, tampon, 4);
+    return valeur;
+}
+
+/* Extraire les octets d'un tableau binaire à partir de son en-tête */
+static std::vector<unsigned char> extraireOctets(const unsigned char* bloc, size_t taille, const ContexteVTU& contexte){
+    size_t tete = contexte.tailleEntete;
+    if(taille < tete){
+        throw std::invalid_argument("En-tête binaire tronqué");
+    }
+
+    /* Données non compressées : un entier donnant le nombre d'octets */
+    if(!contexte.compresse){
+        uint64_t nombreOctets = lireEntierEntete(bloc, contexte);
+        if(tete + nombreOctets > taille){
+            throw std::invalid_argument("Données binaires tronquées");
+        }
+        return std::vector<unsigned char>(bloc + tete, bloc + tete + nombreOctets);
+    }
+
+    /* Données compressées : [nombre de blocs, taille d'un bloc, taille du dernier bloc, tailles compressées...] */
+    uint64_t nombreBlocs = lireEntierEntete(bloc, contexte);
+    uint64_t tailleBloc = lireEntierEntete(bloc + tete, contexte);
+    uint64_t tailleDernierBloc = lireEntierEntete(bloc + 2*tete, contexte);
+    size_t position = (3 + nombreBlocs) * tete;
+    if(position > taille){
+        throw std::invalid_argument("En-tête de compression tronqué");
+    }
+
+    std::vector<unsigned char> octets;
+    for(uint64_t k = 0; k < nombreBlocs; k++){
+        uint64_t tailleCompressee = lireEntierEntete(bloc + (3 + k) * tete, contexte);
+        uint64_t tailleDecompressee = (k == nombreBlocs - 1 && tailleDernierBloc != 0) ? tailleDernierBloc : tailleBloc;
+        if(position + tailleCompressee > taille){
+            throw std::invalid_argument("Bloc compressé tronqué");
+        }
+        std::vector<unsigned char> decompresse = decompresserZlib(bloc + position, tailleCompressee, tailleDecompressee);
+        octets.insert(octets.end(), decompresse.begin(), decompresse.end());
+        position += tailleCompressee;
+    }
+    return octets;
+}
+
+/* Convertir des octets bruts d'un type donné en valeurs réelles ou entières */
+template <typename T, typename V>
+static void convertirOctets(std::vector<unsigned char>& octets, bool inverser, std::vector<V>& valeurs){
+    if(inverser){
+        inverserOctets(octets.data(), octets.size(), sizeof(T));
+    }
+    size_t nombre = octets.size() / sizeof(T);
+    valeurs.resize(nombre);
+    for(size_t i = 0; i < nombre; i++){
+        T valeur;
+        std::memcpy(&valeur, octets.data() + i*sizeof(T), sizeof(T));
+        valeurs[i] = static_cast<V>(valeur);
+    }
+}
+
+/* Lire une valeur au format texte : les tableaux entiers lus en entiers
+ne passent pas par un double, qui arrondirait les valeurs au-delà de 2^53 */
+template <typename V>
+static V lireValeurTexte(const char* curseur, char** suivant, const std::string& type){
+    if(std::is_integral<V>::value && type.find("Int") != std::string::npos){
+        if(type[0] == 'U'){
+            return static_cast<V>(std::strtoull(curseur, suivant, 10));
+        }
+        return static_cast<V>(std::strtoll(curseur, suivant, 10));
+    }
+    return static_cast<V>(std::strtod(curseur, suivant));
+}
+
+/* Décoder les valeurs d'un tableau du fichier VTU */
+template <typename V>
+static std::vector<V> lireTableau(const std::string& contenu, const TableauVTU& tableau,
+                                  const ContexteVTU& contexte, size_t nombreValeurs){
+    std::vector<V> valeurs;
+
+    /* Lire les valeurs au format texte */
+    if(tableau.format == "ascii"){
+        valeurs.reserve(nombreValeurs);
+        const char* curseur = contenu.c_str() + tableau.debutContenu;
+        const char* fin = contenu.c_str() + tableau.finContenu;
+        while(valeurs.size() < nombreValeurs && curseur < fin){
+            char* suivant;
+            V valeur = lireValeurTexte<V>(curseur, &suivant, tableau.type);
+            if(suivant == curseur || suivant > fin){
+                break;
+            }
+            valeurs.push_back(valeur);
+            curseur = suivant;
+        }
+        return valeurs;
+    }
+
+    /* Localiser les octets du tableau */
+    std::vector<unsigned char> octets;
+    if(tableau.format == "binary"){
+        std::vector<unsigned char> decodes = decoderBase64(contenu.c_str() + tableau.debutContenu, tableau.finContenu - tableau.debutContenu);
+        octets = extraireOctets(decodes.data(), decodes.size(), contexte);
+    }else if(tableau.format == "appended"){
+        if(contexte.debutAjoutees == std::string::npos){
+            throw std::invalid_argument("Section AppendedData absente pour le tableau " + tableau.nom);
+        }
+        size_t debut = contexte.debutAjoutees + tableau.decalage;
+        if(debut > contexte.finAjoutees){
+            throw std::invalid_argument("Décalage hors de la section AppendedData pour le tableau " + tableau.nom);
+        }
+        if(contexte.ajouteesEnBase64){
+            /* Le tableau s'étend jusqu'au décalage suivant */
+            size_t fin = contexte.finAjoutees;
+            auto suivant = std::upper_bound(contexte.decalages.begin(), contexte.decalages.end(), tableau.decalage);
+            if(suivant != contexte.decalages.end()){
+                fin = std::min(fin, contexte.debutAjoutees + *suivant);
+            }
+            std::vector<unsigned char> decodes = decoderBase64(contenu.c_str() + debut, fin - debut);
+            octets = extraireOctets(decodes.data(), decodes.size(), contexte);
+        }else{
+            const unsigned char* bloc = reinterpret_cast<const unsigned char*>(contenu.c_str()) + debut;
+            octets = extraireOctets(bloc, contexte.finAjoutees - debut, contexte);
+        }
+    }else{
+        throw std::invalid_argument("Format de tableau non supporté : " + tableau.format);
+    }
+
+    /* Convertir les octets selon le type */
+    const std::string& type = tableau.type;
+    if(type == "Float32"){
+        convertirOctets<float, V>(octets, contexte.inverser, valeurs);
+    }else if(type == "Float64"){
+        convertirOctets<double, V>(octets, contexte.inverser, valeurs);
+    }else if(type == "Int8"){
+        convertirOctets<int8_t, V>(octets, contexte.inverser, valeurs);
+    }else if(type == "UInt8"){
+        convertirOctets<uint8_t, V>(octets, contexte.inverser, valeurs);
+    }else if(type == "Int16"){
+        convertirOctets<int16_t, V>(octets, contexte.inverser, valeurs);
+    }else if(type == "UInt16"){
+        convertirOctets<uint16_t, V>(octets, contexte.inverser, valeurs);
+    }else if(type == "Int32"){
+        convertirOctets<int32_t, V>(octets, contexte.inverser, valeurs);
+    }else if(type == "UInt32"){
+        convertirOctets<uint32_t, V>(octets, contexte.inverser, valeurs);
+    }else if(type == "Int64"){
+        convertirOctets<int64_t, V>(octets, contexte.inverser, valeurs);
+    }else if(type == "UInt64"){
+        convertirOctets<uint64_t, V>(octets, contexte.inverser, valeurs);
+    }else{
+        throw std::invalid_argument("Type de tableau non supporté : " + type);
+    }
+
+    return valeurs;
+}
+
+/* Chercher un tableau de données ponctuelles parmi plusieurs noms possibles */
+static const TableauVTU* chercherTableau(const std::vector<TableauVTU>& tableaux, std::initializer_list<const char*> noms){
+    for(const auto& tableau : tableaux){
+        if(tableau.dansPoints){
+            continue;
+        }
+        for(const char* nom : noms){
+            if(tableau.nom == nom){
+                return &tableau;
+            }
+        }
+    }
+    return nullptr;
+}
+
 void lectureDuFichier(const std::string& adresseFichier, Univers& univers){
-    
-    /* Créer un vecteur pour stocker les particules */
-    std::vector<Particule> particules;
-    unsigned long nombreParticules = -1;
 
-    /* Ouvrir le fichier de lecture */
+    /* Ouvrir le fichier de lecture et charger son contenu */
     std::ifstream fichier = ouvrirFichierDEntree(adresseFichier);
-    std::string line;
+    fichier.seekg(0, std::ios::end);
+    std::string contenu(static_cast<size_t>(fichier.tellg()), '\0');
+    fichier.seekg(0, std::ios::beg);
+    fichier.read(&contenu[0], contenu.size());
+    fichier.close();
 
-    /* Lire le nombre de particules dans le fichier */
-    while(std::getline(fichier, line)){
-        if(line.find("NumberOfPoints=") != std::string::npos){
-            size_t quote_start = line.find("\""); 
-            size_t quote_end = line.find("\"", quote_start + 1); 
-            if(quote_start == std::string::npos || quote_end == std::string::npos){
-                throw std::invalid_argument("Nombre de points mal définis");
-            }
-    
-            std::string substr = line.substr(quote_start + 1, quote_end - quote_start - 1);
-            nombreParticules = std::stoi(substr);
-            break;
+    /* Limiter l'analyse XML à la partie qui précède les données ajoutées */
+    size_t positionAjoutees = contenu.find("<AppendedData");
+    size_t finXML = (positionAjoutees == std::string::npos) ? contenu.size() : positionAjoutees;
+
+    /* Lire l'ordre des octets, le type d'en-tête et le compresseur */
+    ContexteVTU contexte;
+    size_t positionFichier = contenu.find("<VTKFile");
+    if(positionFichier != std::string::npos && positionFichier < finXML){
+        size_t fin;
+        std::string balise = lireBalise(contenu, positionFichier, fin);
+
+        std::string ordreOctets = lireAttribut(balise, "byte_order");
+        if(!ordreOctets.empty()){
+            contexte.inverser = (ordreOctets == "LittleEndian") != estPetitBoutiste();
+        }
+
+        std::string typeEntete = lireAttribut(balise, "header_type");
+        if(typeEntete == "UInt64"){
+            contexte.tailleEntete = 8;
+        }else if(!typeEntete.empty() && typeEntete != "UInt32"){
+            throw std::invalid_argument("Type d'en-tête non supporté : " + typeEntete);
+        }
+
+        std::string compresseur = lireAttribut(balise, "compressor");
+        if(compresseur == "vtkZLibDataCompressor"){
+            contexte.compresse = true;
+        }else if(!compresseur.empty()){
+            throw std::invalid_argument("Compresseur non supporté : " + compresseur);
         }
     }
 
-    /* Vérifier la lecture du nombre de particules */
-    if(nombreParticules == static_cast<unsigned long>(-1)){
+    /* Lire le nombre de particules dans le fichier */
+    size_t positionPiece = contenu.find("NumberOfPoints=");
+    if(positionPiece == std::string::npos || positionPiece > finXML){
         throw std::invalid_argument("Nombre de points non défini");
     }
+    size_t quote_start = contenu.find("\"", positionPiece);
+    size_t quote_end = contenu.find("\"", quote_start + 1);
+    if(quote_start == std::string::npos || quote_end == std::string::npos){
+        throw std::invalid_argument("Nombre de points mal définis");
+    }
+    unsigned long long nombreParticules = std::stoull(contenu.substr(quote_start + 1, quote_end - quote_start - 1));
+
+    /* Refuser un univers qui ne tiendrait pas en mémoire avant de lire les tableaux */
+    univers.reserverParticules(nombreParticules);
+
+    /* Repérer l'élément Points */
+    size_t debutPoints = contenu.find("<Points");
+    size_t finPoints = contenu.find("</Points>");
+
+    /* Lire la description de chaque tableau */
+    std::vector<TableauVTU> tableaux;
+    size_t position = 0;
+    while((position = contenu.find("<DataArray", position)) < finXML){
+        size_t fin;
+        std::string balise = lireBalise(contenu, position, fin);
 
-    /* Lire les positions et insérer les particules dans le vecteur */
-    while(std::getline(fichier, line)){
-        if(line.find("\"Position\"") != std::string::npos){
-            if(!std::getline(fichier, line)){
-                throw std::invalid_argument("Erreur de lecture de la ligne des positions");
-            } 
-            std::stringstream stream(line);
-            
-            double x, y, z;
-            for(unsigned long i = 0; i < nombreParticules; i++){
-                if(!(stream >> x >> y >> z)){
-                    throw std::invalid_argument("Erreur dans la lecture des positions");
-                }
-                Particule particule(x, y, z);
-                particules.push_back(particule);
+        TableauVTU tableau;
+        tableau.nom = lireAttribut(balise, "Name");
+        if(tableau.nom.empty()){
+            tableau.nom = lireAttribut(balise, "name");
+        }
+        tableau.type = lireAttribut(balise, "type");
+        tableau.format = lireAttribut(balise, "format");
+
+        std::string nombreComposantes = lireAttribut(balise, "NumberOfComponents");
+        if(!nombreComposantes.empty()){
+            tableau.nombreComposantes = std::stoi(nombreComposantes);
+        }
+
+        std::string decalage = lireAttribut(balise, "offset");
+        if(!decalage.empty()){
+            tableau.decalage = std::stoul(decalage);
+            contexte.decalages.push_back(tableau.decalage);
+        }
+
+        tableau.dansPoints = debutPoints != std::string::npos && finPoints != std::string::npos &&
+                             position > debutPoints && position < finPoints;
+
+        /* Délimiter le contenu en ligne, sauf pour une balise auto-fermante */
+        if(balise[balise.size() - 2] != '/'){
+            tableau.debutContenu = fin + 1;
+            tableau.finContenu = contenu.find("</DataArray>", fin);
+            if(tableau.finContenu == std::string::npos){
+                throw std::invalid_argument("Élément DataArray non fermé");
             }
+        }else{
+            tableau.debutContenu = tableau.finContenu = fin + 1;
+        }
+
+        tableaux.push_back(tableau);
+        position = tableau.finContenu;
+    }
+    std::sort(contexte.decalages.begin(), contexte.decalages.end());
+
+    /* Localiser les données ajoutées, qui commencent après le caractère '_' */
+    if(positionAjoutees != std::string::npos){
+        size_t fin;
+        std::string balise = lireBalise(contenu, positionAjoutees, fin);
+        contexte.ajouteesEnBase64 = (lireAttribut(balise, "encoding") == "base64");
+
+        size_t marque = contenu.find('_', fin);
+        if(marque == std::string::npos){
+            throw std::invalid_argument("Section AppendedData mal définie");
+        }
+        contexte.debutAjoutees = marque + 1;
+        contexte.finAjoutees = contenu.rfind("</AppendedData>");
+        if(contexte.finAjoutees == std::string::npos || contexte.finAjoutees < contexte.debutAjoutees){
+            contexte.finAjoutees = contenu.size();
+        }
+    }
+
+    /* Lire les positions, qui sont obligatoires */
+    const TableauVTU* tableauPositions = nullptr;
+    for(const auto& tableau : tableaux){
+        if(tableau.dansPoints){
+            tableauPositions = &tableau;
             break;
         }
     }
+    if(tableauPositions == nullptr){
+        throw std::invalid_argument("Erreur de lecture de la ligne des positions");
+    }
 
-    /* Vérifier que la taille du vecteur corresponde au nombre de particules */
-    if(nombreParticules != particules.size()){
+    std::vector<double> positions = lireTableau<double>(contenu, *tableauPositions, contexte, 3*nombreParticules);
+    if(positions.size() != 3*nombreParticules){
         throw std::invalid_argument("Nombre de points ne correspond pas au nombre de positions");
     }
 
+    /* Créer les particules */
+    std::vector<Particule> particules;
+    particules.reserve(nombreParticules);
+    for(unsigned long long i = 0; i < nombreParticules; i++){
+        particules.emplace_back(positions[3*i], positions[3*i + 1], positions[3*i + 2]);
+    }
+
     /* Lire les vitesses des particules */
-    while(std::getline(fichier, line)){
-        if(line.find("\"Velocity\"") != std::string::npos){
-            if(!std::getline(fichier, line)){
-                throw std::invalid_argument("Erreur de lecture de la ligne des vitesses");
-            } 
-            std::stringstream stream(line);
-        
-            for(unsigned long i = 0; i < nombreParticules; i++){
-                double vx, vy, vz;
-                if(!(stream >> vx >> vy >> vz)){
-                    throw std::invalid_argument("Erreur dans la lecture des vitesses");
-                }
-        
-                particules[i].setVitesse(Vecteur<double>(vx, vy, vz));
-            }
-            break;
+    const TableauVTU* tableauVitesses = chercherTableau(tableaux, {"Velocity", "Vitesse", "velocity"});
+    if(tableauVitesses != nullptr){
+        std::vector<double> vitesses = lireTableau<double>(contenu, *tableauVitesses, contexte, 3*nombreParticules);
+        if(vitesses.size() < 3*nombreParticules){
+            throw std::invalid_argument("Erreur dans la lecture des vitesses");
+        }
+        for(unsigned long long i = 0; i < nombreParticules; i++){
+            particules[i].setVitesse(Vecteur<double>(vitesses[3*i], vitesses[3*i + 1], vitesses[3*i + 2]));
         }
     }
 
     /* Lire les masses des particules */
-    while(std::getline(fichier, line)){
-        if(line.find("\"Masse\"") != std::string::npos){
-            if(!std::getline(fichier, line)){
-                throw std::invalid_argument("Erreur de lecture de la ligne des masses");
-            } 
-            std::stringstream stream(line);
-        
-            for(unsigned long i = 0; i < nombreParticules; i++){
-                double masse;
-                if(!(stream >> masse)){
-                    throw std::invalid_argument("Erreur dans la lecture des masses");
-                }
-                particules[i].setMasse(masse);
-            }
-            break;
+    const TableauVTU* tableauMasses = chercherTableau(tableaux, {"Masse", "Mass", "mass"});
+    if(tableauMasses != nullptr){
+        std::vector<double> masses = lireTableau<double>(contenu, *tableauMasses, contexte, nombreParticules);
+        if(masses.size() < nombreParticules){
+            throw std::invalid_argument("Erreur dans la lecture des masses");
+        }
+        for(unsigned long long i = 0; i < nombreParticules; i++){
+            particules[i].setMasse(masses[i]);
+        }
+    }
+
+    /* Lire les catégories des particules, si elles sont fournies */
+    const TableauVTU* tableauCategories = chercherTableau(tableaux, {"Categorie", "Category", "Species", "Espece"});
+    if(tableauCategories != nullptr){
+        std::vector<int64_t> categories = lireTableau<int64_t>(contenu, *tableauCategories, contexte, nombreParticules);
+        if(categories.size() < nombreParticules){
+            throw std::invalid_argument("Erreur dans la lecture des catégories");
+        }
+        for(unsigned long long i = 0; i < nombreParticules; i++){
+            particules[i].setCategorie(std::to_string(categories[i]));
+        }
+    }
+
+    /* Lire les identifiants des particules, s'ils sont fournis, en entiers 64 bits */
+    const TableauVTU* tableauIds = chercherTableau(tableaux, {"Id", "Ids", "id"});
+    if(tableauIds != nullptr){
+        std::vector<int64_t> ids = lireTableau<int64_t>(contenu, *tableauIds, contexte, nombreParticules);
+        if(ids.size() < nombreParticules){
+            throw std::invalid_argument("Erreur dans la lecture des identifiants");
+        }
+        for(unsigned long long i = 0; i < nombreParticules; i++){
+            particules[i].setId(static_cast<IdentifiantParticule>(ids[i]));
         }
     }
 
@@ -98,6 +437,4 @@ void lectureDuFichier(const std::string& adresseFichier, Univers& univers){
     for(auto& particule : particules){
         univers.ajouterParticule(particule);
     }
-
-    fichier.close();
 }
@@ -0,0 +1,164 @@
+#include "reduction.hxx"
+
+/* Constructeur */
+
+ReductionChamps::ReductionChamps(const Univers& univers, int facteur) : echantillons(0){
+    if(facteur < 1){
+        throw std::invalid_argument("Le facteur de réduction doit être positif");
+    }
+
+    const Vecteur<int>& nc = univers.getNc();
+    const Vecteur<double>& ld = univers.getLd();
+    const Vecteur<double>& tailleCellule = univers.getTailleCellule();
+
+    /* Regrouper facteur cellules par voxel, le dernier voxel pouvant être incomplet */
+    nv = Vecteur<int>((nc.getX() + facteur - 1) / facteur, (nc.getY() + facteur - 1) / facteur, (nc.getZ() + facteur - 1) / facteur);
+    pas = tailleCellule * facteur;
+    origine = ld / -2;
+    dimension = (ld.getX() > 0) + (ld.getY() > 0) + (ld.getZ() > 0);
+
+    /* Attribuer chaque cellule à son voxel */
+    const std::vector<Cellule>& grille = univers.getGrille();
+    voxelsDesCellules.resize(grille.size());
+    for(size_t c = 0; c < grille.size(); c++){
+        const Vecteur<int>& indices = grille[c].getIndices();
+        voxelsDesCellules[c] = indices.getX()/facteur + nv.getX()*(indices.getY()/facteur + nv.getY()*(indices.getZ()/facteur));
+    }
+
+    /* Calculer le volume de chaque voxel à partir des cellules qu'il couvre */
+    const int nombreVoxels = nv.getX() * nv.getY() * nv.getZ();
+    volumes.assign(nombreVoxels, 0);
+    double volumeCellule = 1;
+    if(ld.getX() > 0){
+        volumeCellule *= tailleCellule.getX();
+    }
+    if(ld.getY() > 0){
+        volumeCellule *= tailleCellule.getY();
+    }
+    if(ld.getZ() > 0){
+        volumeCellule *= tailleCellule.getZ();
+    }
+    for(size_t c = 0; c < grille.size(); c++){
+        volumes[voxelsDesCellules[c]] += volumeCellule;
+    }
+
+    reinitialiser();
+}
+
+/* Méthodes publiques */
+
+void ReductionChamps::accumuler(const Univers& univers){
+    const std::vector<Cellule>& grille = univers.getGrille();
+    for(size_t c = 0; c < grille.size(); c++){
+        const int voxel = voxelsDesCellules[c];
+        for(const auto particule : grille[c].getParticules()){
+            const double masse = particule->getMasse();
+            const Vecteur<double>& vitesse = particule->getVitesse();
+            nombres[voxel] += 1;
+            masses[voxel] += masse;
+            quantitesMouvement[3*voxel] += masse * vitesse.getX();
+            quantitesMouvement[3*voxel + 1] += masse * vitesse.getY();
+            quantitesMouvement[3*voxel + 2] += masse * vitesse.getZ();
+            energies[voxel] += masse * vitesse.normeCarre();
+        }
+    }
+    echantillons++;
+}
+
+ChampsReduits ReductionChamps::calculerChamps() const{
+    const size_t nombreVoxels = volumes.size();
+    const double n = std::max(echantillons, 1);
+
+    ChampsReduits champs;
+    champs.nombres.resize(nombreVoxels);
+    champs.densites.resize(nombreVoxels);
+    champs.vitesses.assign(3*nombreVoxels, 0);
+    champs.temperatures.assign(nombreVoxels, 0);
+    for(size_t v = 0; v < nombreVoxels; v++){
+        champs.nombres[v] = nombres[v] / n;
+        champs.densites[v] = masses[v] / (n * volumes[v]);
+        if(masses[v] > 0){
+            double vitesseCarre = 0;
+            for(int c = 0; c < 3; c++){
+                champs.vitesses[3*v + c] = quantitesMouvement[3*v + c] / masses[v];
+                vitesseCarre += champs.vitesses[3*v + c] * champs.vitesses[3*v + c];
+            }
+
+            /* Énergie cinétique d'agitation répartie sur les degrés de liberté */
+            double agitation = energies[v] - masses[v] * vitesseCarre;
+            champs.temperatures[v] = std::max(agitation, 0.0) / (dimension * nombres[v]);
+        }
+    }
+    return champs;
+}
+
+void ReductionChamps::sauvegarderEnVTI(const std::string& adresseFichier){
+    ChampsReduits champs = calculerChamps();
+    std::ofstream fichierVTI = ouvrirFichierDeSortie(adresseFichier);
+
+    std::string etendue = "0 " + std::to_string(nv.getX()) + " 0 " + std::to_string(nv.getY()) + " 0 " + std::to_string(nv.getZ());
+    fichierVTI << "<VTKFile type=\"ImageData\" version=\"0.1\" byte_order=\"LittleEndian\">\n";
+    fichierVTI << "  <ImageData WholeExtent=\"" << etendue << "\" Origin=\"" << origine.getX() << " " << origine.getY() << " " << origine.getZ()
+               << "\" Spacing=\"" << pas.getX() << " " << pas.getY() << " " << pas.getZ() << "\">\n";
+    fichierVTI << "    <Piece Extent=\"" << etendue << "\">\n";
+    fichierVTI << "      <CellData Scalars=\"Densite\" Vectors=\"Vitesse\">\n";
+
+    fichierVTI << "        <DataArray type=\"Float64\" Name=\"Densite\" format=\"ascii\">\n";
+    fichierVTI << "          ";
+    for(const auto densite : champs.densites){
+        fichierVTI << densite << " ";
+    }
+    fichierVTI << "\n";
+    fichierVTI << "        </DataArray>\n";
+
+    fichierVTI << "        <DataArray type=\"Float64\" Name=\"Vitesse\" NumberOfComponents=\"3\" format=\"ascii\">\n";
+    fichierVTI << "          ";
+    for(const auto vitesse : champs.vitesses){
+        fichierVTI << vitesse << " ";
+    }
+    fichierVTI << "\n";
+    fichierVTI << "        </DataArray>\n";
+
+    fichierVTI << "        <DataArray type=\"Float64\" Name=\"Temperature\" format=\"ascii\">\n";
+    fichierVTI << "          ";
+    for(const auto temperature : champs.temperatures){
+        fichierVTI << temperature << " ";
+    }
+    fichierVTI << "\n";
+    fichierVTI << "        </DataArray>\n";
+
+    fichierVTI << "        <DataArray type=\"Float64\" Name=\"Nombre\" format=\"ascii\">\n";
+    fichierVTI << "          ";
+    for(const auto nombre : champs.nombres){
+        fichierVTI << nombre << " ";
+    }
+    fichierVTI << "\n";
+    fichierVTI << "        </DataArray>\n";
+
+    fichierVTI << "      </CellData>\n";
+    fichierVTI << "    </Piece>\n";
+    fichierVTI << "  </ImageData>\n";
+    fichierVTI << "</VTKFile>\n";
+
+    fichierVTI.close();
+    reinitialiser();
+}
+
+void ReductionChamps::reinitialiser(){
+    const size_t nombreVoxels = volumes.size();
+    nombres.assign(nombreVoxels, 0);
+    masses.assign(nombreVoxels, 0);
+    quantitesMouvement.assign(3*nombreVoxels, 0);
+    energies.assign(nombreVoxels, 0);
+    echantillons = 0;
+}
+
+/* Getters */
+
+const Vecteur<int>& ReductionChamps::getNv() const{
+    return nv;
+}
+
+int ReductionChamps::getEchantillons() const{
+    return echantillons;
+}
@@ -0,0 +1,190 @@
+#include "reprise.hxx"
+#include <cstring>
+#include <cstdio>
+#include <map>
+
+static const char magieReprise[8] = {'S', 'I', 'M', 'R', 'E', 'P', 'R', '\0'};
+static const uint32_t versionReprise = 2;
+static const uint32_t marqueurOrdre = 0x01020304;
+
+/* Calculer la somme de contrôle FNV-1a d'un tampon */
+static uint64_t calculerSommeControle(const char* octets, size_t taille){
+    uint64_t somme = 14695981039346656037ULL;
+    for(size_t i = 0; i < taille; i++){
+        somme = (somme ^ static_cast<unsigned char>(octets[i])) * 1099511628211ULL;
+    }
+    return somme;
+}
+
+/* Ajouter la représentation binaire d'une valeur au tampon */
+template <typename T>
+static void ecrireBinaire(std::string& tampon, const T& valeur){
+    tampon.append(reinterpret_cast<const char*>(&valeur), sizeof(T));
+}
+
+/* Lire une valeur binaire du tampon en vérifiant ses limites */
+template <typename T>
+static T lireBinaire(const std::string& tampon, size_t& position){
+    if(position + sizeof(T) > tampon.size()){
+        throw std::invalid_argument("Fichier de reprise tronqué");
+    }
+    T valeur;
+    std::memcpy(&valeur, tampon.data() + position, sizeof(T));
+    position += sizeof(T);
+    return valeur;
+}
+
+static void ecrireVecteur(std::string& tampon, const Vecteur<double>& vecteur){
+    ecrireBinaire(tampon, vecteur.getX());
+    ecrireBinaire(tampon, vecteur.getY());
+    ecrireBinaire(tampon, vecteur.getZ());
+}
+
+static Vecteur<double> lireVecteur(const std::string& tampon, size_t& position){
+    double x = lireBinaire<double>(tampon, position);
+    double y = lireBinaire<double>(tampon, position);
+    double z = lireBinaire<double>(tampon, position);
+    return Vecteur<double>(x, y, z);
+}
+
+void sauvegarderReprise(const std::string& adresseFichier, const Univers& univers, const EtatReprise& etat){
+
+    /* Construire la table des catégories */
+    std::map<std::string, uint32_t> indicesCategories;
+    std::vector<const std::string*> categories;
+    for(const auto& cellule : univers.getGrille()){
+        for(const auto particule : cellule.getParticules()){
+            if(indicesCategories.insert(std::make_pair(particule->getCategorie(), categories.size())).second){
+                categories.push_back(&particule->getCategorie());
+            }
+        }
+    }
+
+    /* Écrire l'en-tête */
+    std::string tampon;
+    tampon.append(magieReprise, sizeof(magieReprise));
+    ecrireBinaire(tampon, versionReprise);
+    ecrireBinaire(tampon, marqueurOrdre);
+    ecrireBinaire(tampon, etat.temps);
+    ecrireBinaire(tampon, etat.iteration);
+    ecrireBinaire(tampon, etat.hashConfiguration);
+    ecrireBinaire(tampon, static_cast<int64_t>(etat.prochainId));
+    ecrireVecteur(tampon, univers.getLd());
+
+    ecrireBinaire(tampon, static_cast<uint64_t>(categories.size()));
+    for(const auto categorie : categories){
+        ecrireBinaire(tampon, static_cast<uint32_t>(categorie->size()));
+        tampon.append(*categorie);
+    }
+
+    /* Écrire les particules dans l'ordre de la grille */
+    ecrireBinaire(tampon, static_cast<uint64_t>(univers.getNombreParticules()));
+    for(const auto& cellule : univers.getGrille()){
+        for(const auto particule : cellule.getParticules()){
+            ecrireBinaire(tampon, static_cast<int64_t>(particule->getId()));
+            ecrireBinaire(tampon, indicesCategories[particule->getCategorie()]);
+            ecrireBinaire(tampon, static_cast<uint32_t>(0));
+            ecrireBinaire(tampon, particule->getMasse());
+            ecrireVecteur(tampon, particule->getPosition());
+            ecrireVecteur(tampon, particule->getVitesse());
+            ecrireVecteur(tampon, particule->getForce());
+        }
+    }
+
+    ecrireBinaire(tampon, calculerSommeControle(tampon.data(), tampon.size()));
+
+    /* Écrire dans un fichier temporaire puis le renommer */
+    std::string adresseTemporaire = adresseFichier + ".tmp";
+    std::ofstream fichier = ouvrirFichierDeSortie(adresseTemporaire);
+    fichier.write(tampon.data(), tampon.size());
+    fichier.close();
+    if(!fichier || std::rename(adresseTemporaire.c_str(), adresseFichier.c_str()) != 0){
+        throw std::runtime_error("Erreur lors de l'écriture du fichier de reprise " + adresseFichier);
+    }
+}
+
+EtatReprise lireReprise(const std::string& adresseFichier, Univers& univers){
+
+    /* Charger le fichier */
+    std::ifstream fichier = ouvrirFichierDEntree(adresseFichier);
+    fichier.seekg(0, std::ios::end);
+    std::string tampon(static_cast<size_t>(fichier.tellg()), '\0');
+    fichier.seekg(0, std::ios::beg);
+    fichier.read(&tampon[0], tampon.size());
+    fichier.close();
+
+    /* Vérifier la somme de contrôle */
+    if(tampon.size() < sizeof(magieReprise) + sizeof(uint64_t)){
+        throw std::invalid_argument("Fichier de reprise tronqué");
+    }
+    size_t tailleDonnees = tampon.size() - sizeof(uint64_t);
+    size_t positionSomme = tailleDonnees;
+    if(lireBinaire<uint64_t>(tampon, positionSomme) != calculerSommeControle(tampon.data(), tailleDonnees)){
+        throw std::invalid_argument("Somme de contrôle du fichier de reprise incorrecte");
+    }
+
+    /* Vérifier l'en-tête */
+    if(std::memcmp(tampon.data(), magieReprise, sizeof(magieReprise)) != 0){
+        throw std::invalid_argument("Le fichier " + adresseFichier + " n'est pas un fichier de reprise");
+    }
+    size_t position = sizeof(magieReprise);
+    if(lireBinaire<uint32_t>(tampon, position) != versionReprise){
+        throw std::invalid_argument("Version du fichier de reprise non supportée");
+    }
+    if(lireBinaire<uint32_t>(tampon, position) != marqueurOrdre){
+        throw std::invalid_argument("Ordre des octets du fichier de reprise différent de celui de la machine");
+    }
+
+    EtatReprise etat;
+    etat.temps = lireBinaire<double>(tampon, position);
+    etat.iteration = lireBinaire<int64_t>(tampon, position);
+    etat.hashConfiguration = lireBinaire<uint64_t>(tampon, position);
+    etat.prochainId = lireBinaire<int64_t>(tampon, position);
+
+    if(!(lireVecteur(tampon, position) == univers.getLd())){
+        throw std::invalid_argument("Les dimensions de l'univers diffèrent de celles du point de reprise");
+    }
+
+    /* Lire la table des catégories */
+    uint64_t nombreCategories = lireBinaire<uint64_t>(tampon, position);
+    std::vector<std::string> categories;
+    for(uint64_t k = 0; k < nombreCategories; k++){
+        uint32_t longueur = lireBinaire<uint32_t>(tampon, position);
+        if(position + longueur > tailleDonnees){
+            throw std::invalid_argument("Fichier de reprise tronqué");
+        }
+        categories.push_back(tampon.substr(position, longueur));
+        position += longueur;
+    }
+
+    /* Restaurer les particules sans les translater */
+    uint64_t nombreParticules = lireBinaire<uint64_t>(tampon, position);
+    univers.reserverParticules(nombreParticules);
+    for(uint64_t k = 0; k < nombreParticules; k++){
+        int64_t id = lireBinaire<int64_t>(tampon, position);
+        uint32_t categorie = lireBinaire<uint32_t>(tampon, position);
+        lireBinaire<uint32_t>(tampon, position);
+        double masse = lireBinaire<double>(tampon, position);
+        if(categorie >= categories.size()){
+            throw std::invalid_argument("Catégorie inconnue dans le fichier de reprise");
+        }
+
+        Particule particule(0, 0, 0);
+        particule.setId(id);
+        particule.setCategorie(categories[categorie]);
+        particule.setMasse(masse);
+        particule.setPosition(lireVecteur(tampon, position));
+        particule.setVitesse(lireVecteur(tampon, position));
+        particule.setForce(lireVecteur(tampon, position));
+        univers.restaurerParticule(particule);
+    }
+
+    /* Les identifiants des particules absorbées ne sont pas réattribués */
+    univers.restaurerProchainId(etat.prochainId);
+
+    if(position != tailleDonnees){
+        throw std::invalid_argument("Données inattendues à la fin du fichier de reprise");
+    }
+
+    return etat;
+}
@@ -1,13 +1,6 @@
 #include "sauvegardage.hxx"
-
-void sauvegarderEtatEnTexte(std::ofstream& fichierTexte, const Univers& univers, int i){
-    fichierTexte << "Iteration " << std::to_string(i) << " : ";
-    for(const auto& cellule : univers.getGrille()){
-        for(const auto particule : cellule.getParticules()){
-            fichierTexte << *particule << " ";
-        }
-    }
-}
+#include <cstdio>
+#include <iomanip>
 
 void sauvegarderEtatEnVTU(const std::string& nomDossier, const Univers& univers, int i){
 
@@ -78,3 +71,57 @@ void sauvegarderEtatEnVTU(const std::string& nomDossier, const Univers& univers,
     fichierVTU.close();
 
 }
+
+/* Constructeur */
+
+CollectionPVD::CollectionPVD(const std::string& adresseFichier, double tempsReprise) : adresseFichier(adresseFichier){
+
+    /* En reprise, conserver les entrées antérieures au temps de reprise */
+    std::ifstream fichier(adresseFichier);
+    if(tempsReprise < 0 || !fichier.is_open()){
+        return;
+    }
+    std::string ligne;
+    while(std::getline(fichier, ligne)){
+        size_t debutTemps = ligne.find("timestep=\"");
+        size_t debutFichier = ligne.find("file=\"");
+        if(debutTemps == std::string::npos || debutFichier == std::string::npos){
+            continue;
+        }
+        debutTemps += 10;
+        debutFichier += 6;
+        double temps = std::stod(ligne.substr(debutTemps, ligne.find('"', debutTemps) - debutTemps));
+        if(temps < tempsReprise){
+            entrees.emplace_back(temps, ligne.substr(debutFichier, ligne.find('"', debutFichier) - debutFichier));
+        }
+    }
+}
+
+/* Méthodes publiques */
+
+void CollectionPVD::ajouter(double temps, const std::string& nomFichier){
+    entrees.emplace_back(temps, nomFichier);
+
+    /* Écrire dans un fichier temporaire puis le renommer */
+    std::string adresseTemporaire = adresseFichier + ".tmp";
+    std::ofstream fichierPVD = ouvrirFichierDeSortie(adresseTemporaire);
+    fichierPVD << std::setprecision(17);
+    fichierPVD << "<?xml version=\"1.0\"?>\n";
+    fichierPVD << "<VTKFile type=\"Collection\" version=\"0.1\" byte_order=\"LittleEndian\">\n";
+    fichierPVD << "  <Collection>\n";
+    for(const auto& entree : entrees){
+        fichierPVD << "    <DataSet timestep=\"" << entree.first << "\" group=\"\" part=\"0\" file=\"" << entree.second << "\"/>\n";
+    }
+    fichierPVD << "  </Collection>\n";
+    fichierPVD << "</VTKFile>\n";
+    fichierPVD.close();
+    if(!fichierPVD || std::rename(adresseTemporaire.c_str(), adresseFichier.c_str()) != 0){
+        throw std::runtime_error("Erreur lors de l'écriture de la collection " + adresseFichier);
+    }
+}
+
+/* Getters */
+
+const std::vector<std::pair<double, std::string>>& CollectionPVD::getEntrees() const{
+    return entrees;
+}
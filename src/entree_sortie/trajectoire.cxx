@@ -0,0 +1,764 @@
+#include "trajectoire.hxx"
+#include <algorithm>
+#include <cstring>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include "memoire.hxx"
+
+static const char magieTrajectoire[8] = {'S', 'I', 'M', 'T', 'R', 'A', 'J', '\0'};
+static const uint32_t versionTrajectoire = 1;
+static const uint32_t marqueurOrdre = 0x01020304;
+static const uint32_t magieFrame = 0x4D415246; /* "FRAM" */
+static const size_t tailleEnteteFichier = sizeof(magieTrajectoire) + 2*sizeof(uint32_t) + 3*sizeof(double);
+
+/**
+* @brief
+* En-tête binaire de chaque frame du fichier de trajectoire.
+*/
+
+struct EnteteFrame{
+    uint32_t magie; /**< Marque de début de frame. */
+    uint32_t codage; /**< Codage des colonnes (0 : colonnes brutes). */
+    int64_t iteration; /**< Numéro de l'itération. */
+    double temps; /**< Temps de simulation. */
+    uint64_t nombreParticules; /**< Nombre de particules. */
+    uint32_t champs; /**< Champs optionnels présents. */
+    uint32_t nombreCategories; /**< Nombre de catégories de la table. */
+    uint64_t tailleDonnees; /**< Taille des données qui suivent l'en-tête. */
+};
+
+/**
+* @brief
+* En-tête qui précède les données d'une frame compressée.
+*/
+
+struct EnteteCompression{
+    double precision; /**< Pas de quantification des positions et des vitesses. */
+    uint32_t imageCle; /**< Indique si la frame est codée sans référence. */
+    uint32_t reserve; /**< Remplissage, toujours nul. */
+    uint64_t tailleFlux; /**< Taille du flux d'entiers à longueur variable. */
+};
+
+/* Codages des colonnes d'une frame */
+static const uint32_t codageBrut = 0;
+static const uint32_t codageDelta = 1;
+
+/**
+* @brief
+* Pied de page du fichier de trajectoire, écrit à la fermeture.
+*/
+
+struct PiedTrajectoire{
+    uint64_t positionIndex; /**< Position de la table d'index. */
+    uint64_t nombreFrames; /**< Nombre d'entrées de la table d'index. */
+    char magie[8]; /**< Marque de fin de fichier. */
+};
+
+/* Arrondir une taille au multiple de 8 supérieur */
+static size_t aligner(size_t taille){
+    return (taille + 7) & ~static_cast<size_t>(7);
+}
+
+/* Positions des colonnes dans les données d'une frame */
+struct ColonnesFrame{
+    size_t ids, positions, vitesses, forces, masses, categories, table;
+};
+
+static ColonnesFrame calculerColonnes(uint64_t n, uint32_t champs){
+    ColonnesFrame colonnes;
+    colonnes.ids = 0;
+    colonnes.positions = colonnes.ids + n*sizeof(int64_t);
+    colonnes.vitesses = colonnes.positions + 3*n*sizeof(float);
+    colonnes.forces = colonnes.vitesses + 3*n*sizeof(float);
+    colonnes.masses = colonnes.forces + ((champs & CHAMP_FORCES) ? 3*n*sizeof(float) : 0);
+    colonnes.categories = colonnes.masses + n*sizeof(float);
+    colonnes.table = colonnes.categories + n*sizeof(uint32_t);
+    return colonnes;
+}
+
+/* Représentation binaire d'un réel en simple précision */
+static uint32_t bitsFloat(double valeur){
+    float reel = static_cast<float>(valeur);
+    uint32_t bits;
+    std::memcpy(&bits, &reel, sizeof(bits));
+    return bits;
+}
+
+static float floatBits(uint32_t bits){
+    float reel;
+    std::memcpy(&reel, &bits, sizeof(reel));
+    return reel;
+}
+
+/* Associer à chaque particule courante son indice dans l'état précédent (-1 si absente) */
+static std::vector<int64_t> apparier(const std::vector<int64_t>& ids, const std::vector<int64_t>& idsPrecedents){
+    std::vector<int64_t> correspondances(ids.size(), -1);
+    size_t j = 0;
+    for(size_t k = 0; k < ids.size(); k++){
+        while(j < idsPrecedents.size() && idsPrecedents[j] < ids[k]){
+            j++;
+        }
+        if(j < idsPrecedents.size() && idsPrecedents[j] == ids[k]){
+            correspondances[k] = j;
+        }
+    }
+    return correspondances;
+}
+
+/* Coder une colonne d'entiers par différence avec l'état précédent */
+static void coderDifferences(std::vector<char>& flux, const std::vector<int64_t>& valeurs, const std::vector<int64_t>& precedentes,
+                             const std::vector<int64_t>& correspondances, size_t composantes){
+    for(size_t k = 0; k < correspondances.size(); k++){
+        for(size_t c = 0; c < composantes; c++){
+            int64_t reference = correspondances[k] < 0 ? 0 : precedentes[correspondances[k]*composantes + c];
+            ajouterVarint(flux, encoderZigzag(valeurs[k*composantes + c] - reference));
+        }
+    }
+}
+
+static void decoderDifferences(const char*& curseur, const char* fin, std::vector<int64_t>& valeurs, const std::vector<int64_t>& precedentes,
+                               const std::vector<int64_t>& correspondances, size_t composantes){
+    valeurs.resize(correspondances.size() * composantes);
+    for(size_t k = 0; k < correspondances.size(); k++){
+        for(size_t c = 0; c < composantes; c++){
+            int64_t reference = correspondances[k] < 0 ? 0 : precedentes[correspondances[k]*composantes + c];
+            valeurs[k*composantes + c] = reference + decoderZigzag(lireVarint(curseur, fin));
+        }
+    }
+}
+
+/* Coder une colonne de réels par « ou exclusif » avec leur valeur précédente */
+static void coderBits(std::vector<char>& flux, const std::vector<uint32_t>& valeurs, const std::vector<uint32_t>& precedentes,
+                      const std::vector<int64_t>& correspondances, size_t composantes){
+    for(size_t k = 0; k < correspondances.size(); k++){
+        for(size_t c = 0; c < composantes; c++){
+            uint32_t reference = correspondances[k] < 0 ? 0 : precedentes[correspondances[k]*composantes + c];
+            ajouterVarint(flux, valeurs[k*composantes + c] ^ reference);
+        }
+    }
+}
+
+static void decoderBits(const char*& curseur, const char* fin, std::vector<uint32_t>& valeurs, const std::vector<uint32_t>& precedentes,
+                        const std::vector<int64_t>& correspondances, size_t composantes){
+    valeurs.resize(correspondances.size() * composantes);
+    for(size_t k = 0; k < correspondances.size(); k++){
+        for(size_t c = 0; c < composantes; c++){
+            uint32_t reference = correspondances[k] < 0 ? 0 : precedentes[correspondances[k]*composantes + c];
+            valeurs[k*composantes + c] = static_cast<uint32_t>(lireVarint(curseur, fin)) ^ reference;
+        }
+    }
+}
+
+/* Écrire un vecteur en simple précision */
+static void copierVecteur(char* destination, const Vecteur<double>& vecteur){
+    float valeurs[3] = {static_cast<float>(vecteur.getX()), static_cast<float>(vecteur.getY()), static_cast<float>(vecteur.getZ())};
+    std::memcpy(destination, valeurs, sizeof(valeurs));
+}
+
+/* Constructeur */
+
+EcrivainTrajectoire::EcrivainTrajectoire(const std::string& adresseFichier, const Vecteur<double>& ld, bool avecForces, int64_t iterationReprise) :
+    position(0), avecForces(avecForces), ouvert(true), compression(false), precision(0),
+    intervalleImagesCles(0), framesDepuisImageCle(0), precedentValide(false){
+
+    /* En reprise, conserver les frames antérieures du fichier existant */
+    struct stat info;
+    if(iterationReprise >= 0 && stat(adresseFichier.c_str(), &info) == 0){
+        uint64_t fin = tailleEnteteFichier;
+        {
+            LecteurTrajectoire lecteur(adresseFichier);
+            for(size_t k = 0; k < lecteur.getNombreFrames(); k++){
+                if(lecteur.getIndex()[k].iteration >= iterationReprise){
+                    break;
+                }
+                index.push_back(lecteur.getIndex()[k]);
+                fin = lecteur.getFinFrame(k);
+            }
+        }
+        if(truncate(adresseFichier.c_str(), fin) != 0){
+            throw std::runtime_error("Erreur lors de la troncature du fichier de trajectoire " + adresseFichier);
+        }
+        fichier = ouvrirFichierDeSortie(adresseFichier, true);
+        position = fin;
+        return;
+    }
+
+    /* Écrire l'en-tête du fichier */
+    fichier = ouvrirFichierDeSortie(adresseFichier);
+    double longueurs[3] = {ld.getX(), ld.getY(), ld.getZ()};
+    fichier.write(magieTrajectoire, sizeof(magieTrajectoire));
+    fichier.write(reinterpret_cast<const char*>(&versionTrajectoire), sizeof(uint32_t));
+    fichier.write(reinterpret_cast<const char*>(&marqueurOrdre), sizeof(uint32_t));
+    fichier.write(reinterpret_cast<const char*>(longueurs), sizeof(longueurs));
+    position = tailleEnteteFichier;
+}
+
+EcrivainTrajectoire::~EcrivainTrajectoire(){
+    try{
+        fermer();
+    }catch(const std::exception& e){
+        std::cerr << "Erreur : " << e.what() << std::endl;
+    }
+}
+
+/* Méthodes publiques */
+
+void EcrivainTrajectoire::ajouterFrame(const Univers& univers, int64_t iteration, double temps){
+    EnteteFrame entete;
+    entete.magie = magieFrame;
+    entete.codage = compression ? codageDelta : codageBrut;
+    entete.iteration = iteration;
+    entete.temps = temps;
+    entete.nombreParticules = univers.getNombreParticules();
+    entete.champs = avecForces ? CHAMP_FORCES : 0;
+
+    /* Construire les colonnes de la frame après l'emplacement de l'en-tête */
+    tampon.assign(sizeof(EnteteFrame), 0);
+    if(compression){
+        construireFrameCompressee(univers);
+    }else{
+        construireFrameBrute(univers);
+    }
+
+    /* Ajouter la table des catégories */
+    for(const auto& categorie : categories){
+        uint32_t longueur = categorie.size();
+        tampon.insert(tampon.end(), reinterpret_cast<const char*>(&longueur), reinterpret_cast<const char*>(&longueur) + sizeof(longueur));
+        tampon.insert(tampon.end(), categorie.begin(), categorie.end());
+    }
+    tampon.resize(aligner(tampon.size()), 0);
+
+    /* Compléter l'en-tête et écrire la frame */
+    entete.nombreCategories = categories.size();
+    entete.tailleDonnees = tampon.size() - sizeof(EnteteFrame);
+    std::memcpy(tampon.data(), &entete, sizeof(entete));
+
+    fichier.write(tampon.data(), tampon.size());
+    if(!fichier){
+        throw std::runtime_error("Erreur lors de l'écriture de la trajectoire");
+    }
+    index.push_back({position, iteration, temps});
+    position += tampon.size();
+}
+
+void EcrivainTrajectoire::activerCompression(double precision, int intervalleImagesCles){
+    if(precision <= 0 || intervalleImagesCles < 1){
+        throw std::invalid_argument("Paramètres de compression de la trajectoire non valides");
+    }
+    compression = true;
+    this->precision = precision;
+    this->intervalleImagesCles = intervalleImagesCles;
+    precedentValide = false;
+}
+
+void EcrivainTrajectoire::fermer(){
+    if(!ouvert){
+        return;
+    }
+    ouvert = false;
+
+    /* Écrire la table d'index puis le pied de page */
+    PiedTrajectoire pied;
+    pied.positionIndex = position;
+    pied.nombreFrames = index.size();
+    std::memcpy(pied.magie, magieTrajectoire, sizeof(pied.magie));
+
+    fichier.write(reinterpret_cast<const char*>(index.data()), index.size() * sizeof(EntreeIndexTrajectoire));
+    fichier.write(reinterpret_cast<const char*>(&pied), sizeof(pied));
+    fichier.close();
+}
+
+size_t EcrivainTrajectoire::getOctets() const{
+    size_t octets = octetsConteneur(tampon) + octetsConteneur(index);
+
+    /* État quantifié de la frame précédente, conservé pour la compression */
+    octets += octetsConteneur(precedent.ids) + octetsConteneur(precedent.positions) + octetsConteneur(precedent.vitesses)
+            + octetsConteneur(precedent.forces) + octetsConteneur(precedent.masses) + octetsConteneur(precedent.categories);
+    return octets;
+}
+
+/* Méthodes privées */
+
+uint32_t EcrivainTrajectoire::indiceCategorie(const std::string& categorie){
+    auto insertion = indicesCategories.insert(std::make_pair(categorie, categories.size()));
+    if(insertion.second){
+        categories.push_back(categorie);
+    }
+    return insertion.first->second;
+}
+
+void EcrivainTrajectoire::construireFrameBrute(const Univers& univers){
+    const Vecteur<double> centre = univers.getLd() / 2;
+    const uint64_t n = univers.getNombreParticules();
+
+    /* Remplir toutes les colonnes en un seul parcours de la grille */
+    ColonnesFrame colonnes = calculerColonnes(n, avecForces ? CHAMP_FORCES : 0);
+    tampon.resize(sizeof(EnteteFrame) + colonnes.table, 0);
+    char* donnees = tampon.data() + sizeof(EnteteFrame);
+
+    uint64_t k = 0;
+    for(const auto& cellule : univers.getGrille()){
+        for(const auto particule : cellule.getParticules()){
+            if(k >= n){
+                throw std::logic_error("Nombre de particules de la grille incohérent");
+            }
+            int64_t id = particule->getId();
+            float masse = particule->getMasse();
+            uint32_t categorie = indiceCategorie(particule->getCategorie());
+            std::memcpy(donnees + colonnes.ids + k*sizeof(int64_t), &id, sizeof(id));
+            copierVecteur(donnees + colonnes.positions + 3*k*sizeof(float), particule->getPosition() - centre);
+            copierVecteur(donnees + colonnes.vitesses + 3*k*sizeof(float), particule->getVitesse());
+            if(avecForces){
+                copierVecteur(donnees + colonnes.forces + 3*k*sizeof(float), particule->getForce());
+            }
+            std::memcpy(donnees + colonnes.masses + k*sizeof(float), &masse, sizeof(masse));
+            std::memcpy(donnees + colonnes.categories + k*sizeof(uint32_t), &categorie, sizeof(categorie));
+            k++;
+        }
+    }
+}
+
+void EcrivainTrajectoire::construireFrameCompressee(const Univers& univers){
+    const Vecteur<double> centre = univers.getLd() / 2;
+
+    /* Trier les particules par identifiant pour les apparier d'une frame à l'autre */
+    std::vector<const Particule*> particules;
+    particules.reserve(univers.getNombreParticules());
+    for(const auto& cellule : univers.getGrille()){
+        for(const auto particule : cellule.getParticules()){
+            particules.push_back(particule);
+        }
+    }
+    if(particules.size() != static_cast<size_t>(univers.getNombreParticules())){
+        throw std::logic_error("Nombre de particules de la grille incohérent");
+    }
+    std::sort(particules.begin(), particules.end(), [](const Particule* a, const Particule* b){ return a->getId() < b->getId(); });
+
+    /* Quantifier l'état courant */
+    const size_t n = particules.size();
+    EtatCodecTrajectoire courant;
+    courant.ids.resize(n);
+    courant.positions.resize(3*n);
+    courant.vitesses.resize(3*n);
+    courant.forces.resize(avecForces ? 3*n : 0);
+    courant.masses.resize(n);
+    courant.categories.resize(n);
+    for(size_t k = 0; k < n; k++){
+        const Particule* particule = particules[k];
+        const Vecteur<double> position = particule->getPosition() - centre;
+        const Vecteur<double>& vitesse = particule->getVitesse();
+        courant.ids[k] = particule->getId();
+        courant.positions[3*k] = std::llround(position.getX() / precision);
+        courant.positions[3*k + 1] = std::llround(position.getY() / precision);
+        courant.positions[3*k + 2] = std::llround(position.getZ() / precision);
+        courant.vitesses[3*k] = std::llround(vitesse.getX() / precision);
+        courant.vitesses[3*k + 1] = std::llround(vitesse.getY() / precision);
+        courant.vitesses[3*k + 2] = std::llround(vitesse.getZ() / precision);
+        if(avecForces){
+            const Vecteur<double>& force = particule->getForce();
+            courant.forces[3*k] = bitsFloat(force.getX());
+            courant.forces[3*k + 1] = bitsFloat(force.getY());
+            courant.forces[3*k + 2] = bitsFloat(force.getZ());
+        }
+        courant.masses[k] = bitsFloat(particule->getMasse());
+        courant.categories[k] = indiceCategorie(particule->getCategorie());
+    }
+
+    /* Une image clé est codée par rapport à un état vide */
+    bool imageCle = !precedentValide || framesDepuisImageCle >= intervalleImagesCles;
+    if(imageCle){
+        precedent = EtatCodecTrajectoire();
+        framesDepuisImageCle = 0;
+    }
+    framesDepuisImageCle++;
+
+    /* Coder les colonnes par différence, l'identifiant par rapport au précédent de la frame */
+    std::vector<char> flux;
+    flux.reserve(4*n);
+    int64_t idPrecedent = 0;
+    for(size_t k = 0; k < n; k++){
+        ajouterVarint(flux, encoderZigzag(courant.ids[k] - idPrecedent));
+        idPrecedent = courant.ids[k];
+    }
+    std::vector<int64_t> correspondances = apparier(courant.ids, precedent.ids);
+    coderDifferences(flux, courant.positions, precedent.positions, correspondances, 3);
+    coderDifferences(flux, courant.vitesses, precedent.vitesses, correspondances, 3);
+    if(avecForces){
+        coderBits(flux, courant.forces, precedent.forces, correspondances, 3);
+    }
+    coderBits(flux, courant.masses, precedent.masses, correspondances, 1);
+    std::vector<int64_t> categories(courant.categories.begin(), courant.categories.end());
+    std::vector<int64_t> categoriesPrecedentes(precedent.categories.begin(), precedent.categories.end());
+    coderDifferences(flux, categories, categoriesPrecedentes, correspondances, 1);
+
+    EnteteCompression enteteCompression;
+    enteteCompression.precision = precision;
+    enteteCompression.imageCle = imageCle;
+    enteteCompression.reserve = 0;
+    enteteCompression.tailleFlux = flux.size();
+    tampon.insert(tampon.end(), reinterpret_cast<const char*>(&enteteCompression), reinterpret_cast<const char*>(&enteteCompression) + sizeof(enteteCompression));
+    tampon.insert(tampon.end(), flux.begin(), flux.end());
+
+    precedent = std::move(courant);
+    precedentValide = true;
+}
+
+/* Constructeur */
+
+LecteurTrajectoire::LecteurTrajectoire(const std::string& adresseFichier) : donnees(nullptr), taille(0), frameDecodee(SIZE_MAX){
+
+    /* Projeter le fichier en mémoire */
+    int descripteur = open(adresseFichier.c_str(), O_RDONLY);
+    if(descripteur < 0){
+        throw std::runtime_error("Erreur lors de l'overture du fichier d'entrée " + adresseFichier);
+    }
+    struct stat info;
+    if(fstat(descripteur, &info) != 0 || static_cast<size_t>(info.st_size) < tailleEnteteFichier){
+        close(descripteur);
+        throw std::invalid_argument("Le fichier " + adresseFichier + " n'est pas un fichier de trajectoire");
+    }
+    taille = info.st_size;
+    void* projection = mmap(nullptr, taille, PROT_READ, MAP_PRIVATE, descripteur, 0);
+    close(descripteur);
+    if(projection == MAP_FAILED){
+        throw std::runtime_error("Erreur lors de la projection du fichier " + adresseFichier);
+    }
+    donnees = static_cast<const char*>(projection);
+
+    /* Vérifier l'en-tête */
+    uint32_t version, marqueur;
+    double longueurs[3];
+    std::memcpy(&version, donnees + sizeof(magieTrajectoire), sizeof(version));
+    std::memcpy(&marqueur, donnees + sizeof(magieTrajectoire) + sizeof(version), sizeof(marqueur));
+    std::memcpy(longueurs, donnees + sizeof(magieTrajectoire) + 2*sizeof(uint32_t), sizeof(longueurs));
+    if(std::memcmp(donnees, magieTrajectoire, sizeof(magieTrajectoire)) != 0 || version != versionTrajectoire || marqueur != marqueurOrdre){
+        munmap(const_cast<char*>(donnees), taille);
+        throw std::invalid_argument("Le fichier " + adresseFichier + " n'est pas un fichier de trajectoire compatible");
+    }
+    ld = Vecteur<double>(longueurs[0], longueurs[1], longueurs[2]);
+
+    /* Lire la table d'index à partir du pied de page, en vérifiant que
+    chaque entrée désigne une frame entière située avant la table */
+    if(taille >= tailleEnteteFichier + sizeof(PiedTrajectoire)){
+        PiedTrajectoire pied;
+        std::memcpy(&pied, donnees + taille - sizeof(pied), sizeof(pied));
+        if(std::memcmp(pied.magie, magieTrajectoire, sizeof(pied.magie)) == 0){
+            const uint64_t place = taille - sizeof(pied) - tailleEnteteFichier;
+            if(pied.nombreFrames > place / sizeof(EntreeIndexTrajectoire) ||
+               pied.positionIndex != taille - sizeof(pied) - pied.nombreFrames * sizeof(EntreeIndexTrajectoire)){
+                munmap(const_cast<char*>(donnees), taille);
+                throw std::invalid_argument("Table d'index du fichier " + adresseFichier + " non valide");
+            }
+            index.resize(pied.nombreFrames);
+            std::memcpy(index.data(), donnees + pied.positionIndex, pied.nombreFrames * sizeof(EntreeIndexTrajectoire));
+            for(const EntreeIndexTrajectoire& entree : index){
+                if(!contientFrame(entree.position, pied.positionIndex)){
+                    munmap(const_cast<char*>(donnees), taille);
+                    throw std::invalid_argument("Table d'index du fichier " + adresseFichier + " non valide");
+                }
+            }
+            return;
+        }
+    }
+
+    /* Sans pied de page valide, parcourir les frames complètes */
+    size_t position = tailleEnteteFichier;
+    while(contientFrame(position, taille)){
+        EnteteFrame entete;
+        std::memcpy(&entete, donnees + position, sizeof(entete));
+        index.push_back({position, entete.iteration, entete.temps});
+        position += sizeof(entete) + entete.tailleDonnees;
+    }
+}
+
+LecteurTrajectoire::~LecteurTrajectoire(){
+    munmap(const_cast<char*>(donnees), taille);
+}
+
+/* Méthodes publiques */
+
+FrameTrajectoire LecteurTrajectoire::lireFrame(size_t k) const{
+    if(k >= index.size()){
+        throw std::out_of_range("Numéro de frame hors limites");
+    }
+
+    EnteteFrame entete;
+    std::memcpy(&entete, donnees + index[k].position, sizeof(entete));
+    if(entete.magie != magieFrame || (entete.codage != codageBrut && entete.codage != codageDelta)){
+        throw std::invalid_argument("Frame de trajectoire non valide");
+    }
+    /* Chaque particule occupe au moins un octet, quel que soit le codage */
+    if(entete.nombreParticules > entete.tailleDonnees){
+        throw std::invalid_argument("Frame de trajectoire tronquée");
+    }
+
+    FrameTrajectoire frame;
+    frame.iteration = entete.iteration;
+    frame.temps = entete.temps;
+    frame.nombreParticules = entete.nombreParticules;
+    frame.champs = entete.champs;
+
+    const uint64_t n = entete.nombreParticules;
+    const char* debut = donnees + index[k].position + sizeof(entete);
+    const char* fin = debut + entete.tailleDonnees;
+    const char* curseur;
+    ColonnesFrame colonnes = calculerColonnes(n, entete.champs);
+
+    if(entete.codage == codageBrut){
+
+        /* Pointer directement vers les colonnes */
+        if(colonnes.table > entete.tailleDonnees){
+            throw std::invalid_argument("Frame de trajectoire tronquée");
+        }
+        curseur = debut;
+        curseur += colonnes.table;
+
+    }else{
+
+        /* Décoder l'état quantifié puis reconstruire les colonnes */
+        EnteteCompression enteteCompression;
+        std::memcpy(&enteteCompression, debut, sizeof(enteteCompression));
+        decoderJusqua(k);
+        if(etat.ids.size() != n){
+            throw std::invalid_argument("Frame de trajectoire compressée incohérente");
+        }
+
+        std::shared_ptr<std::vector<char>> stockage = std::make_shared<std::vector<char>>(colonnes.table);
+        char* colonnesDecodees = stockage->data();
+        const double pas = enteteCompression.precision;
+        for(uint64_t p = 0; p < n; p++){
+            float masse = floatBits(etat.masses[p]);
+            std::memcpy(colonnesDecodees + colonnes.ids + p*sizeof(int64_t), &etat.ids[p], sizeof(int64_t));
+            for(int c = 0; c < 3; c++){
+                float position = etat.positions[3*p + c] * pas;
+                float vitesse = etat.vitesses[3*p + c] * pas;
+                std::memcpy(colonnesDecodees + colonnes.positions + (3*p + c)*sizeof(float), &position, sizeof(float));
+                std::memcpy(colonnesDecodees + colonnes.vitesses + (3*p + c)*sizeof(float), &vitesse, sizeof(float));
+                if(entete.champs & CHAMP_FORCES){
+                    std::memcpy(colonnesDecodees + colonnes.forces + (3*p + c)*sizeof(float), &etat.forces[3*p + c], sizeof(float));
+                }
+            }
+            std::memcpy(colonnesDecodees + colonnes.masses + p*sizeof(float), &masse, sizeof(float));
+            std::memcpy(colonnesDecodees + colonnes.categories + p*sizeof(uint32_t), &etat.categories[p], sizeof(uint32_t));
+        }
+        frame.stockage = stockage;
+        debut = colonnesDecodees;
+        curseur = donnees + index[k].position + sizeof(entete) + sizeof(enteteCompression) + enteteCompression.tailleFlux;
+    }
+
+    frame.ids = reinterpret_cast<const int64_t*>(debut + colonnes.ids);
+    frame.positions = reinterpret_cast<const float*>(debut + colonnes.positions);
+    frame.vitesses = reinterpret_cast<const float*>(debut + colonnes.vitesses);
+    if(entete.champs & CHAMP_FORCES){
+        frame.forces = reinterpret_cast<const float*>(debut + colonnes.forces);
+    }
+    frame.masses = reinterpret_cast<const float*>(debut + colonnes.masses);
+    frame.categories = reinterpret_cast<const uint32_t*>(debut + colonnes.categories);
+
+    /* Lire la table des catégories */
+    for(uint32_t c = 0; c < entete.nombreCategories; c++){
+        uint32_t longueur;
+        if(curseur + sizeof(longueur) > fin){
+            throw std::invalid_argument("Table des catégories tronquée");
+        }
+        std::memcpy(&longueur, curseur, sizeof(longueur));
+        curseur += sizeof(longueur);
+        if(curseur + longueur > fin){
+            throw std::invalid_argument("Table des catégories tronquée");
+        }
+        frame.nomsCategories.emplace_back(curseur, longueur);
+        curseur += longueur;
+    }
+
+    return frame;
+}
+
+uint64_t LecteurTrajectoire::getFinFrame(size_t k) const{
+    EnteteFrame entete;
+    std::memcpy(&entete, donnees + index.at(k).position, sizeof(entete));
+    return index[k].position + sizeof(entete) + entete.tailleDonnees;
+}
+
+/* Méthodes privées */
+
+bool LecteurTrajectoire::contientFrame(uint64_t position, uint64_t limite) const{
+    if(position < tailleEnteteFichier || position > limite || limite - position < sizeof(EnteteFrame)){
+        return false;
+    }
+    EnteteFrame entete;
+    std::memcpy(&entete, donnees + position, sizeof(entete));
+    return entete.magie == magieFrame && entete.tailleDonnees <= limite - position - sizeof(entete) &&
+           (entete.codage != codageDelta || entete.tailleDonnees >= sizeof(EnteteCompression));
+}
+
+void LecteurTrajectoire::decoderJusqua(size_t k) const{
+    if(frameDecodee == k){
+        return;
+    }
+
+    /* Remonter jusqu'à une image clé ou jusqu'à la dernière frame décodée */
+    size_t depart = k;
+    bool depuisEtat = false;
+    while(true){
+        if(frameDecodee != SIZE_MAX && depart == frameDecodee && depart < k){
+            depuisEtat = true;
+            depart++;
+            break;
+        }
+        EnteteFrame entete;
+        EnteteCompression enteteCompression;
+        std::memcpy(&entete, donnees + index[depart].position, sizeof(entete));
+        std::memcpy(&enteteCompression, donnees + index[depart].position + sizeof(entete), sizeof(enteteCompression));
+        if(entete.codage != codageDelta){
+            throw std::invalid_argument("Frame compressée sans image clé");
+        }
+        if(enteteCompression.imageCle){
+            break;
+        }
+        if(depart == 0){
+            throw std::invalid_argument("Frame compressée sans image clé");
+        }
+        depart--;
+    }
+    if(!depuisEtat){
+        etat = EtatCodecTrajectoire();
+    }
+    frameDecodee = SIZE_MAX;
+
+    /* Décoder les frames successives */
+    for(size_t j = depart; j <= k; j++){
+        EnteteFrame entete;
+        EnteteCompression enteteCompression;
+        const char* debut = donnees + index[j].position;
+        std::memcpy(&entete, debut, sizeof(entete));
+        std::memcpy(&enteteCompression, debut + sizeof(entete), sizeof(enteteCompression));
+        /* Chaque identifiant occupe au moins un octet du flux */
+        if(enteteCompression.tailleFlux > entete.tailleDonnees - sizeof(enteteCompression) ||
+           entete.nombreParticules > enteteCompression.tailleFlux){
+            throw std::invalid_argument("Frame de trajectoire tronquée");
+        }
+        const char* curseur = debut + sizeof(entete) + sizeof(enteteCompression);
+        const char* fin = curseur + enteteCompression.tailleFlux;
+
+        const EtatCodecTrajectoire vide;
+        const EtatCodecTrajectoire& precedent = enteteCompression.imageCle ? vide : etat;
+        const uint64_t n = entete.nombreParticules;
+        EtatCodecTrajectoire courant;
+        courant.ids.resize(n);
+        int64_t idPrecedent = 0;
+        for(uint64_t p = 0; p < n; p++){
+            idPrecedent += decoderZigzag(lireVarint(curseur, fin));
+            courant.ids[p] = idPrecedent;
+        }
+        std::vector<int64_t> correspondances = apparier(courant.ids, precedent.ids);
+        decoderDifferences(curseur, fin, courant.positions, precedent.positions, correspondances, 3);
+        decoderDifferences(curseur, fin, courant.vitesses, precedent.vitesses, correspondances, 3);
+        if(entete.champs & CHAMP_FORCES){
+            decoderBits(curseur, fin, courant.forces, precedent.forces, correspondances, 3);
+        }
+        decoderBits(curseur, fin, courant.masses, precedent.masses, correspondances, 1);
+        std::vector<int64_t> categories;
+        std::vector<int64_t> categoriesPrecedentes(precedent.categories.begin(), precedent.categories.end());
+        decoderDifferences(curseur, fin, categories, categoriesPrecedentes, correspondances, 1);
+        courant.categories.assign(categories.begin(), categories.end());
+
+        etat = std::move(courant);
+    }
+    frameDecodee = k;
+}
+
+/* Getters */
+
+size_t LecteurTrajectoire::getNombreFrames() const{
+    return index.size();
+}
+
+const std::vector<EntreeIndexTrajectoire>& LecteurTrajectoire::getIndex() const{
+    return index;
+}
+
+const Vecteur<double>& LecteurTrajectoire::getLd() const{
+    return ld;
+}
+
+/* Conversion */
+
+void sauvegarderFrameEnVTU(const std::string& adresseFichier, const FrameTrajectoire& frame){
+    std::ofstream fichierVTU = ouvrirFichierDeSortie(adresseFichier);
+    const uint64_t n = frame.nombreParticules;
+
+    fichierVTU << "<VTKFile type=\"UnstructuredGrid\" version=\"0.1\" byte_order=\"BigEndian\">\n";
+    fichierVTU << "  <UnstructuredGrid>\n";
+    fichierVTU << "    <Piece NumberOfPoints=\"" << n << "\" NumberOfCells=\"0\">\n";
+    fichierVTU << "      <Points>\n";
+    fichierVTU << "        <DataArray name=\"Position\" type=\"Float32\" NumberOfComponents=\"3\" format=\"ascii\">\n";
+    fichierVTU << "          ";
+    for(uint64_t k = 0; k < 3*n; k++){
+        fichierVTU << frame.positions[k] << " ";
+    }
+    fichierVTU << "\n";
+    fichierVTU << "        </DataArray>\n";
+    fichierVTU << "      </Points>\n";
+    fichierVTU << "      <PointData Vectors=\"vector\">\n";
+    fichierVTU << "        <DataArray type=\"Float32\" Name=\"Velocity\" NumberOfComponents=\"3\" format=\"ascii\">\n";
+    fichierVTU << "          ";
+    for(uint64_t k = 0; k < 3*n; k++){
+        fichierVTU << frame.vitesses[k] << " ";
+    }
+    fichierVTU << "\n";
+    fichierVTU << "        </DataArray>\n";
+    if(frame.forces != nullptr){
+        fichierVTU << "        <DataArray type=\"Float32\" Name=\"Force\" NumberOfComponents=\"3\" format=\"ascii\">\n";
+        fichierVTU << "          ";
+        for(uint64_t k = 0; k < 3*n; k++){
+            fichierVTU << frame.forces[k] << " ";
+        }
+        fichierVTU << "\n";
+        fichierVTU << "        </DataArray>\n";
+    }
+    fichierVTU << "        <DataArray type=\"Float32\" Name=\"Masse\" format=\"ascii\">\n";
+    fichierVTU << "          ";
+    for(uint64_t k = 0; k < n; k++){
+        fichierVTU << frame.masses[k] << " ";
+    }
+    fichierVTU << "\n";
+    fichierVTU << "        </DataArray>\n";
+    fichierVTU << "        <DataArray type=\"Int32\" Name=\"Categorie\" format=\"ascii\">\n";
+    fichierVTU << "          ";
+    for(uint64_t k = 0; k < n; k++){
+        fichierVTU << frame.categories[k] << " ";
+    }
+    fichierVTU << "\n";
+    fichierVTU << "        </DataArray>\n";
+    fichierVTU << "        <DataArray type=\"Int64\" Name=\"Id\" format=\"ascii\">\n";
+    fichierVTU << "          ";
+    for(uint64_t k = 0; k < n; k++){
+        fichierVTU << frame.ids[k] << " ";
+    }
+    fichierVTU << "\n";
+    fichierVTU << "        </DataArray>\n";
+    fichierVTU << "      </PointData>\n";
+    fichierVTU << "      <Cells>\n";
+    fichierVTU << "        <DataArray type=\"Int32\" Name=\"connectivity\" format=\"ascii\">\n";
+    fichierVTU << "        </DataArray>\n";
+    fichierVTU << "        <DataArray type=\"Int32\" Name=\"offsets\" format=\"ascii\">\n";
+    fichierVTU << "        </DataArray>\n";
+    fichierVTU << "        <DataArray type=\"UInt8\" Name=\"types\" format=\"ascii\">\n";
+    fichierVTU << "        </DataArray>\n";
+    fichierVTU << "      </Cells>\n";
+    fichierVTU << "    </Piece>\n";
+    fichierVTU << "  </UnstructuredGrid>\n";
+    fichierVTU << "</VTKFile>\n";
+
+    fichierVTU.close();
+}
+
+void convertirTrajectoireEnVTU(const std::string& adresseTrajectoire, const std::string& nomDossier){
+    LecteurTrajectoire lecteur(adresseTrajectoire);
+    creerDossier(nomDossier);
+    for(size_t k = 0; k < lecteur.getNombreFrames(); k++){
+        FrameTrajectoire frame = lecteur.lireFrame(k);
+        sauvegarderFrameEnVTU(nomDossier + "/Iteration." + std::to_string(frame.iteration) + ".vtu", frame);
+    }
+}
@@ -0,0 +1,350 @@
+#include "parois.hxx"
+#include <algorithm>
+#include <limits>
+#include <sstream>
+#include <stdexcept>
+#include "fichier.hxx"
+
+/* Constructeur */
+
+ChampDistance::ChampDistance(const Vecteur<int>& dimensions, const Vecteur<double>& origine, double pas, std::vector<float> distances) :
+    dimensions(dimensions), origine(origine), pas(pas), distances(std::move(distances))
+{
+    if(dimensions.getX() <= 0 || dimensions.getY() <= 0 || dimensions.getZ() <= 0 || pas <= 0){
+        throw std::invalid_argument("Dimensions ou pas du champ de distance non valides");
+    }
+    if(this->distances.size() != static_cast<size_t>(dimensions.getX()) * dimensions.getY() * dimensions.getZ()){
+        throw std::invalid_argument("Nombre de distances différent des dimensions du champ de distance");
+    }
+    calculerNormales();
+}
+
+/* Méthodes privées */
+
+void ChampDistance::calculerNormales(){
+    const int nx = dimensions.getX();
+    const int ny = dimensions.getY();
+    const int nz = dimensions.getZ();
+    normales.resize(distances.size());
+
+    /* Dérivée selon un axe par différence centrée, décentrée sur les bords, nulle si l'axe n'a qu'un point */
+    auto deriver = [this](int i, int n, size_t indice, size_t saut){
+        if(n == 1){
+            return 0.0;
+        }
+        size_t avant = (i > 0) ? indice - saut : indice;
+        size_t apres = (i < n - 1) ? indice + saut : indice;
+        return static_cast<double>(distances[apres] - distances[avant]) / ((apres - avant) / saut * pas);
+    };
+
+    for(int x = 0; x < nx; x++){
+        for(int y = 0; y < ny; y++){
+            for(int z = 0; z < nz; z++){
+                size_t indice = (static_cast<size_t>(x)*ny + y)*nz + z;
+                Vecteur<double> gradient(deriver(x, nx, indice, static_cast<size_t>(ny)*nz), deriver(y, ny, indice, nz), deriver(z, nz, indice, 1));
+                double norme = gradient.norme();
+                normales[indice] = (norme > 0) ? gradient / norme : Vecteur<double>();
+            }
+        }
+    }
+}
+
+/* Méthodes publiques */
+
+bool ChampDistance::mesurer(const Vecteur<double>& position, double& distance, Vecteur<double>& normale) const{
+    const int n[3] = {dimensions.getX(), dimensions.getY(), dimensions.getZ()};
+    const double u[3] = {(position.getX() - origine.getX()) / pas,
+                         (position.getY() - origine.getY()) / pas,
+                         (position.getZ() - origine.getZ()) / pas};
+
+    /* Repérer la maille et les poids d'interpolation selon chaque axe */
+    int i0[3];
+    double t[3];
+    for(int a = 0; a < 3; a++){
+        if(n[a] == 1){
+            i0[a] = 0;
+            t[a] = 0;
+            continue;
+        }
+        if(u[a] < 0 || u[a] > n[a] - 1){
+            return false;
+        }
+        i0[a] = std::min(static_cast<int>(u[a]), n[a] - 2);
+        t[a] = u[a] - i0[a];
+    }
+
+    /* Interpoler la distance et la normale sur les huit coins de la maille */
+    distance = 0;
+    normale = Vecteur<double>();
+    for(int coin = 0; coin < 8; coin++){
+        int d[3] = {(coin >> 2) & 1, (coin >> 1) & 1, coin & 1};
+        double poids = 1;
+        for(int a = 0; a < 3; a++){
+            if(d[a] && n[a] == 1){
+                poids = 0;
+            }
+            poids *= d[a] ? t[a] : 1 - t[a];
+        }
+        if(poids == 0){
+            continue;
+        }
+        size_t indice = (static_cast<size_t>(i0[0] + d[0])*n[1] + (i0[1] + d[1]))*n[2] + (i0[2] + d[2]);
+        distance += poids * distances[indice];
+        normale += normales[indice] * poids;
+    }
+
+    /* Renormaliser la normale interpolée */
+    double norme = normale.norme();
+    if(norme > 0){
+        normale = normale / norme;
+    }
+    return true;
+}
+
+size_t ChampDistance::getOctets() const{
+    return distances.capacity() * sizeof(float) + normales.capacity() * sizeof(Vecteur<float>);
+}
+
+/* Constructeur */
+
+Obstacle::Obstacle(TypeObstacle type) : type(type), rayon(0) {}
+
+/* Méthodes publiques */
+
+Obstacle Obstacle::creerPlan(const Vecteur<double>& point, const Vecteur<double>& normale){
+    double norme = normale.norme();
+    if(norme == 0){
+        throw std::invalid_argument("Normale du plan nulle");
+    }
+    Obstacle obstacle(TypeObstacle::Plan);
+    obstacle.a = point;
+    obstacle.b = normale / norme;
+    return obstacle;
+}
+
+Obstacle Obstacle::creerSphere(const Vecteur<double>& centre, double rayon){
+    if(rayon <= 0){
+        throw std::invalid_argument("Rayon de la sphère non positif");
+    }
+    Obstacle obstacle(TypeObstacle::Sphere);
+    obstacle.a = centre;
+    obstacle.rayon = rayon;
+    return obstacle;
+}
+
+Obstacle Obstacle::creerBoite(const Vecteur<double>& minimum, const Vecteur<double>& maximum){
+    if(maximum.getX() < minimum.getX() || maximum.getY() < minimum.getY() || maximum.getZ() < minimum.getZ()){
+        throw std::invalid_argument("Coins de la boîte inversés");
+    }
+    Obstacle obstacle(TypeObstacle::Boite);
+    obstacle.a = minimum;
+    obstacle.b = maximum;
+    return obstacle;
+}
+
+Obstacle Obstacle::creerChamp(std::shared_ptr<const ChampDistance> champ){
+    Obstacle obstacle(TypeObstacle::Champ);
+    obstacle.champ = std::move(champ);
+    return obstacle;
+}
+
+bool Obstacle::mesurer(const Vecteur<double>& position, double& distance, Vecteur<double>& normale) const{
+    switch(type){
+        case TypeObstacle::Plan:{
+            const Vecteur<double> v = position - a;
+            distance = v.getX()*b.getX() + v.getY()*b.getY() + v.getZ()*b.getZ();
+            normale = b;
+            return true;
+        }
+        case TypeObstacle::Sphere:{
+            const Vecteur<double> v = position - a;
+            double norme = v.norme();
+            distance = norme - rayon;
+            normale = (norme > 0) ? v / norme : Vecteur<double>(0, 1, 0);
+            return true;
+        }
+        case TypeObstacle::Boite:{
+
+            /* Écart à chaque paire de faces, positif à l'extérieur */
+            const double p[3] = {position.getX(), position.getY(), position.getZ()};
+            const double mini[3] = {a.getX(), a.getY(), a.getZ()};
+            const double maxi[3] = {b.getX(), b.getY(), b.getZ()};
+            double q[3], signe[3];
+            for(int k = 0; k < 3; k++){
+                double centre = (mini[k] + maxi[k]) / 2;
+                signe[k] = (p[k] >= centre) ? 1 : -1;
+                q[k] = std::abs(p[k] - centre) - (maxi[k] - mini[k]) / 2;
+            }
+
+            /* À l'extérieur, distance au point le plus proche de la boîte */
+            double dehors[3] = {std::max(q[0], 0.0), std::max(q[1], 0.0), std::max(q[2], 0.0)};
+            double norme = std::sqrt(dehors[0]*dehors[0] + dehors[1]*dehors[1] + dehors[2]*dehors[2]);
+            if(norme > 0){
+                distance = norme;
+                normale = Vecteur<double>(signe[0]*dehors[0], signe[1]*dehors[1], signe[2]*dehors[2]) / norme;
+                return true;
+            }
+
+            /* À l'intérieur, distance négative à la face la plus proche */
+            int axe = 0;
+            for(int k = 1; k < 3; k++){
+                if(q[k] > q[axe]){
+                    axe = k;
+                }
+            }
+            double composantes[3] = {0, 0, 0};
+            composantes[axe] = signe[axe];
+            distance = q[axe];
+            normale = Vecteur<double>(composantes[0], composantes[1], composantes[2]);
+            return true;
+        }
+        case TypeObstacle::Champ:
+            return champ->mesurer(position, distance, normale);
+    }
+    return false;
+}
+
+TypeObstacle Obstacle::getType() const{
+    return type;
+}
+
+size_t Obstacle::getOctets() const{
+    return champ ? champ->getOctets() : 0;
+}
+
+/* Constructeur */
+
+Parois::Parois() : portee(0), debuts(1, 0) {}
+
+/* Méthodes publiques */
+
+void Parois::ajouterObstacle(const Obstacle& obstacle){
+    if(obstacles.size() > std::numeric_limits<uint16_t>::max()){
+        throw std::length_error("Trop d'obstacles");
+    }
+    obstacles.push_back(obstacle);
+}
+
+void Parois::lireFichier(const std::string& adresseFichier, const Vecteur<double>& decalage){
+    std::ifstream fichier = ouvrirFichierDEntree(adresseFichier);
+    std::string ligne;
+    int numero = 0;
+    while(std::getline(fichier, ligne)){
+        numero++;
+        std::istringstream flux(ligne);
+        std::string type;
+        if(!(flux >> type) || type[0] == '#'){
+            continue;
+        }
+
+        std::string contexte = adresseFichier + ", ligne " + std::to_string(numero);
+        double v[6];
+        auto lireValeurs = [&](int n){
+            for(int k = 0; k < n; k++){
+                if(!(flux >> v[k])){
+                    throw std::invalid_argument("Valeurs manquantes pour l'obstacle " + type + " (" + contexte + ")");
+                }
+            }
+        };
+
+        if(type == "PLAN"){
+            lireValeurs(6);
+            ajouterObstacle(Obstacle::creerPlan(Vecteur<double>(v[0], v[1], v[2]) + decalage, Vecteur<double>(v[3], v[4], v[5])));
+        }else if(type == "SPHERE"){
+            lireValeurs(4);
+            ajouterObstacle(Obstacle::creerSphere(Vecteur<double>(v[0], v[1], v[2]) + decalage, v[3]));
+        }else if(type == "BOITE"){
+            lireValeurs(6);
+            ajouterObstacle(Obstacle::creerBoite(Vecteur<double>(v[0], v[1], v[2]) + decalage, Vecteur<double>(v[3], v[4], v[5]) + decalage));
+        }else if(type == "CHAMP"){
+            std::string adresseChamp;
+            if(!(flux >> adresseChamp)){
+                throw std::invalid_argument("Adresse du champ de distance manquante (" + contexte + ")");
+            }
+            ajouterObstacle(Obstacle::creerChamp(lireChampDistance(adresseChamp, decalage)));
+        }else{
+            throw std::invalid_argument("Type d'obstacle inconnu : " + type + " (" + contexte + ")");
+        }
+    }
+}
+
+void Parois::indexerCellules(const Vecteur<int>& nc, const Vecteur<double>& tailleCellule, double portee){
+    this->portee = portee;
+    cellulesProches.clear();
+    debuts.assign(1, 0);
+    indicesObstacles.clear();
+    if(obstacles.empty()){
+        return;
+    }
+
+    /* Un axe de longueur nulle, de taille nulle, est réduit au plan 0 */
+    const double demiCote[3] = {tailleCellule.getX() / 2, tailleCellule.getY() / 2, tailleCellule.getZ() / 2};
+    const double demiDiagonale = std::sqrt(demiCote[0]*demiCote[0] + demiCote[1]*demiCote[1] + demiCote[2]*demiCote[2]);
+
+    double distance;
+    Vecteur<double> normale;
+    for(int x = 0; x < nc.getX(); x++){
+        for(int y = 0; y < nc.getY(); y++){
+            for(int z = 0; z < nc.getZ(); z++){
+                Vecteur<double> centre((2*x + 1) * demiCote[0], (2*y + 1) * demiCote[1], (2*z + 1) * demiCote[2]);
+                size_t debut = indicesObstacles.size();
+                for(size_t o = 0; o < obstacles.size(); o++){
+
+                    /* Une distance signée varie au plus comme la position : la cellule
+                    est à portée si son centre est à moins de portee + demiDiagonale,
+                    sans être entièrement à l'intérieur de l'obstacle */
+                    if(obstacles[o].mesurer(centre, distance, normale) && distance < portee + demiDiagonale && distance > -demiDiagonale){
+                        indicesObstacles.push_back(o);
+                    }
+                }
+                if(indicesObstacles.size() > debut){
+                    cellulesProches.push_back(x*nc.getY()*nc.getZ() + y*nc.getZ() + z);
+                    debuts.push_back(indicesObstacles.size());
+                }
+            }
+        }
+    }
+    cellulesProches.shrink_to_fit();
+    debuts.shrink_to_fit();
+    indicesObstacles.shrink_to_fit();
+}
+
+size_t Parois::getOctets() const{
+    size_t octets = obstacles.capacity() * sizeof(Obstacle) + cellulesProches.capacity() * sizeof(int) +
+                    debuts.capacity() * sizeof(uint32_t) + indicesObstacles.capacity() * sizeof(uint16_t);
+    for(const auto& obstacle : obstacles){
+        octets += obstacle.getOctets();
+    }
+    return octets;
+}
+
+/* Getters */
+
+const std::vector<Obstacle>& Parois::getObstacles() const{
+    return obstacles;
+}
+
+const std::vector<int>& Parois::getCellulesProches() const{
+    return cellulesProches;
+}
+
+/* Fonctions */
+
+std::shared_ptr<const ChampDistance> lireChampDistance(const std::string& adresseFichier, const Vecteur<double>& decalage){
+    std::ifstream fichier = ouvrirFichierDEntree(adresseFichier);
+    int nx, ny, nz;
+    double ox, oy, oz, pas;
+    if(!(fichier >> nx >> ny >> nz >> ox >> oy >> oz >> pas)){
+        throw std::invalid_argument("En-tête du champ de distance mal formé : " + adresseFichier);
+    }
+    if(nx <= 0 || ny <= 0 || nz <= 0){
+        throw std::invalid_argument("Dimensions du champ de distance non valides : " + adresseFichier);
+    }
+    std::vector<float> distances(static_cast<size_t>(nx) * ny * nz);
+    for(auto& distance : distances){
+        if(!(fichier >> distance)){
+            throw std::invalid_argument("Distances manquantes dans le champ de distance : " + adresseFichier);
+        }
+    }
+    return std::make_shared<const ChampDistance>(Vecteur<int>(nx, ny, nz), Vecteur<double>(ox, oy, oz) + decalage, pas, std::move(distances));
+}
@@ -1,21 +1,94 @@
 #include "particule.hxx"
+#include <atomic>
+#include <limits>
+#include <mutex>
+#include <stdexcept>
+#include <unordered_map>
+
+/**
+* @brief 
+* Structure regroupant la table des catégories partagée par toutes
+* les particules. Les noms sont stockés par blocs de taille fixe qui
+* ne sont jamais déplacés : seule l'insertion prend le verrou, et un
+* nom est lu sans verrou à partir de son indice, le nombre de noms
+* étant publié de façon atomique après leur écriture.
+*/
+
+struct TableCategories{
+    static constexpr size_t tailleBloc = 256; /**< Nombre de noms par bloc. */
+    static constexpr size_t nombreBlocs = (std::numeric_limits<uint16_t>::max() + 1) / tailleBloc; /**< Nombre maximal de blocs. */
+
+    std::mutex verrou; /**< Verrou protégeant les insertions. */
+    std::atomic<std::string*> blocs[nombreBlocs] = {}; /**< Blocs de noms, alloués à la demande. */
+    std::atomic<size_t> nombre{0}; /**< Nombre de noms publiés. */
+    std::unordered_map<std::string, uint16_t> indices; /**< Indices des catégories déjà rencontrées, protégés par le verrou. */
+
+    TableCategories(){
+        inserer("N/A");
+    }
 
-int Particule::nextId = 1;
+    ~TableCategories(){
+        for(auto& bloc : blocs){
+            delete[] bloc.load(std::memory_order_relaxed);
+        }
+    }
+
+    /* Ajouter un nom, le verrou étant pris ou la table pas encore partagée */
+    uint16_t inserer(const std::string& nom){
+        size_t indice = nombre.load(std::memory_order_relaxed);
+        if(indice / tailleBloc >= nombreBlocs){
+            throw std::length_error("Trop de catégories de particules");
+        }
+        std::string* bloc = blocs[indice / tailleBloc].load(std::memory_order_relaxed);
+        if(bloc == nullptr){
+            bloc = new std::string[tailleBloc];
+            blocs[indice / tailleBloc].store(bloc, std::memory_order_relaxed);
+        }
+        bloc[indice % tailleBloc] = nom;
+        indices.emplace(nom, indice);
+        nombre.store(indice + 1, std::memory_order_release);
+        return indice;
+    }
+
+    /* Lire un nom publié, sans verrou */
+    const std::string& lire(uint16_t indice) const{
+        if(indice >= nombre.load(std::memory_order_acquire)){
+            throw std::out_of_range("Indice de catégorie inconnu");
+        }
+        return blocs[indice / tailleBloc].load(std::memory_order_relaxed)[indice % tailleBloc];
+    }
+};
+
+static TableCategories& getTableCategories(){
+    static TableCategories table;
+    return table;
+}
 
 /* Constructeur */
 
 Particule::Particule(double posX, double posY, double posZ) :
-    id(nextId++), categorie("N/A"), 
-    position(posX, posY, posZ), 
-    masse(1.0)
+    id(0), position(posX, posY, posZ), 
+    masse(1.0), categorie(0), celluleConfirmee(false)
 {}
 
 Particule::Particule(std::string categorie, double posX, double posY, double posZ, 
                                 double vitX, double vitY, double vitZ, double masse) :
-    id(nextId++), categorie(categorie), position(posX, posY, posZ), 
-    vitesse(vitX, vitY, vitZ), masse(masse)
+    id(0), position(posX, posY, posZ), vitesse(vitX, vitY, vitZ), 
+    masse(masse), categorie(indexerCategorie(categorie)), celluleConfirmee(false)
 {}
 
+/* Méthodes privées */
+
+uint16_t Particule::indexerCategorie(const std::string& nom){
+    TableCategories& table = getTableCategories();
+    std::lock_guard<std::mutex> verrou(table.verrou);
+    auto it = table.indices.find(nom);
+    if(it != table.indices.end()){
+        return it->second;
+    }
+    return table.inserer(nom);
+}
+
 /* Méthodes publiques */
 
 void Particule::deplacer(const Vecteur<double>& vec){
@@ -28,7 +101,7 @@ void Particule::accelerer(const Vecteur<double>& vec){
 
 /* Getters */
 
-int Particule::getId() const{
+IdentifiantParticule Particule::getId() const{
     return id;
 }
 
@@ -37,32 +110,28 @@ bool Particule::isCelluleConfirmee() const{
 }
 
 const std::string& Particule::getCategorie() const{
-    return categorie;
+    return getTableCategories().lire(categorie);
 }
 
 const Vecteur<double>& Particule::getPosition() const{
     return position;
 }
 
-const Vecteur<double>& Particule::getVitesse() const{
+VecteurParticule Particule::getVitesse() const{
     return vitesse;
 }
 
-const Vecteur<double>& Particule::getForce() const{
+VecteurParticule Particule::getForce() const{
     return force;
 }
 
-const Vecteur<double>& Particule::getFold() const{
-    return Fold;
-}
-
 double Particule::getMasse() const{
     return masse;
 }
 
 /* Setters */
 
-void Particule::setId(int newId){
+void Particule::setId(IdentifiantParticule newId){
     id = newId;
 }
 
@@ -70,6 +139,10 @@ void Particule::setCelluleConfirmee(bool newCelluleConfirmee){
     celluleConfirmee = newCelluleConfirmee;
 }
 
+void Particule::setCategorie(const std::string& newCategorie){
+    categorie = indexerCategorie(newCategorie);
+}
+
 void Particule::setPosition(const Vecteur<double>& newPosition){
     position = newPosition;
 }
@@ -82,10 +155,6 @@ void Particule::setForce(const Vecteur<double>& newForce){
     force = newForce;
 }
 
-void Particule::setFold(const Vecteur<double>& newFold){
-    Fold = newFold;
-}
-
 void Particule::setMasse(double newMasse){
     masse = newMasse;
 }
@@ -0,0 +1,101 @@
+#include "scenarios.hxx"
+#include <cmath>
+#include <stdexcept>
+
+/* Carré de k x k particules tombant sur un rectangle de 4k x k particules
+au repos, à l'échelle k/40 du fichier colision1.vtu */
+static DescriptionScenario genererCarreSurRectangle(int nombreParticules){
+    DescriptionScenario description;
+    int k = std::max(1, static_cast<int>(std::lround(std::sqrt(nombreParticules / 5.0))));
+    double echelle = k / 40.0;
+    double distance = std::pow(2, 1.0/6);
+
+    description.ld = Vecteur<double>(std::max(250 * echelle, 5.0), std::max(130 * echelle, 5.0), 0);
+    description.conditionLimite = ConditionLimite::Absorption;
+    description.forcePG = false;
+    description.particules.reserve(5 * k * k);
+
+    double xCarre = -distance * k / 2;
+    double yCarre = 8 * echelle;
+    for(int i = 0; i < k; i++){
+        for(int j = 0; j < k; j++){
+            description.particules.emplace_back("carre", xCarre + i*distance, yCarre + j*distance, 0, 0,-10,0, 1);
+        }
+    }
+
+    double xRectangle = -distance * 2 * k;
+    double yRectangle = -distance * k + 4 * echelle;
+    for(int i = 0; i < 4 * k; i++){
+        for(int j = 0; j < k; j++){
+            description.particules.emplace_back("rectangle", xRectangle + i*distance, yRectangle + j*distance, 0, 0,0,0, 1);
+        }
+    }
+    return description;
+}
+
+/* Disque de particules de masse 10 en anneaux concentriques tombant sur
+une dalle, à l'échelle du fichier colision2.vtu (407 + 312 x 55 particules) */
+static DescriptionScenario genererDisqueSurDalle(int nombreParticules){
+    DescriptionScenario description;
+    double echelle = std::sqrt(nombreParticules / 17567.0);
+
+    description.ld = Vecteur<double>(std::max(250 * echelle, 5.0), std::max(180 * echelle, 5.0), 0);
+    description.conditionLimite = ConditionLimite::Reflexion;
+    description.forcePG = true;
+
+    /* Ajouter un anneau de six particules de plus que le précédent tous les 1.2 */
+    double yDisque = 20 * echelle;
+    double rayon = 13 * echelle;
+    double angleDecalage = 0;
+    int nombreParticulesParCercle = 1;
+    for(double j = 1; j < rayon; j += 1.2){
+        nombreParticulesParCercle += 6;
+        double angle = 2 * M_PI / nombreParticulesParCercle;
+        for(int i = 0; i < nombreParticulesParCercle; i++){
+            description.particules.emplace_back("disque", j * cos(angle*i + angleDecalage), yDisque + j * sin(angle*i + angleDecalage), 0, 0,-10,0, 10);
+        }
+        angleDecalage = angle;
+    }
+
+    double distance = 0.8;
+    int colonnes = std::max(1, static_cast<int>(std::lround(312 * echelle)));
+    int lignes = std::max(1, static_cast<int>(std::lround(55 * echelle)));
+    double xDalle = -distance * colonnes / 2;
+    double yDalle = -90 * echelle + distance;
+    for(int i = 0; i < colonnes; i++){
+        for(int j = 0; j < lignes; j++){
+            description.particules.emplace_back("dalle", xDalle + i*distance, yDalle + j*distance, 0, 0,0,0, 1);
+        }
+    }
+    return description;
+}
+
+Scenario lireScenario(const std::string& nom){
+    if(nom == "carre"){
+        return Scenario::CarreSurRectangle;
+    }else if(nom == "disque"){
+        return Scenario::DisqueSurDalle;
+    }
+    throw std::invalid_argument("Scénario inconnu : " + nom);
+}
+
+std::string getNomScenario(Scenario scenario){
+    return scenario == Scenario::CarreSurRectangle ? "carre" : "disque";
+}
+
+DescriptionScenario genererScenario(Scenario scenario, int nombreParticules){
+    if(nombreParticules <= 0){
+        throw std::invalid_argument("Le nombre de particules du scénario doit être positif");
+    }
+    if(scenario == Scenario::CarreSurRectangle){
+        return genererCarreSurRectangle(nombreParticules);
+    }
+    return genererDisqueSurDalle(nombreParticules);
+}
+
+void configurerScenario(const DescriptionScenario& description){
+    Configuration& configuration = Configuration::getInstance();
+    configuration.setLd(description.ld.getX(), description.ld.getY(), description.ld.getZ());
+    configuration.setConditionLimite(description.conditionLimite);
+    configuration.setForces(true, false, description.forcePG);
+}
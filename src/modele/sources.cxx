@@ -0,0 +1,107 @@
+#include "sources.hxx"
+#include <cmath>
+#include <sstream>
+#include <stdexcept>
+#include "fichier.hxx"
+
+/* Constructeur */
+
+Sources::Sources(const Vecteur<double>& ld, double distanceFace, uint64_t graine) : ld(ld), distanceFace(distanceFace), philox(graine){}
+
+/* Méthodes publiques */
+
+void Sources::ajouterSource(const Source& source){
+    if(source.debit < 0){
+        throw std::invalid_argument("Débit de source négatif");
+    }
+    int axe = static_cast<int>(source.face) / 2;
+    double longueur = axe == 0 ? ld.getX() : (axe == 1 ? ld.getY() : ld.getZ());
+    if(longueur <= distanceFace){
+        throw std::invalid_argument("Source sur une face d'un axe de longueur nulle");
+    }
+    sources.push_back(source);
+}
+
+void Sources::lireFichier(const std::string& adresseFichier){
+    std::ifstream fichier = ouvrirFichierDEntree(adresseFichier);
+    std::string ligne;
+    int numero = 0;
+    while(std::getline(fichier, ligne)){
+        numero++;
+        std::istringstream flux(ligne);
+        std::string type;
+        if(!(flux >> type) || type[0] == '#'){
+            continue;
+        }
+
+        std::string contexte = adresseFichier + ", ligne " + std::to_string(numero);
+        if(type != "SOURCE"){
+            throw std::invalid_argument("Type de source inconnu : " + type + " (" + contexte + ")");
+        }
+
+        std::string face;
+        Source source{FaceSource::XMin, 0, Vecteur<double>(), 1, "N/A"};
+        double vx, vy, vz;
+        if(!(flux >> face >> source.debit >> vx >> vy >> vz)){
+            throw std::invalid_argument("Valeurs manquantes pour la source (" + contexte + ")");
+        }
+        source.vitesse = Vecteur<double>(vx, vy, vz);
+        if(flux >> source.masse){
+            flux >> source.categorie;
+        }
+
+        const char* faces[] = {"X-", "X+", "Y-", "Y+", "Z-", "Z+"};
+        int indiceFace = 0;
+        while(indiceFace < 6 && face != faces[indiceFace]){
+            indiceFace++;
+        }
+        if(indiceFace == 6){
+            throw std::invalid_argument("Face inconnue : " + face + " (" + contexte + ")");
+        }
+        source.face = static_cast<FaceSource>(indiceFace);
+
+        try{
+            ajouterSource(source);
+        }catch(const std::invalid_argument& erreur){
+            throw std::invalid_argument(std::string(erreur.what()) + " (" + contexte + ")");
+        }
+    }
+}
+
+int64_t Sources::injecter(Univers& univers, int iteration, double delta) const{
+    int64_t injectees = 0;
+    for(const Source& source : sources){
+        int64_t n = static_cast<int64_t>(std::floor(source.debit * delta * (iteration + 1))) -
+                    static_cast<int64_t>(std::floor(source.debit * delta * iteration));
+        int axe = static_cast<int>(source.face) / 2;
+        bool maximum = static_cast<int>(source.face) % 2 == 1;
+        for(int64_t k = 0; k < n; k++){
+
+            /* Tirer la position sur la face à partir de l'identifiant de la particule */
+            IdentifiantParticule id = univers.getProchainId();
+            std::array<double, 2> u = philox.uniformes(id, 4);
+            double coordonnees[3];
+            int tirage = 0;
+            for(int a = 0; a < 3; a++){
+                double longueur = a == 0 ? ld.getX() : (a == 1 ? ld.getY() : ld.getZ());
+                if(a == axe){
+                    coordonnees[a] = maximum ? longueur - distanceFace : distanceFace;
+                }else{
+                    coordonnees[a] = u[tirage++] * longueur;
+                }
+            }
+
+            Particule particule(source.categorie, coordonnees[0], coordonnees[1], coordonnees[2],
+                                source.vitesse.getX(), source.vitesse.getY(), source.vitesse.getZ(), source.masse);
+            particule.setId(id);
+            injectees += univers.injecterParticule(particule);
+        }
+    }
+    return injectees;
+}
+
+/* Getters */
+
+const std::vector<Source>& Sources::getSources() const{
+    return sources;
+}
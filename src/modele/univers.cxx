@@ -1,8 +1,10 @@
 #include "univers.hxx"
+#include <algorithm>
+#include "philox.hxx"
 
 /* Constructeur */
 
-Univers::Univers() : nombreParticules(0){
+Univers::Univers() : nombreParticules(0), prochainId(1){
 
     /* Accéder à l'instance de configuration */
     Configuration& configuration = Configuration::getInstance();
@@ -25,21 +27,34 @@ Univers::Univers() : nombreParticules(0){
         throw std::invalid_argument("Les dimensions de l'univers sont (0, 0, 0)");
     }
 
-    /* Récupérer la condition limite */
+    /* Récupérer la condition limite et la graine */
     conditionLimite = configuration.getConditionLimite();
+    graine = configuration.getGraine();
 
-    /* Calculer le nombre de cellules par direction */
-    nc.setX((ldX != 0) ? floor(ldX / rCut) : 1);
-    nc.setY((ldY != 0) ? floor(ldY / rCut) : 1);
-    nc.setZ((ldZ != 0) ? floor(ldZ / rCut) : 1);
+    /* Vérifier la subdivision des cellules */
+    subdivision = configuration.getSubdivisionCellules();
+    if(subdivision < 1 || subdivision > subdivisionMaximale){
+        throw std::invalid_argument("La subdivision des cellules doit être comprise entre 1 et " + std::to_string(subdivisionMaximale));
+    }
 
-    /* Vérifier les nombres de cellules */
-    if(nc.getX() <= 0 || nc.getY() <= 0 || nc.getZ() <= 0){
+    /* Vérifier les longueurs non nulles */
+    if((ldX != 0 && ldX < rCut) || (ldY != 0 && ldY < rCut) || (ldZ != 0 && ldZ < rCut)){
         throw std::invalid_argument("Une des longueurs caractéristiques est inférieure à rCut");
     }
+
+    /* Calculer le nombre de cellules par direction, de taille au moins
+    rCut/k, qui pavent exactement l'univers */
+    nc.setX((ldX != 0) ? floor(ldX * subdivision / rCut) : 1);
+    nc.setY((ldY != 0) ? floor(ldY * subdivision / rCut) : 1);
+    nc.setZ((ldZ != 0) ? floor(ldZ * subdivision / rCut) : 1);
+    tailleCellule = Vecteur<double>(ldX / nc.getX(), ldY / nc.getY(), ldZ / nc.getZ());
+
+    /* Refuser une grille qui ne tiendrait pas en mémoire avant de l'allouer */
+    verifierMemoire(estimerMemoire(ld, rCut, 0, subdivision));
     
     /* Redimensionner la liste de cellules */
     grille.resize(nc.getX() * nc.getY() * nc.getZ());
+    cellulesSignalees.assign(grille.size(), 0);
 
     /* Initialiser les cellules */
     for(int x = 0; x < nc.getX(); x++){
@@ -50,59 +65,176 @@ Univers::Univers() : nombreParticules(0){
                 int indice = x*nc.getY()*nc.getZ() + y*nc.getZ() + z;
                 grille[indice].setIndices(x, y, z);
 
-                /* Déterminer si c’est bord ou non */
-                if(((x == 0 || x == nc.getX()-1) && ld.getX() > 0) ||
-                    ((y == 0 || y == nc.getY()-1) && ld.getY() > 0) ||
-                    ((z == 0 || z == nc.getZ()-1) && ld.getZ() > 0) ){
+                /* Déterminer si c’est bord ou non, c'est-à-dire si une
+                voisine du stencil peut sortir de la grille */
+                const int k = subdivision;
+                if(((x < k || x >= nc.getX()-k) && ld.getX() > 0) ||
+                    ((y < k || y >= nc.getY()-k) && ld.getY() > 0) ||
+                    ((z < k || z >= nc.getZ()-k) && ld.getZ() > 0) ){
                     grille[indice].setBord(true);
                 }
-
-                /* Ajouter les voisines de la cellule */
-                ajouterVoisines(indice, x, y, z);
             }
         }
     }
 
-    //imprimerGrilleSurConsole(grille);
+    /* Les voisines sont calculées à partir d'un stencil commun */
+    construireStencil();
+
+    /* Les forces des parois ne sont calculées que dans les cellules à leur portée */
+    construireParois();
+
+    //imprimerGrilleSurConsole(*this);
 
 }
 
 /* Méthodes privées */
 
-void Univers::ajouterVoisines(int indice, int x, int y, int z){
-    for(int dx = -1; dx <= 1; dx++){
-        for(int dy = -1; dy <= 1; dy++){
-            for(int dz = -1; dz <= 1; dz++){
-                
-                /* Éviter les voisins répétés en nombre de cellule égale à 1 et 2 */
-                if((nc.getX() == 1 && dx != 0) || (nc.getX() == 2 && dx < 0) || 
-                    (nc.getY() == 1 && dy != 0) || (nc.getY() == 2 && dy < 0) ||
-                    (nc.getZ() == 1 && dz != 0) || (nc.getZ() == 2 && dz < 0)) {
-                    continue;
-                }
+void Univers::corrigerCellule(Cellule& cellule){
+    const auto& particulesCellule = cellule.getParticules();
+    for(auto it = particulesCellule.begin(); it != particulesCellule.end();){
 
-                /* Calculer les indices */
-                int nx = x + dx;
-                int ny = y + dy;
-                int nz = z + dz;
+        /* Vérifier si sa cellule a déjà été confirmée */
+        if((*it)->isCelluleConfirmee()){
+            it++;
+            continue;
+        }
 
-                /* Appliquer des conditions périodiques */
-                if(conditionLimite == ConditionLimite::Periodique){
-                    nx = (nx + nc.getX()) % nc.getX();
-                    ny = (ny + nc.getY()) % nc.getY();
-                    nz = (nz + nc.getZ()) % nc.getZ();
-                }
+        /* Calculer l'indice de la cellule à laquelle appartient la particule,
+        après l'avoir repliée si elle est sortie de la grille */
+        int indice = getIndiceCellule((*it)->getPosition());
+        if(indice < 0 && conditionLimite == ConditionLimite::Periodique){
+            replierParticule(*it);
+            indice = getIndiceCellule((*it)->getPosition());
+        }
+
+        /* Comparer avec la cellule actuelle */
+        if(indice >= 0 && &grille[indice] == &cellule){
+            it++;
+            continue;
+        }
+
+        /* Ajouter la particule à la cellule correspondante */
+        if(indice >= 0){
+            grille[indice].ajouterParticule(*it);
+            (*it)->setCelluleConfirmee(true);
+        }else{
+            nombreParticules--;
+            emplacementsLibres.push_back(*it - particules.data());
+        }
+
+        /* Supprimer la particule de la cellule actuelle */
+        it = cellule.suprimerParticule(it);
+    }
+}
+
+std::vector<size_t> Univers::releverEmplacements() const{
+    std::vector<size_t> emplacements;
+    emplacements.reserve(nombreParticules);
+    for(const auto& cellule : grille){
+        for(const auto particule : cellule.getParticules()){
+            emplacements.push_back(particule - particules.data());
+        }
+    }
+    return emplacements;
+}
+
+void Univers::relierCellules(const std::vector<size_t>& emplacements){
+    size_t k = 0;
+    for(auto& cellule : grille){
+        for(auto it = cellule.getParticules().begin(); it != cellule.getParticules().end(); ++it){
+            it = cellule.remplacerParticule(it, &particules[emplacements[k++]]);
+        }
+    }
+}
+
+void Univers::replierParticule(Particule* particule) const{
+    const Vecteur<double> &position = particule->getPosition();
 
-                /* Vérifier les limites de la grille */
-                if(nx >= 0 && nx < nc.getX() && 
-                    ny >= 0 && ny < nc.getY() && 
-                    nz >= 0 && nz < nc.getZ()){
-                    int indiceVoisine = nx*nc.getY()*nc.getZ() + ny*nc.getZ() + nz;
-                    grille[indice].ajouterVoisine(&grille[indiceVoisine]);
+    double posX = position.getX();
+    double posY = position.getY();
+    double posZ = position.getZ();
+
+    if(posX < 0){
+        posX = ld.getX() + posX; 
+    }else if(posX >= ld.getX()){
+        posX = posX - ld.getX();
+    }
+
+    if(posY < 0){
+        posY = ld.getY() + posY;
+    }else if(posY >= ld.getY()){
+        posY = posY - ld.getY();
+    }
+
+    if(posZ < 0){
+        posZ = ld.getZ() + posZ;
+    }else if(posZ >= ld.getZ()){
+        posZ = posZ - ld.getZ();
+    }
+
+    particule->setPosition(Vecteur<double>(posX, posY, posZ));
+}
+
+void Univers::construireStencil(){
+    stencil.clear();
+    stencilLineaire.clear();
+    const bool periodique = conditionLimite == ConditionLimite::Periodique;
+    const int k = subdivision;
+
+    /* Plus grand décalage utile par axe : aucun selon un axe de longueur
+    nulle, et sans repliement aucun qui sorte toujours de la grille */
+    const double longueurs[3] = {ld.getX(), ld.getY(), ld.getZ()};
+    const int cellules[3] = {nc.getX(), nc.getY(), nc.getZ()};
+    int portees[3];
+    for(int a = 0; a < 3; a++){
+        portees[a] = (longueurs[a] == 0) ? 0 : periodique ? k : std::min(k, cellules[a] - 1);
+    }
+
+    for(int dx = -portees[0]; dx <= portees[0]; dx++){
+        for(int dy = -portees[1]; dy <= portees[1]; dy++){
+            for(int dz = -portees[2]; dz <= portees[2]; dz++){
+
+                /* Écarter les cellules dont la distance minimale à la cellule centrale atteint rCut */
+                double ecartX = std::max(std::abs(dx) - 1, 0) * tailleCellule.getX();
+                double ecartY = std::max(std::abs(dy) - 1, 0) * tailleCellule.getY();
+                double ecartZ = std::max(std::abs(dz) - 1, 0) * tailleCellule.getZ();
+                if(ecartX*ecartX + ecartY*ecartY + ecartZ*ecartZ >= rCut*rCut){
+                    continue;
                 }
+                stencil.push_back(Vecteur<int>(dx, dy, dz));
+                stencilLineaire.push_back(dx*nc.getY()*nc.getZ() + dy*nc.getZ() + dz);
             }
         }
     }
+    stencil.shrink_to_fit();
+    stencilLineaire.shrink_to_fit();
+}
+
+void Univers::construireParois(){
+
+    /* Les faces de la boîte réfléchissent les particules, sauf selon un axe de longueur nulle */
+    if(conditionLimite == ConditionLimite::Reflexion){
+        if(ld.getX() > 0){
+            parois.ajouterObstacle(Obstacle::creerPlan(Vecteur<double>(0, 0, 0), Vecteur<double>(1, 0, 0)));
+            parois.ajouterObstacle(Obstacle::creerPlan(Vecteur<double>(ld.getX(), 0, 0), Vecteur<double>(-1, 0, 0)));
+        }
+        if(ld.getY() > 0){
+            parois.ajouterObstacle(Obstacle::creerPlan(Vecteur<double>(0, 0, 0), Vecteur<double>(0, 1, 0)));
+            parois.ajouterObstacle(Obstacle::creerPlan(Vecteur<double>(0, ld.getY(), 0), Vecteur<double>(0, -1, 0)));
+        }
+        if(ld.getZ() > 0){
+            parois.ajouterObstacle(Obstacle::creerPlan(Vecteur<double>(0, 0, 0), Vecteur<double>(0, 0, 1)));
+            parois.ajouterObstacle(Obstacle::creerPlan(Vecteur<double>(0, 0, ld.getZ()), Vecteur<double>(0, 0, -1)));
+        }
+    }
+
+    /* Les obstacles du fichier sont décrits dans le repère centré des particules d'entrée */
+    const std::string& fichierObstacles = Configuration::getInstance().getFichierObstacles();
+    if(!fichierObstacles.empty()){
+        parois.lireFichier(fichierObstacles, ld / 2);
+    }
+
+    parois.indexerCellules(nc, tailleCellule, rCutReflexion);
 }
 
 /* Méthodes publiques */
@@ -113,25 +245,124 @@ void Univers::ajouterParticule(Particule& particule){
     au centre du premier quadrant */
     particule.deplacer(ld / 2);
 
+    /* Attribuer un identifiant si la particule n'en a pas */
+    if(particule.getId() == 0){
+        particule.setId(prochainId);
+    }
+
     /* Ajouter la particule à l'univers */
+    restaurerParticule(particule);
+
+}
+
+void Univers::restaurerParticule(const Particule& particule){
+    prochainId = std::max(prochainId, particule.getId() + 1);
     particules.push_back(particule);
+}
 
+void Univers::restaurerProchainId(IdentifiantParticule prochain){
+    prochainId = std::max(prochainId, prochain);
 }
 
-void Univers::ajouterParticulesAleatoires(int n){
-    
-    std::random_device rd;
-    std::mt19937 mt(rd());
+bool Univers::injecterParticule(Particule particule){
+    int indice = getIndiceCellule(particule.getPosition());
+    if(indice < 0){
+        return false;
+    }
+    if(particule.getId() == 0){
+        particule.setId(prochainId);
+    }
+    prochainId = std::max(prochainId, particule.getId() + 1);
+    particule.setCelluleConfirmee(true);
+    nombreParticules++;
+
+    /* Réutiliser l'emplacement d'une particule absorbée */
+    if(!emplacementsLibres.empty()){
+        size_t emplacement = emplacementsLibres.back();
+        emplacementsLibres.pop_back();
+        particules[emplacement] = particule;
+        grille[indice].ajouterParticule(&particules[emplacement]);
+        return true;
+    }
 
-    /* Définir des distributions uniformes pour les coordonnées X, Y et Z */
-    std::uniform_real_distribution<double> distX(-ld.getX()/2, ld.getX()/2);
-    std::uniform_real_distribution<double> distY(-ld.getY()/2, ld.getY()/2);
-    std::uniform_real_distribution<double> distZ(-ld.getZ()/2, ld.getZ()/2);
+    /* Sinon ajouter la particule à la fin. Si le vecteur doit être
+    réalloué, relever l'emplacement de chaque particule des cellules
+    avant l'ajout pour les rattacher ensuite au nouveau vecteur */
+    if(particules.size() == particules.capacity()){
+        std::vector<size_t> emplacements = releverEmplacements();
+        particules.push_back(particule);
+        relierCellules(emplacements);
+    }else{
+        particules.push_back(particule);
+    }
+    grille[indice].ajouterParticule(&particules.back());
+    return true;
+}
 
-    /* Ajouter les particules aléatoires */
-    for(int i = 0; i < n; i++){
-        Particule particule(distX(mt), distY(mt), distZ(mt));
-        ajouterParticule(particule);
+void Univers::compacterParticules(){
+    if(emplacementsLibres.empty()){
+        return;
+    }
+
+    /* Combler les emplacements libres, du premier au dernier, avec les
+    dernières particules, en sautant celles qui sont elles-mêmes libres */
+    std::sort(emplacementsLibres.begin(), emplacementsLibres.end());
+    size_t taille = particules.size();
+    size_t premier = 0;
+    size_t dernier = emplacementsLibres.size();
+    while(premier < dernier){
+        if(emplacementsLibres[dernier - 1] == taille - 1){
+            taille--;
+            dernier--;
+            continue;
+        }
+        
+        /* Déplacer la dernière particule et remplacer son pointeur à sa
+        place dans sa cellule, l'ordre des cellules ne dépendant ainsi
+        pas du stockage, qui diffère après une reprise */
+        size_t emplacement = emplacementsLibres[premier++];
+        Particule* ancienne = &particules[--taille];
+        Cellule& cellule = grille[getIndiceCellule(ancienne->getPosition())];
+        auto it = std::find(cellule.getParticules().begin(), cellule.getParticules().end(), ancienne);
+        if(it == cellule.getParticules().end()){
+            throw std::logic_error("Particule absente de sa cellule lors de la compaction");
+        }
+        particules[emplacement] = *ancienne;
+        cellule.remplacerParticule(it, &particules[emplacement]);
+    }
+    particules.erase(particules.begin() + taille, particules.end());
+    emplacementsLibres.clear();
+}
+
+void Univers::reserverParticules(size_t n){
+    verifierMemoire(estimerMemoire(ld, rCut, particules.size() + n, subdivision));
+    particules.reserve(particules.size() + n);
+}
+
+void Univers::ajouterParticulesAleatoires(int64_t n, double ecartTypeVitesse){
+
+    /* Créer les particules */
+    const int64_t premier = particules.size();
+    reserverParticules(n);
+    particules.resize(premier + n, Particule(0, 0, 0));
+
+    /* Attribuer les identifiants et tirer les positions dans [0, ld)
+    et les vitesses, particule par particule */
+    const Philox philox(graine);
+    const IdentifiantParticule premierId = prochainId;
+    const int64_t fin = premier + n;
+    prochainId += n;
+    #pragma omp parallel for schedule(static)
+    for(int64_t i = premier; i < fin; i++){
+        particules[i].setId(premierId + (i - premier));
+        std::array<double, 2> xy = philox.uniformes(i, 0);
+        std::array<double, 2> z = philox.uniformes(i, 1);
+        particules[i].setPosition(Vecteur<double>(xy[0] * ld.getX(), xy[1] * ld.getY(), z[0] * ld.getZ()));
+        if(ecartTypeVitesse != 0){
+            std::array<double, 2> vxy = philox.normales(i, 2);
+            std::array<double, 2> vz = philox.normales(i, 3);
+            particules[i].setVitesse(Vecteur<double>(vxy[0], vxy[1], vz[0]) * ecartTypeVitesse);
+        }
     }
 }
 
@@ -167,91 +398,93 @@ void Univers::deplacerParticule(Particule* particule, const Vecteur<double>& vec
 
     /* Corriger la position en cas de périodicité */
     if(conditionLimite == ConditionLimite::Periodique){
-        const Vecteur<double> &position = particule->getPosition();
-
-        double posX = position.getX();
-        double posY = position.getY();
-        double posZ = position.getZ();
-
-        if(posX < 0){
-            posX = ld.getX() + posX; 
-        }else if(posX >= ld.getX()){
-            posX = posX - ld.getX();
-        }
+        replierParticule(particule);
+    }
 
-        if(posY < 0){
-            posY = ld.getY() + posY;
-        }else if(posY >= ld.getY()){
-            posY = posY - ld.getY();
-        }
+}
 
-        if(posZ < 0){
-            posZ = ld.getZ() + posZ;
-        }else if(posZ >= ld.getZ()){
-            posZ = posZ - ld.getZ();
-        }
+void Univers::deriverParticule(size_t indiceCellule, Particule* particule, const Vecteur<double>& vec){
 
-        particule->setPosition(Vecteur<double>(posX, posY, posZ));
+    /* La position n'est repliée qu'à la correction des cellules, pour les seules particules sorties */
+    particule->deplacer(vec);
 
+    /* Confirmer la particule si elle reste dans sa cellule, sinon signaler la cellule */
+    bool resteDansCellule = getIndiceCellule(particule->getPosition()) == static_cast<int>(indiceCellule);
+    particule->setCelluleConfirmee(resteDansCellule);
+    if(!resteDansCellule){
+        cellulesSignalees[indiceCellule] = 1;
     }
-
 }
 
 void Univers::remplirCellules(){
     for(auto& particule : particules){
 
-        /* Calculer les indices de la cellule */
-        const Vecteur<double>& position = particule.getPosition();
-        int x = floor(position.getX() / rCut);
-        int y = floor(position.getY() / rCut);
-        int z = floor(position.getZ() / rCut);
-
         /* Ajouter la particule à la liste de la cellule */
-        if(x >= 0 && x < nc.getX() && y >= 0 && y < nc.getY() && z >= 0 && z < nc.getZ()){
-            int indice = x*nc.getY()*nc.getZ() + y*nc.getZ() + z;
+        int indice = getIndiceCellule(particule.getPosition());
+        if(indice >= 0){
             grille[indice].ajouterParticule(&particule);
             nombreParticules += 1;
+        }else{
+            emplacementsLibres.push_back(&particule - particules.data());
         }
 
     }
 }
 
-void Univers::corrigerCellules(){
-    for(auto& cellule : grille){
-        const auto& particulesCellule = cellule.getParticules();
-        for(auto it = particulesCellule.begin(); it != particulesCellule.end();){
+void Univers::mesurerMemoire() const{
+    size_t octetsVoisines = octetsConteneur(stencil) + octetsConteneur(stencilLineaire);
+    size_t octetsParticulesCellules = 0;
+    for(const auto& cellule : grille){
+        octetsParticulesCellules += octetsConteneur(cellule.getParticules());
+    }
 
-            /* Vérifier si sa cellule a déjà été confirmée */
-            if((*it)->isCelluleConfirmee()){
-                it++;
-                continue;
-            }
+    Memoire& memoire = Memoire::getInstance();
+    memoire.enregistrer(PosteMemoire::Particules, octetsConteneur(particules) + octetsConteneur(emplacementsLibres));
+    memoire.enregistrer(PosteMemoire::Cellules, octetsConteneur(grille) + octetsConteneur(cellulesSignalees));
+    memoire.enregistrer(PosteMemoire::Voisines, octetsVoisines);
+    memoire.enregistrer(PosteMemoire::ParticulesCellules, octetsParticulesCellules);
+    memoire.enregistrer(PosteMemoire::Parois, parois.getOctets());
+}
 
-            /* Calculer les indices auxquels appartient la cellule */
-            const Vecteur<double>& position = (*it)->getPosition();
-            int x = floor(position.getX() / rCut);
-            int y = floor(position.getY() / rCut);
-            int z = floor(position.getZ() / rCut);
+void Univers::corrigerCellules(){
+    for(auto& cellule : grille){
+        corrigerCellule(cellule);
+    }
+}
 
-            /* Comparer les indices de la particule avec les indices de la cellule */
-            if(cellule.comparerIndices(x, y, z)){
-                it++;
-                continue;
-            }
+void Univers::corrigerCellulesSignalees(){
+    for(size_t c = 0; c < grille.size(); c++){
+        if(cellulesSignalees[c]){
+            corrigerCellule(grille[c]);
+            cellulesSignalees[c] = 0;
+        }
+    }
+}
 
-            /* Ajouter la particule à la cellule correspondante */
-            if(x >= 0 && x < nc.getX() && y >= 0 && y < nc.getY() && z >= 0 && z < nc.getZ()){  
-                int indice = x*nc.getY()*nc.getZ() + y * nc.getZ() + z;
-                grille[indice].ajouterParticule(*it);
-                (*it)->setCelluleConfirmee(true);
-            }else{
-                nombreParticules--;
-            }
+int Univers::getIndiceCellule(const Vecteur<double>& position) const{
 
-            /* Supprimer la particule de la cellule actuelle */
-            it = cellule.suprimerParticule(it);
+    /* Une position négative est hors de la grille, sinon la troncature
+    donne le même résultat que floor sans appel à la bibliothèque. Selon
+    un axe de longueur nulle, la position est sur le plan 0 */
+    if(position.getX() < 0 || position.getY() < 0 || position.getZ() < 0){
+        return -1;
+    }
+    int x = (ld.getX() > 0) ? static_cast<int>(position.getX() / tailleCellule.getX()) : 0;
+    int y = (ld.getY() > 0) ? static_cast<int>(position.getY() / tailleCellule.getY()) : 0;
+    int z = (ld.getZ() > 0) ? static_cast<int>(position.getZ() / tailleCellule.getZ()) : 0;
+    if(x >= nc.getX() || y >= nc.getY() || z >= nc.getZ()){
+
+        /* Au-delà de ld la position est hors de la grille, en deçà l'arrondi
+        de la division l'a placée une cellule trop loin */
+        if((ld.getX() > 0 && position.getX() >= ld.getX()) || (ld.getY() > 0 && position.getY() >= ld.getY()) ||
+            (ld.getZ() > 0 && position.getZ() >= ld.getZ())){
+            return -1;
         }
+        x = std::min(x, nc.getX() - 1);
+        y = std::min(y, nc.getY() - 1);
+        z = std::min(z, nc.getZ() - 1);
     }
+    return x*nc.getY()*nc.getZ() + y*nc.getZ() + z;
 }
 
 const Cellule& Univers::getCelluleParIndices(int x, int y, int z){
@@ -265,14 +498,38 @@ const std::vector<Cellule>& Univers::getGrille() const{
     return grille;
 }
 
+std::vector<const Cellule*> Univers::getVoisines(const Cellule& cellule) const{
+    std::vector<const Cellule*> voisines;
+    pourChaqueVoisine(cellule, [&voisines](const Cellule& voisine, const Vecteur<double>&){
+        voisines.push_back(&voisine);
+    });
+    return voisines;
+}
+
+const std::vector<Vecteur<int>>& Univers::getStencil() const{
+    return stencil;
+}
+
+const Parois& Univers::getParois() const{
+    return parois;
+}
+
 ConditionLimite Univers::getConditionLimite() const{
     return conditionLimite;
 }
 
-int Univers::getNombreParticules() const{
+int64_t Univers::getNombreParticules() const{
     return nombreParticules;
 }
 
+size_t Univers::getNombreEmplacements() const{
+    return particules.size();
+}
+
+IdentifiantParticule Univers::getProchainId() const{
+    return prochainId;
+}
+
 double Univers::getRCutReflexion() const{
     return rCutReflexion;
 }
@@ -284,3 +541,15 @@ double Univers::getRCut() const{
 const Vecteur<double>& Univers::getLd() const{
     return ld;
 }
+
+const Vecteur<int>& Univers::getNc() const{
+    return nc;
+}
+
+int Univers::getSubdivision() const{
+    return subdivision;
+}
+
+const Vecteur<double>& Univers::getTailleCellule() const{
+    return tailleCellule;
+}
@@ -0,0 +1,93 @@
+#include "mise_a_echelle.hxx"
+#include <chrono>
+#include "simulation.hxx"
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+MesureMiseAEchelle mesurerExecution(Scenario scenario, int nombreParticules, int pas, int threads, bool deterministe){
+
+    /* Générer le scénario et établir la configuration sans sortie */
+    DescriptionScenario description = genererScenario(scenario, nombreParticules);
+    configurerScenario(description);
+    Configuration& configuration = Configuration::getInstance();
+    configuration.setRCut(2.5);
+    configuration.setSorties(false);
+    configuration.setDelta(0.00005);
+    configuration.setTFinal(0.00005 * (pas - 0.5));
+    configuration.setDeterministe(deterministe);
+
+#ifdef _OPENMP
+    omp_set_num_threads(threads);
+#else
+    if(threads != 1){
+        throw std::invalid_argument("Compilé sans OpenMP : seul un thread est disponible");
+    }
+#endif
+
+    Univers univers;
+    for(auto& particule : description.particules){
+        univers.ajouterParticule(particule);
+    }
+    Simulation simulation(univers);
+
+    /* Mesurer uniquement l'intégration */
+    auto debut = std::chrono::steady_clock::now();
+    simulation.stromerVerlet();
+    std::chrono::duration<double> duree = std::chrono::steady_clock::now() - debut;
+
+    MesureMiseAEchelle mesure;
+    mesure.threads = threads;
+    mesure.nombreParticules = description.particules.size();
+    mesure.pas = simulation.getIteration();
+    mesure.duree = duree.count();
+    mesure.pasParSeconde = mesure.pas / mesure.duree;
+    mesure.particulesPasParSeconde = mesure.pasParSeconde * mesure.nombreParticules;
+    mesure.efficacite = 1;
+    return mesure;
+}
+
+std::vector<MesureMiseAEchelle> mesurerMiseAEchelle(std::ostream& csv, Scenario scenario, bool faible,
+                                                    const std::vector<int>& tailles, const std::vector<int>& threads, int pas,
+                                                    bool deterministe){
+    std::vector<MesureMiseAEchelle> mesures;
+    if(threads.empty()){
+        return mesures;
+    }
+    deterministe = deterministe && !faible;
+
+    csv << "scenario,mode,threads,particules,pas,duree_s,pas_par_s,particules_pas_par_s,efficacite\n";
+    auto ecrire = [&](const MesureMiseAEchelle& mesure, const char* mode){
+        csv << getNomScenario(scenario) << "," << mode << "," << mesure.threads << ","
+            << mesure.nombreParticules << "," << mesure.pas << "," << mesure.duree << "," << mesure.pasParSeconde << ","
+            << mesure.particulesPasParSeconde << "," << mesure.efficacite << "\n";
+        csv.flush();
+        mesures.push_back(mesure);
+    };
+    for(int taille : tailles){
+
+        /* Le mode déterministe est comparé au mode par défaut, qui évalue
+        deux fois moins de paires */
+        MesureMiseAEchelle reference{};
+        if(deterministe){
+            reference = mesurerExecution(scenario, taille, pas, threads[0]);
+            ecrire(reference, "forte");
+        }
+        for(size_t t = 0; t < threads.size(); t++){
+            int p = threads[t];
+            MesureMiseAEchelle mesure = mesurerExecution(scenario, faible ? taille * p : taille, pas, p, deterministe);
+
+            /* Comparer à la première mesure de la ligne, ramenée à un thread */
+            if(t == 0 && !deterministe){
+                reference = mesure;
+            }
+            if(faible){
+                mesure.efficacite = (mesure.particulesPasParSeconde / p) / (reference.particulesPasParSeconde / reference.threads);
+            }else{
+                mesure.efficacite = (reference.duree * reference.threads) / (mesure.duree * p);
+            }
+            ecrire(mesure, deterministe ? "deterministe" : faible ? "faible" : "forte");
+        }
+    }
+    return mesures;
+}
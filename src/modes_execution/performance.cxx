@@ -34,6 +34,17 @@ void mesurerPerformance(){
     for(int k = 3; k < 7; k++){
         mesurerPerformanceInsertionUnivers(pow(pow(2, k), 3));
     }
+
+    // Mesure le performance des opérations réelles sur les cellules
+    for(int densite : {4, 16, 64}){
+        std::cout << "\n";
+        int nombreCellules = densite < 64 ? 20 : 10;
+        mesurerPerformanceCellules<std::list<Particule*>>(nombreCellules, densite, 0.1);
+        mesurerPerformanceCellules<std::vector<Particule*>>(nombreCellules, densite, 0.1);
+        mesurerPerformanceCellules<std::deque<Particule*>>(nombreCellules, densite, 0.1);
+        mesurerPerformanceCellules<PetitVecteur<Particule*, 16>>(nombreCellules, densite, 0.1);
+        mesurerPerformanceCellules<Colonie<Particule*>>(nombreCellules, densite, 0.1);
+    }
 }
 
 void mesurerPerformanceInsertionUnivers(int nombreParticules){
@@ -1,8 +1,15 @@
 #include "simulation.hxx"
 
+/* Signal reçu pendant la simulation (0 si aucun) */
+static volatile std::sig_atomic_t signalRecu = 0;
+
+static void enregistrerSignal(int signal){
+    signalRecu = signal;
+}
+
 /* Constructeur */
 
-Simulation::Simulation(Univers& univers) : univers(univers){
+Simulation::Simulation(Univers& univers) : univers(univers), temps(0), iteration(0), forcesCalculees(false){
 
     /* Accéder à l'instance de configuration */
     Configuration& configuration = Configuration::getInstance();
@@ -18,139 +25,389 @@ Simulation::Simulation(Univers& univers) : univers(univers){
     delta = configuration.getDelta();
     tFinal = configuration.getTFinal();
     nomDossier = configuration.getNomDossier();
+    intervalleReprise = configuration.getIntervalleReprise();
+    intervalleChronometrage = configuration.getIntervalleChronometrage();
+    compteursMateriels = configuration.getCompteursMateriels();
+    trace = configuration.getTrace();
+    traceDebut = configuration.getTraceDebut();
+    traceFin = configuration.getTraceFin();
+    sorties = configuration.getSorties();
+    cadenceJournal = Cadence(configuration.getIntervalleJournal(), configuration.getIntervalleJournalTemps());
+    cadenceVTU = Cadence(configuration.getIntervalleVTU(), configuration.getIntervalleVTUTemps());
+    cadenceReduction = Cadence(configuration.getIntervalleReduction());
+    intervalleCompaction = configuration.getIntervalleCompaction();
+    deterministe = configuration.getDeterministe();
+    if(deterministe){
+        energiesCellules.resize(univers.getGrille().size());
+    }
 
-    if(nomDossier != "test"){
+    /* Lire les sources, qui placent les particules là où une paroi réfléchissante n'exerce aucune force */
+    const std::string& fichierSources = configuration.getFichierSources();
+    if(!fichierSources.empty()){
+        sources.reset(new Sources(univers.getLd(), univers.getRCutReflexion() / 2, configuration.getGraine()));
+        sources->lireFichier(fichierSources);
+    }
+
+    /* Restaurer les particules, les forces et le temps depuis un point de reprise */
+    const std::string& fichierReprise = configuration.getFichierReprise();
+    if(!fichierReprise.empty()){
+        EtatReprise etat = lireReprise(fichierReprise, univers);
+        if(etat.hashConfiguration != configuration.calculerHash()){
+            throw std::invalid_argument("La configuration diffère de celle du point de reprise " + fichierReprise);
+        }
+        temps = etat.temps;
+        iteration = etat.iteration;
+        forcesCalculees = true;
+    }
+
+    if(sorties){
         /* Créer un dossier pour les fichiers de sortie */
         creerDossier(nomDossier);
 
-        /* Ouvrir le fichier texte qui sera utilisé pour stocker l'état de l'univers */
-        fichierTexte = ouvrirFichierDeSortie(nomDossier + "/simulation.txt");
+        /* Ouvrir le journal qui sera utilisé pour stocker l'état de l'univers */
+        FormatJournal formatJournal = configuration.getFormatJournal();
+        if(formatJournal != FormatJournal::Aucun && cadenceJournal.estActive()){
+            std::string adresseJournal = nomDossier + (formatJournal == FormatJournal::Csv ? "/simulation.csv" : "/simulation.bin");
+            journal.reset(new JournalParticules(adresseJournal, formatJournal, lireChampsJournal(configuration.getChampsJournal()),
+                                                configuration.getEchantillonnageJournal(), forcesCalculees ? iteration : -1));
+        }
+
+        /* Ouvrir le fichier de trajectoire ou la collection des fichiers VTU,
+        en conservant les sorties antérieures en cas de reprise */
+        if(configuration.getTrajectoire()){
+            trajectoire.reset(new EcrivainTrajectoire(nomDossier + "/trajectoire.traj", univers.getLd(), configuration.getTrajectoireForces(), forcesCalculees ? iteration : -1));
+            if(configuration.getTrajectoireCompression()){
+                trajectoire->activerCompression(configuration.getTrajectoirePrecision(), configuration.getTrajectoireImagesCles());
+            }
+        }else{
+            collectionVTU.reset(new CollectionPVD(nomDossier + "/simulation.pvd", forcesCalculees ? temps : -1));
+        }
     }
 
     /* Ajouter des particules aux cellules */
     univers.remplirCellules();
+
+    /* Préparer la réduction en champs grossiers sur la grille de l'univers */
+    if(sorties && cadenceReduction.estActive()){
+        reduction.reset(new ReductionChamps(univers, configuration.getFacteurReduction()));
+        collectionReduction.reset(new CollectionPVD(nomDossier + "/reduction.pvd", forcesCalculees ? temps : -1));
+    }
+
+    /* Créer le segment de diffusion en direct, dimensionné pour que le
+    nombre de particules puisse doubler avant que les frames soient tronquées */
+    if(!configuration.getDiffusion().empty()){
+        uint64_t capacite = std::max<uint64_t>(2 * univers.getNombreParticules(), 1024);
+        diffusion.reset(new DiffusionEtat(configuration.getDiffusion(), univers.getLd(), capacite));
+        cadenceDiffusion = Cadence(configuration.getIntervalleDiffusion());
+    }
 }
 
 /* Méthodes publiques */
 
 void Simulation::stromerVerlet(){
 
-    /* Calculer les forces */
-    calculerForcesDuSysteme();
+    /* Chronométrer les phases de cette exécution uniquement */
+    Chronometrage& chronometrage = Chronometrage::getInstance();
+    chronometrage.reinitialiser();
+
+    /* Ouvrir les compteurs matériels, qui sont lus aux bornes de chaque phase */
+    CompteursMateriels& compteurs = CompteursMateriels::getInstance();
+    if(compteursMateriels && !compteurs.ouvrir()){
+        std::cerr << "Compteurs matériels indisponibles (perf_event_open), simulation poursuivie sans eux\n";
+    }
+
+    /* Enregistrer la chronologie de la plage d'itérations demandée */
+    Trace& chronologie = Trace::getInstance();
+    bool traceActivee = trace && sorties;
+    if(traceActivee){
+        chronologie.activer(traceDebut, traceFin);
+        chronologie.setIteration(iteration);
+    }
 
-    double t = 0;
-    for(int i = 0; t < tFinal; t = t + delta, i++){
+    /* Calculer les forces, sauf en reprise où elles sont restaurées */
+    if(!forcesCalculees){
+        calculerForcesDuSysteme();
+        forcesCalculees = true;
+    }
 
-        if(i % 1000 == 0 && nomDossier != "test"){
-            /* Sauvegarder l'etat de l'univers */
-            sauvegarderEtatEnTexte(fichierTexte, univers, i);
-            sauvegarderEtatEnVTU(nomDossier, univers, i);
+    /* Comptabiliser la mémoire de cette exécution uniquement */
+    Memoire& memoire = Memoire::getInstance();
+    memoire.reinitialiser();
+    mesurerMemoire();
+
+    /* Intercepter SIGTERM et SIGUSR1 pour écrire un point de reprise */
+    bool reprisesActivees = sorties;
+    void (*ancienGestionnaireTerm)(int) = SIG_DFL;
+    void (*ancienGestionnaireUsr1)(int) = SIG_DFL;
+    if(reprisesActivees){
+        signalRecu = 0;
+        ancienGestionnaireTerm = std::signal(SIGTERM, enregistrerSignal);
+        ancienGestionnaireUsr1 = std::signal(SIGUSR1, enregistrerSignal);
+    }
+
+    const std::vector<Cellule>& grille = univers.getGrille();
+    const int iterationDepart = iteration;
+    int64_t iterationDiffusee = -1;
+    for(; temps < tFinal; temps = temps + delta, iteration++){
+        const int i = iteration;
+        if(traceActivee){
+            chronologie.setIteration(i);
         }
 
-        /* Mettre à jour les paramètres de position */
-        for(const auto& cellule : univers.getGrille()){
-            for(const auto particule : cellule.getParticules()){
-                univers.deplacerParticule(particule, particule->getVitesse()*delta + (0.5/particule->getMasse())*particule->getForce()*pow(delta, 2));
-                particule->setFold(particule->getForce());
-                particule->setCelluleConfirmee(false);
+        if(reprisesActivees){
+            /* Sauvegarder un point de reprise périodique ou demandé par un signal */
+            int signal = signalRecu;
+            if(signal != 0 || (intervalleReprise > 0 && i % intervalleReprise == 0 && i != iterationDepart)){
+                CHRONOMETRER(Phase::Reprise);
+                signalRecu = 0;
+                sauvegarderPointDeReprise(nomDossier + "/reprise.bin");
+            }
+            if(signal == SIGTERM){
+                break;
             }
         }
-        univers.corrigerCellules();
+
+        /* Sauvegarder l'etat de l'univers selon la cadence de chaque sortie */
+        if(journal && cadenceJournal.doitSortir(i, temps)){
+            CHRONOMETRER(Phase::SortieTexte);
+            journal->ecrire(univers, i, temps);
+        }
+        if(sorties && cadenceVTU.doitSortir(i, temps)){
+            CHRONOMETRER(Phase::SortieVTU);
+            if(trajectoire){
+                trajectoire->ajouterFrame(univers, i, temps);
+            }else{
+                sauvegarderEtatEnVTU(nomDossier, univers, i);
+                collectionVTU->ajouter(temps, "Iteration." + std::to_string(i) + ".vtu");
+            }
+        }
+        if(diffusion && cadenceDiffusion.doitSortir(i, temps)){
+            CHRONOMETRER(Phase::Diffusion);
+            diffusion->publier(univers, i, temps);
+            iterationDiffusee = i;
+        }
+
+        if(reduction){
+            CHRONOMETRER(Phase::Reduction);
+            /* Accumuler les champs réduits à chaque itération et les écrire périodiquement */
+            reduction->accumuler(univers);
+            if(cadenceReduction.doitSortir(i, temps)){
+                std::string nomFichier = "Reduction." + std::to_string(i) + ".vti";
+                reduction->sauvegarderEnVTI(nomDossier + "/" + nomFichier);
+                collectionReduction->ajouter(temps, nomFichier);
+            }
+        }
+
+        /* Appliquer la première moitié de la mise à jour de vitesse,
+        mettre à jour les paramètres de position, remettre la force à
+        zéro et calculer la nouvelle cellule de chaque particule dans le
+        même parcours. La dérive v dt + F dt^2 / 2m de Stromer-Verlet
+        devient celle de la vitesse à mi-pas, ce qui évite de conserver
+        la force précédente dans chaque particule */
+        {
+            CHRONOMETRER(Phase::Derive);
+            #pragma omp parallel
+            {
+                TRACER("Dérive");
+                #pragma omp for schedule(static) nowait
+                for(size_t c = 0; c < grille.size(); c++){
+                    for(const auto particule : grille[c].getParticules()){
+                        particule->accelerer(delta*(0.5/particule->getMasse())*particule->getForce());
+                        univers.deriverParticule(c, particule, particule->getVitesse()*delta);
+                        particule->setForce(Vecteur<double>());
+                    }
+                }
+            }
+        }
+        {
+            CHRONOMETRER(Phase::CorrectionCellules);
+            univers.corrigerCellulesSignalees();
+        }
+
+        /* Injecter les particules des sources dans les emplacements libres,
+        puis retirer périodiquement du stockage les particules absorbées */
+        if(sources){
+            CHRONOMETRER(Phase::Injection);
+            sources->injecter(univers, i, delta);
+        }
+        if(intervalleCompaction > 0 && (i + 1) % intervalleCompaction == 0){
+            CHRONOMETRER(Phase::Compaction);
+            univers.compacterParticules();
+        }
 
         /* Calculer les forces */
         calculerForcesDuSysteme();
         
-        /* Mettre à jour les paramètres de vitesse */
-        for(const auto& cellule : univers.getGrille()){
-            for(const auto particule : cellule.getParticules()){
-                particule->accelerer(delta*(0.5/particule->getMasse())*(particule->getForce() + particule->getFold()));
+        /* Achever la mise à jour des paramètres de vitesse avec la
+        nouvelle force et, si la vitesse doit être limitée à cette
+        itération, calculer l'énergie cinétique dans le même parcours */
+        const bool limiterIteration = limiterVitesse && i % 1000 == 0;
+        double energieCinetique = 0;
+        {
+            CHRONOMETRER(Phase::Kick);
+            #pragma omp parallel reduction(+:energieCinetique)
+            {
+                TRACER("Kick");
+                #pragma omp for schedule(static) nowait
+                for(size_t c = 0; c < grille.size(); c++){
+                    double energieCellule = 0;
+                    for(const auto particule : grille[c].getParticules()){
+                        particule->accelerer(delta*(0.5/particule->getMasse())*particule->getForce());
+                        if(limiterIteration){
+                            energieCellule += particule->getMasse()*particule->getVitesse().normeCarre();
+                        }
+                    }
+                    if(deterministe){
+                        energiesCellules[c] = energieCellule;
+                    }else{
+                        energieCinetique += energieCellule;
+                    }
+                }
+            }
+
+            /* En mode déterministe, les énergies des cellules sont sommées
+            dans un ordre qui ne dépend pas de la répartition entre threads */
+            if(limiterIteration && deterministe){
+                energieCinetique = sommerParPaires(energiesCellules.data(), energiesCellules.size());
             }
         }
+        energieCinetique /= 2;
 
         /* Mettre à jour la vitesse */
-        if(limiterVitesse && i % 1000 == 0){
-            double energieCinetique = calculerEnergieCinetique();
+        if(limiterIteration){
+            CHRONOMETRER(Phase::LimitationVitesse);
             if(energieCinetique > energieDesiree){
                 double beta = std::sqrt(energieDesiree/energieCinetique);
-                for(const auto& cellule : univers.getGrille()){
-                    for(const auto particule : cellule.getParticules()){
+                #pragma omp parallel for schedule(static)
+                for(size_t c = 0; c < grille.size(); c++){
+                    for(const auto particule : grille[c].getParticules()){
                         particule->setVitesse(particule->getVitesse() * beta);
                     }
                 }
             }
         }
 
+        /* Afficher périodiquement les chronomètres cumulés */
+        if(intervalleChronometrage > 0 && (i + 1 - iterationDepart) % intervalleChronometrage == 0){
+            chronometrage.afficherResume(std::cout, i + 1 - iterationDepart);
+            compteurs.afficherResume(std::cout);
+            mesurerMemoire();
+            memoire.afficherResume(std::cout);
+        }
+
+    }
+
+    /* Diffuser l'état final, s'il ne vient pas de l'être */
+    if(diffusion && iterationDiffusee != iteration){
+        diffusion->publier(univers, iteration, temps);
+    }
+
+#ifdef AVEC_CHRONOMETRAGE
+    /* Afficher le tableau récapitulatif des chronomètres */
+    if(sorties){
+        chronometrage.afficherResume(std::cout, iteration - iterationDepart);
+        compteurs.afficherResume(std::cout);
+    }
+#endif
+    compteurs.fermer();
+
+    /* Afficher la mémoire de fin de simulation */
+    mesurerMemoire();
+    if(sorties){
+        memoire.afficherResume(std::cout);
+    }
+
+    /* Écrire la chronologie */
+    if(traceActivee){
+        chronologie.desactiver();
+        chronologie.ecrire(nomDossier + "/trace.json");
+    }
+
+    /* Rétablir les gestionnaires de signaux */
+    if(reprisesActivees){
+        std::signal(SIGTERM, ancienGestionnaireTerm);
+        std::signal(SIGUSR1, ancienGestionnaireUsr1);
     }
 }
 
+void Simulation::sauvegarderPointDeReprise(const std::string& adresseFichier) const{
+    EtatReprise etat;
+    etat.temps = temps;
+    etat.iteration = iteration;
+    etat.hashConfiguration = Configuration::getInstance().calculerHash();
+    etat.prochainId = univers.getProchainId();
+    sauvegarderReprise(adresseFichier, univers, etat);
+}
+
+/* Getters */
+
+double Simulation::getTemps() const{
+    return temps;
+}
+
+int Simulation::getIteration() const{
+    return iteration;
+}
+
 /* Méthodes privées */
 
 void Simulation::calculerForcesDuSysteme(){ 
     
-    /* Calculer les forces de réflexion */
-    if(univers.getConditionLimite() == ConditionLimite::Reflexion){
-        for(const auto& cellule : univers.getGrille()){
-            if(cellule.isBord()){
-                for(const auto particule : cellule.getParticules()){
-                    calculerForceReflexive(particule);
-                }
+    /* Calculer les forces des parois dans les cellules à leur portée */
+    const std::vector<int>& cellulesProches = univers.getParois().getCellulesProches();
+    if(!cellulesProches.empty()){
+        CHRONOMETRER(Phase::ForcesReflexion);
+        const std::vector<Cellule>& grille = univers.getGrille();
+        #pragma omp parallel for schedule(static)
+        for(size_t k = 0; k < cellulesProches.size(); k++){
+            for(const auto particule : grille[cellulesProches[k]].getParticules()){
+                calculerForceReflexive(particule, k);
             }
         }
     }
 
-    /* Calculer les forces pour chaque particule */
-    for(const auto& cellule : univers.getGrille()){
-        for(const auto particule : cellule.getParticules()){
-            calculerForceSurParticule(cellule, particule);
+    /* Calculer les forces pour chaque particule. Cette boucle reste
+    séquentielle, chaque paire mettant à jour les deux particules, sauf
+    en mode déterministe où chaque particule n'écrit que sa propre force */
+    CHRONOMETRER(Phase::ForcesPaires);
+    const std::vector<Cellule>& grille = univers.getGrille();
+    if(deterministe){
+        #pragma omp parallel
+        {
+            TRACER("Forces");
+            #pragma omp for schedule(dynamic, 16) nowait
+            for(size_t c = 0; c < grille.size(); c++){
+                for(const auto particule : grille[c].getParticules()){
+                    calculerForceCompleteSurParticule(grille[c], particule);
+                }
+            }
+        }
+    }else{
+        for(const auto& cellule : grille){
+            for(const auto particule : cellule.getParticules()){
+                calculerForceSurParticule(cellule, particule);
+            }
         }
     }
 
 }
 
-void Simulation::calculerForceReflexive(Particule* particule){
-    double rCutReflexion = univers.getRCutReflexion();
-    const Vecteur<double>& ld = univers.getLd();
-
-    const Vecteur<double> &position = particule->getPosition();
-
-    double dx = position.getX();
-    double dy = position.getY();
-    double dz = position.getZ();
-
-    if(std::abs(dx) > ld.getX() / 2){
-        dx -= std::copysign(ld.getX(), dx);
-    }
-    if(std::abs(dy) > ld.getY() / 2){
-        dy -= std::copysign(ld.getY(), dy);
-    }
-    if(std::abs(dz) > ld.getZ() / 2){
-        dz -= std::copysign(ld.getZ(), dz);
-    }
-    
+void Simulation::calculerForceReflexive(Particule* particule, size_t k){
+    const double aux1 = -12 * epsilon;
     Vecteur<double> force(0, 0, 0);
-    double aux1 = -24 * epsilon;
-
-    if(dx < rCutReflexion && ld.getX() > 0){
-        double aux2 = pow(sigma/(2*dx), 6);
-        force.setX(aux1 * (1.0/(2*dx))*aux2*(1-2*aux2));
-    }
-    if(dy < rCutReflexion && ld.getY() > 0){
-        double aux2 = pow(sigma/(2*dy), 6);
-        force.setY(aux1 * (1.0/(2*dy))*aux2*(1-2*aux2));
-    }
-    if(dz < rCutReflexion && ld.getZ() > 0){
-        double aux2 = pow(sigma/(2*dz), 6);
-        force.setZ(aux1 * (1.0/(2*dz))*aux2*(1-2*aux2));
-    }
-
+    univers.getParois().pourChaqueContact(k, particule->getPosition(), [&](double distance, const Vecteur<double>& normale){
+        
+        /* Force de Lennard-Jones de la particule image, (sigma/2d)^6 sans appel à pow */
+        double aux2 = sigma / (2 * distance);
+        aux2 = aux2 * aux2;
+        aux2 = aux2 * aux2 * aux2;
+        force += normale * (aux1 / distance * aux2 * (1 - 2*aux2));
+    });
     particule->setForce(particule->getForce() + force);
 }
 
 void Simulation::calculerForceSurParticule(const Cellule& cellule, Particule* particule){
     
-    /* Initialiser la force pour chaque particule. */
-    particule->setForce(particule->getForce() - particule->getFold());
-
     if(forcePG){
         /* Calculer la force du potentiel gravitationnel */
         Vecteur<double> force(0, particule->getMasse() * G, 0);
@@ -160,14 +417,20 @@ void Simulation::calculerForceSurParticule(const Cellule& cellule, Particule* pa
     /* Calculer les forces d'interaction entre particules */
     double aux1 = 24*epsilon;
     double aux2 = 4*pow(M_PI,2);
-    for(const auto voisine : cellule.getVoisines()){
-        for(const auto autreParticule : voisine->getParticules()){
+    uint64_t paires = 0;
+    uint64_t interactions = 0;
+    const Vecteur<double> position = particule->getPosition();
+    univers.pourChaqueVoisine(cellule, [&](const Cellule& voisine, const Vecteur<double>& translation){
+        for(const auto autreParticule : voisine.getParticules()){
 
             if(particule->getId() > autreParticule->getId()){
 
-                /* Calculer vecteur direction et distance entre les particules */
-                Vecteur<double> direction = univers.calculerVecteurDirection(particule, autreParticule); 
+                /* Calculer vecteur direction et distance entre les particules,
+                la translation de la voisine donnant l'image périodique adjacente */
+                Vecteur<double> direction = autreParticule->getPosition() - position + translation;
                 double distance = direction.norme();
+                paires++;
+                interactions += distance < univers.getRCut() && distance != 0;
                 
                 /* Ajouter la force d’interaction du potentiel de Lennard-Jones */      
                 if(forceLJ && distance < univers.getRCut() && distance != 0){     
@@ -188,16 +451,72 @@ void Simulation::calculerForceSurParticule(const Cellule& cellule, Particule* pa
             }
 
         }
-    }
+    });
+    COMPTER(Compteur::PairesEvaluees, paires);
+    COMPTER(Compteur::Interactions, interactions);
 }
 
-double Simulation::calculerEnergieCinetique(){
-    double energieCinetique = 0;
-    for(const auto& cellule : univers.getGrille()){
-        for(const auto particule : cellule.getParticules()){
-            energieCinetique += particule->getMasse()*particule->getVitesse().normeCarre();
+void Simulation::calculerForceCompleteSurParticule(const Cellule& cellule, Particule* particule){
+    
+    if(forcePG){
+        /* Calculer la force du potentiel gravitationnel */
+        Vecteur<double> force(0, particule->getMasse() * G, 0);
+        particule->setForce(particule->getForce() + force);
+    }
+
+    /* Calculer les forces de toutes les voisines, la force de chaque paire
+    étant l'opposée exacte de celle calculée depuis l'autre particule */
+    double aux1 = 24*epsilon;
+    double aux2 = 4*pow(M_PI,2);
+    uint64_t paires = 0;
+    uint64_t interactions = 0;
+    const Vecteur<double> position = particule->getPosition();
+    Vecteur<double> forceTotale = particule->getForce();
+    univers.pourChaqueVoisine(cellule, [&](const Cellule& voisine, const Vecteur<double>& translation){
+        for(const auto autreParticule : voisine.getParticules()){
+
+            if(autreParticule != particule){
+                Vecteur<double> direction = autreParticule->getPosition() - position + translation;
+                double distance = direction.norme();
+                paires++;
+                interactions += distance < univers.getRCut() && distance != 0;
+                
+                /* Ajouter la force d’interaction du potentiel de Lennard-Jones */      
+                if(forceLJ && distance < univers.getRCut() && distance != 0){     
+                    double aux3 = pow(sigma/distance, 6);
+                    double magnitude = aux1*(1/pow(distance, 2))*aux3*(1-2*aux3);
+                    forceTotale += direction * magnitude;
+                }
+
+                /* Ajouter la force d’interaction gravitationnelle */
+                if(forceIG && distance < univers.getRCut() && distance != 0){
+                    double magnitude = aux2*particule->getMasse()*autreParticule->getMasse() / pow(distance, 3);
+                    forceTotale += direction * magnitude;
+                }
+            }
+
         }
+    });
+    particule->setForce(forceTotale);
+    COMPTER(Compteur::PairesEvaluees, paires);
+    COMPTER(Compteur::Interactions, interactions);
+}
+
+void Simulation::mesurerMemoire(){
+    univers.mesurerMemoire();
+
+    size_t octetsSorties = Trace::getInstance().getOctets();
+    if(journal){
+        octetsSorties += journal->getOctets();
+    }
+    if(trajectoire){
+        octetsSorties += trajectoire->getOctets();
+    }
+    if(diffusion){
+        octetsSorties += diffusion->getOctets();
     }
-    energieCinetique /= 2;
-    return energieCinetique;
+    Memoire& memoire = Memoire::getInstance();
+    memoire.enregistrer(PosteMemoire::Sorties, octetsSorties);
+    memoire.enregistrer(PosteMemoire::Cellules, memoire.getOctets(PosteMemoire::Cellules) + octetsConteneur(energiesCellules));
+    memoire.echantillonnerRSS();
 }
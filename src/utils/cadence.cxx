@@ -0,0 +1,34 @@
+#include "cadence.hxx"
+
+/* Tolérance relative sur le temps, le pas de temps étant accumulé par additions successives */
+static const double tolerance = 1e-9;
+
+/* Constructeur */
+
+Cadence::Cadence(int intervalleIterations, double intervalleTemps) :
+    intervalleIterations(intervalleIterations), intervalleTemps(intervalleTemps), prochainTemps(0), initialisee(false)
+{}
+
+/* Méthodes publiques */
+
+bool Cadence::doitSortir(int iteration, double temps){
+    if(intervalleTemps > 0){
+        const double marge = tolerance * intervalleTemps;
+        if(!initialisee){
+            prochainTemps = std::ceil(temps / intervalleTemps - tolerance) * intervalleTemps;
+            initialisee = true;
+        }
+        if(temps + marge < prochainTemps){
+            return false;
+        }
+        while(prochainTemps <= temps + marge){
+            prochainTemps += intervalleTemps;
+        }
+        return true;
+    }
+    return intervalleIterations > 0 && iteration % intervalleIterations == 0;
+}
+
+bool Cadence::estActive() const{
+    return intervalleTemps > 0 || intervalleIterations > 0;
+}
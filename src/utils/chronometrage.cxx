@@ -0,0 +1,122 @@
+#include "chronometrage.hxx"
+#include <iomanip>
+#include "compteurs_materiels.hxx"
+#include "trace.hxx"
+#include "imprimer.hxx"
+
+/* Constructeur */
+
+Chronometrage::Chronometrage(){
+    reinitialiser();
+}
+
+Chronometrage& Chronometrage::getInstance(){
+    static Chronometrage instance;
+    return instance;
+}
+
+/* Méthodes publiques */
+
+void Chronometrage::reinitialiser(){
+    for(int p = 0; p < static_cast<int>(Phase::Nombre); p++){
+        durees[p] = 0;
+        appels[p] = 0;
+    }
+    for(int c = 0; c < static_cast<int>(Compteur::Nombre); c++){
+        compteurs[c] = 0;
+    }
+}
+
+void Chronometrage::afficherResume(std::ostream& flux, int iterations) const{
+    double total = 0;
+    for(int p = 0; p < static_cast<int>(Phase::Nombre); p++){
+        total += durees[p] * 1e-9;
+    }
+
+    flux << "\nChronométrage sur " << iterations << " itérations :\n\n";
+    flux << "\t";
+    imprimerColonne(flux, "Phase", 22);
+    flux << std::setw(12) << "Temps (s)" << std::setw(10) << "Part (%)"
+         << std::setw(12) << "Appels" << std::setw(16) << "Moyenne (us)" << "\n";
+    for(int p = 0; p < static_cast<int>(Phase::Nombre); p++){
+        if(appels[p] == 0){
+            continue;
+        }
+        double duree = durees[p] * 1e-9;
+        flux << "\t";
+        imprimerColonne(flux, getNom(static_cast<Phase>(p)), 22);
+        flux << std::fixed
+             << std::setw(12) << std::setprecision(4) << duree
+             << std::setw(10) << std::setprecision(1) << (total > 0 ? 100 * duree / total : 0)
+             << std::setw(12) << appels[p]
+             << std::setw(16) << std::setprecision(2) << 1e6 * duree / appels[p] << "\n";
+    }
+    flux.unsetf(std::ios::fixed);
+    flux << std::setprecision(6);
+
+    double dureePaires = durees[static_cast<int>(Phase::ForcesPaires)] * 1e-9;
+    uint64_t interactions = compteurs[static_cast<int>(Compteur::Interactions)];
+    flux << "\n\tPaires évaluées : " << compteurs[static_cast<int>(Compteur::PairesEvaluees)] << "\n";
+    flux << "\tInteractions : " << interactions;
+    if(dureePaires > 0){
+        flux << " (" << interactions / dureePaires << " par seconde)";
+    }
+    flux << "\n\n";
+}
+
+/* Getters */
+
+double Chronometrage::getDuree(Phase phase) const{
+    return durees[static_cast<int>(phase)] * 1e-9;
+}
+
+uint64_t Chronometrage::getAppels(Phase phase) const{
+    return appels[static_cast<int>(phase)];
+}
+
+uint64_t Chronometrage::getCompteur(Compteur compteur) const{
+    return compteurs[static_cast<int>(compteur)];
+}
+
+const char* Chronometrage::getNom(Phase phase){
+    switch(phase){
+        case Phase::Derive: return "Dérive";
+        case Phase::CorrectionCellules: return "Correction cellules";
+        case Phase::Injection: return "Injection";
+        case Phase::Compaction: return "Compaction";
+        case Phase::ForcesReflexion: return "Forces de réflexion";
+        case Phase::ForcesPaires: return "Forces de paires";
+        case Phase::Kick: return "Kick";
+        case Phase::LimitationVitesse: return "Limitation vitesse";
+        case Phase::SortieTexte: return "Sortie texte";
+        case Phase::SortieVTU: return "Sortie VTU";
+        case Phase::Diffusion: return "Diffusion";
+        case Phase::Reduction: return "Réduction";
+        case Phase::Reprise: return "Reprise";
+        default: return "?";
+    }
+}
+
+/* Constructeur */
+
+ChronometrePhase::ChronometrePhase(Phase phase) : phase(phase){
+    CompteursMateriels& compteurs = CompteursMateriels::getInstance();
+    if(compteurs.estActif()){
+        compteurs.commencer(phase);
+    }
+    debut = std::chrono::steady_clock::now();
+}
+
+ChronometrePhase::~ChronometrePhase(){
+    auto fin = std::chrono::steady_clock::now();
+    Chronometrage::getInstance().ajouter(phase, std::chrono::duration_cast<std::chrono::nanoseconds>(fin - debut).count());
+    Trace& trace = Trace::getInstance();
+    if(trace.estEnregistree()){
+        bool entreeSortie = phase == Phase::SortieTexte || phase == Phase::SortieVTU || phase == Phase::Reduction || phase == Phase::Reprise;
+        trace.enregistrer(Chronometrage::getNom(phase), entreeSortie ? "es" : "phase", debut, fin);
+    }
+    CompteursMateriels& compteurs = CompteursMateriels::getInstance();
+    if(compteurs.estActif()){
+        compteurs.terminer(phase);
+    }
+}
@@ -0,0 +1,295 @@
+#include "compteurs_materiels.hxx"
+#include <iomanip>
+#include <cstring>
+#include "imprimer.hxx"
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+static const int NOMBRE_PHASES = static_cast<int>(Phase::Nombre);
+static const int NOMBRE_EVENEMENTS = static_cast<int>(EvenementMateriel::Nombre);
+
+/* Chaque lecture d'un thread conserve, après les événements, les durées
+d'activation et d'exécution du groupe qui servent à corriger le multiplexage */
+static const int TEMPS_ACTIF = NOMBRE_EVENEMENTS;
+static const int TEMPS_EXECUTE = NOMBRE_EVENEMENTS + 1;
+static const int VALEURS_PAR_THREAD = NOMBRE_EVENEMENTS + 2;
+
+#ifdef __linux__
+/* Ouvrir un événement pour un thread, dans le groupe du meneur s'il existe */
+static int ouvrirEvenement(EvenementMateriel evenement, int tid, int meneur){
+    struct perf_event_attr attributs;
+    std::memset(&attributs, 0, sizeof(attributs));
+    attributs.size = sizeof(attributs);
+    attributs.type = PERF_TYPE_HARDWARE;
+    switch(evenement){
+        case EvenementMateriel::Cycles: attributs.config = PERF_COUNT_HW_CPU_CYCLES; break;
+        case EvenementMateriel::Instructions: attributs.config = PERF_COUNT_HW_INSTRUCTIONS; break;
+        case EvenementMateriel::DefautsCache: attributs.config = PERF_COUNT_HW_CACHE_MISSES; break;
+        case EvenementMateriel::DefautsBranchement: attributs.config = PERF_COUNT_HW_BRANCH_MISSES; break;
+        case EvenementMateriel::TempsTache: attributs.type = PERF_TYPE_SOFTWARE; attributs.config = PERF_COUNT_SW_TASK_CLOCK; break;
+        default: attributs.type = PERF_TYPE_SOFTWARE; attributs.config = PERF_COUNT_SW_PAGE_FAULTS; break;
+    }
+    attributs.read_format = PERF_FORMAT_GROUP | PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+    attributs.exclude_kernel = 1;
+    attributs.exclude_hv = 1;
+    attributs.disabled = (meneur == -1);
+    return syscall(SYS_perf_event_open, &attributs, tid, -1, meneur, 0);
+}
+#endif
+
+/* Constructeur */
+
+CompteursMateriels::CompteursMateriels() : actif(false), nombreEvenements(0){
+    for(int e = 0; e < NOMBRE_EVENEMENTS; e++){
+        positions[e] = -1;
+    }
+}
+
+CompteursMateriels& CompteursMateriels::getInstance(){
+    static CompteursMateriels instance;
+    return instance;
+}
+
+CompteursMateriels::~CompteursMateriels(){
+    fermer();
+}
+
+/* Méthodes privées */
+
+void CompteursMateriels::lire(uint64_t* valeurs){
+#ifdef __linux__
+    for(size_t t = 0; t < threads.size(); t++){
+        uint64_t* valeursThread = valeurs + t * VALEURS_PAR_THREAD;
+        ssize_t taille = (3 + nombreEvenements) * sizeof(uint64_t);
+        if(::read(threads[t].meneur, lecture.data(), taille) != taille){
+            continue;
+        }
+        valeursThread[TEMPS_ACTIF] = lecture[1];
+        valeursThread[TEMPS_EXECUTE] = lecture[2];
+        for(int e = 0; e < NOMBRE_EVENEMENTS; e++){
+            if(positions[e] >= 0){
+                valeursThread[e] = lecture[3 + positions[e]];
+            }
+        }
+    }
+#else
+    (void)valeurs;
+#endif
+}
+
+/* Méthodes publiques */
+
+bool CompteursMateriels::ouvrir(){
+    fermer();
+
+#ifdef __linux__
+    /* Obtenir l'identifiant noyau de chaque thread OpenMP */
+    int nombreThreads = 1;
+#ifdef _OPENMP
+    nombreThreads = omp_get_max_threads();
+#endif
+    std::vector<int> tids(nombreThreads, static_cast<int>(syscall(SYS_gettid)));
+#ifdef _OPENMP
+    #pragma omp parallel num_threads(nombreThreads)
+    tids[omp_get_thread_num()] = static_cast<int>(syscall(SYS_gettid));
+#endif
+
+    /* Ouvrir les événements disponibles, en gardant les mêmes pour tous les threads */
+    for(int t = 0; t < nombreThreads; t++){
+        CompteursThread compteurs;
+        compteurs.tid = tids[t];
+        int position = 0;
+        for(int e = 0; e < NOMBRE_EVENEMENTS; e++){
+            if(t > 0 && positions[e] < 0){
+                continue;
+            }
+            int descripteur = ouvrirEvenement(static_cast<EvenementMateriel>(e), compteurs.tid, compteurs.meneur);
+            if(descripteur < 0){
+                if(t > 0){
+                    break;
+                }
+                continue;
+            }
+            if(compteurs.meneur == -1){
+                compteurs.meneur = descripteur;
+            }
+            compteurs.descripteurs.push_back(descripteur);
+            if(t == 0){
+                positions[e] = position;
+            }
+            position++;
+        }
+
+        /* Un thread dont les événements diffèrent du premier n'est pas suivi */
+        if(compteurs.meneur == -1 || (t > 0 && position != nombreEvenements)){
+            for(int descripteur : compteurs.descripteurs){
+                ::close(descripteur);
+            }
+            if(t == 0){
+                break;
+            }
+            continue;
+        }
+        if(t == 0){
+            nombreEvenements = position;
+        }
+        ioctl(compteurs.meneur, PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+        ioctl(compteurs.meneur, PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+        threads.push_back(compteurs);
+    }
+#endif
+
+    actif = !threads.empty();
+    if(!actif){
+        for(int e = 0; e < NOMBRE_EVENEMENTS; e++){
+            positions[e] = -1;
+        }
+        nombreEvenements = 0;
+    }
+    lecture.assign(3 + nombreEvenements, 0);
+    courantes.assign(threads.size() * VALEURS_PAR_THREAD, 0);
+    debuts.assign(NOMBRE_PHASES * threads.size() * VALEURS_PAR_THREAD, 0);
+    totaux.assign(NOMBRE_PHASES * threads.size() * NOMBRE_EVENEMENTS, 0);
+    return actif;
+}
+
+void CompteursMateriels::fermer(){
+#ifdef __linux__
+    for(const auto& compteurs : threads){
+        for(int descripteur : compteurs.descripteurs){
+            ::close(descripteur);
+        }
+    }
+#endif
+    threads.clear();
+    actif = false;
+}
+
+void CompteursMateriels::commencer(Phase phase){
+    lire(&debuts[static_cast<int>(phase) * threads.size() * VALEURS_PAR_THREAD]);
+}
+
+void CompteursMateriels::terminer(Phase phase){
+    lire(courantes.data());
+    for(size_t t = 0; t < threads.size(); t++){
+        const uint64_t* fin = &courantes[t * VALEURS_PAR_THREAD];
+        const uint64_t* debut = &debuts[(static_cast<int>(phase) * threads.size() + t) * VALEURS_PAR_THREAD];
+        uint64_t* total = &totaux[(static_cast<int>(phase) * threads.size() + t) * NOMBRE_EVENEMENTS];
+
+        /* Soustraire les valeurs brutes, croissantes, puis corriger la
+        variation si le noyau a multiplexé les compteurs pendant la phase */
+        const uint64_t active = fin[TEMPS_ACTIF] - debut[TEMPS_ACTIF];
+        const uint64_t executee = fin[TEMPS_EXECUTE] - debut[TEMPS_EXECUTE];
+        for(int e = 0; e < NOMBRE_EVENEMENTS; e++){
+            uint64_t variation = fin[e] - debut[e];
+            if(executee > 0 && executee < active){
+                variation = static_cast<uint64_t>(static_cast<double>(variation) * active / executee);
+            }
+            total[e] += variation;
+        }
+    }
+}
+
+void CompteursMateriels::afficherResume(std::ostream& flux) const{
+    if(!actif){
+        return;
+    }
+
+    /* Signaler les événements refusés par le noyau */
+    std::string indisponibles;
+    for(int e = 0; e < NOMBRE_EVENEMENTS; e++){
+        if(positions[e] < 0){
+            indisponibles += (indisponibles.empty() ? "" : ", ") + std::string(getNom(static_cast<EvenementMateriel>(e)));
+        }
+    }
+    flux << "Compteurs matériels par phase et par thread";
+    if(!indisponibles.empty()){
+        flux << " (indisponibles : " << indisponibles << ")";
+    }
+    flux << " :\n\n";
+
+    bool ipc = estDisponible(EvenementMateriel::Cycles) && estDisponible(EvenementMateriel::Instructions);
+    bool debit = estDisponible(EvenementMateriel::DefautsCache);
+    flux << "\t";
+    imprimerColonne(flux, "Phase", 22);
+    imprimerColonne(flux, "Thread", 8, false);
+    for(int e = 0; e < NOMBRE_EVENEMENTS; e++){
+        if(positions[e] >= 0){
+            imprimerColonne(flux, getNom(static_cast<EvenementMateriel>(e)), 18, false);
+        }
+    }
+    if(ipc){
+        imprimerColonne(flux, "IPC", 8, false);
+    }
+    if(debit){
+        imprimerColonne(flux, "Débit (Go/s)", 14, false);
+    }
+    flux << "\n";
+
+    Chronometrage& chronometrage = Chronometrage::getInstance();
+    for(int p = 0; p < NOMBRE_PHASES; p++){
+        Phase phase = static_cast<Phase>(p);
+        if(chronometrage.getAppels(phase) == 0){
+            continue;
+        }
+        for(size_t t = 0; t < threads.size(); t++){
+            flux << "\t";
+            imprimerColonne(flux, Chronometrage::getNom(phase), 22);
+            flux << std::setw(8) << t;
+            for(int e = 0; e < NOMBRE_EVENEMENTS; e++){
+                if(positions[e] >= 0){
+                    flux << std::setw(18) << getTotal(phase, t, static_cast<EvenementMateriel>(e));
+                }
+            }
+            flux << std::fixed << std::setprecision(2);
+            if(ipc){
+                double cycles = getTotal(phase, t, EvenementMateriel::Cycles);
+                flux << std::setw(8) << (cycles > 0 ? getTotal(phase, t, EvenementMateriel::Instructions) / cycles : 0);
+            }
+            if(debit){
+                /* Estimer le débit mémoire à une ligne de 64 octets par défaut de cache */
+                double duree = chronometrage.getDuree(phase);
+                flux << std::setw(14) << (duree > 0 ? 64e-9 * getTotal(phase, t, EvenementMateriel::DefautsCache) / duree : 0);
+            }
+            flux.unsetf(std::ios::fixed);
+            flux << std::setprecision(6) << "\n";
+        }
+    }
+    flux << "\n";
+}
+
+/* Getters */
+
+bool CompteursMateriels::estDisponible(EvenementMateriel evenement) const{
+    return positions[static_cast<int>(evenement)] >= 0;
+}
+
+int CompteursMateriels::getNombreThreads() const{
+    return threads.size();
+}
+
+uint64_t CompteursMateriels::getTotal(Phase phase, int thread, EvenementMateriel evenement) const{
+    if(!estDisponible(evenement) || thread < 0 || thread >= static_cast<int>(threads.size())){
+        return 0;
+    }
+    return totaux[(static_cast<int>(phase) * threads.size() + thread) * NOMBRE_EVENEMENTS + static_cast<int>(evenement)];
+}
+
+const char* CompteursMateriels::getNom(EvenementMateriel evenement){
+    switch(evenement){
+        case EvenementMateriel::Cycles: return "Cycles";
+        case EvenementMateriel::Instructions: return "Instructions";
+        case EvenementMateriel::DefautsCache: return "Défauts LLC";
+        case EvenementMateriel::DefautsBranchement: return "Défauts branch.";
+        case EvenementMateriel::TempsTache: return "Temps tâche (ns)";
+        case EvenementMateriel::DefautsPage: return "Défauts page";
+        default: return "?";
+    }
+}
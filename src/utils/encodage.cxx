@@ -0,0 +1,160 @@
+#include "encodage.hxx"
+
+#ifdef AVEC_ZLIB
+#include <zlib.h>
+#endif
+
+static const char alphabetBase64[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+std::vector<unsigned char> decoderBase64(const char* debut, size_t taille){
+
+    /* Construire la table inverse de l'alphabet */
+    static signed char table[256];
+    static bool tableInitialisee = false;
+    if(!tableInitialisee){
+        for(int i = 0; i < 256; i++){
+            table[i] = -1;
+        }
+        for(int i = 0; i < 64; i++){
+            table[static_cast<unsigned char>(alphabetBase64[i])] = i;
+        }
+        tableInitialisee = true;
+    }
+
+    std::vector<unsigned char> octets;
+    octets.reserve(taille / 4 * 3);
+
+    /* Décoder les caractères par groupes de quatre */
+    unsigned char groupe[4];
+    int nombreCaracteres = 0;
+    int nombreRemplissage = 0;
+    for(size_t i = 0; i < taille; i++){
+        unsigned char c = debut[i];
+        if(c == ' ' || c == '\n' || c == '\r' || c == '\t'){
+            continue;
+        }
+
+        if(c == '='){
+            groupe[nombreCaracteres++] = 0;
+            nombreRemplissage++;
+        }else{
+            if(table[c] < 0){
+                throw std::invalid_argument("Caractère base64 non valide");
+            }
+            groupe[nombreCaracteres++] = table[c];
+        }
+
+        if(nombreCaracteres == 4){
+            octets.push_back((groupe[0] << 2) | (groupe[1] >> 4));
+            if(nombreRemplissage < 2){
+                octets.push_back(((groupe[1] & 0x0F) << 4) | (groupe[2] >> 2));
+            }
+            if(nombreRemplissage < 1){
+                octets.push_back(((groupe[2] & 0x03) << 6) | groupe[3]);
+            }
+            nombreCaracteres = 0;
+            nombreRemplissage = 0;
+        }
+    }
+
+    if(nombreCaracteres != 0){
+        throw std::invalid_argument("Longueur de la chaîne base64 non valide");
+    }
+
+    return octets;
+}
+
+std::string encoderBase64(const unsigned char* octets, size_t taille){
+    std::string chaine;
+    chaine.reserve((taille + 2) / 3 * 4);
+
+    for(size_t i = 0; i < taille; i += 3){
+        unsigned int bloc = octets[i] << 16;
+        if(i + 1 < taille){
+            bloc |= octets[i + 1] << 8;
+        }
+        if(i + 2 < taille){
+            bloc |= octets[i + 2];
+        }
+
+        chaine.push_back(alphabetBase64[(bloc >> 18) & 0x3F]);
+        chaine.push_back(alphabetBase64[(bloc >> 12) & 0x3F]);
+        chaine.push_back(i + 1 < taille ? alphabetBase64[(bloc >> 6) & 0x3F] : '=');
+        chaine.push_back(i + 2 < taille ? alphabetBase64[bloc & 0x3F] : '=');
+    }
+
+    return chaine;
+}
+
+bool estPetitBoutiste(){
+    const uint16_t valeur = 1;
+    return *reinterpret_cast<const unsigned char*>(&valeur) == 1;
+}
+
+void inverserOctets(unsigned char* octets, size_t taille, size_t tailleElement){
+    if(tailleElement <= 1){
+        return;
+    }
+    for(size_t i = 0; i + tailleElement <= taille; i += tailleElement){
+        for(size_t a = i, b = i + tailleElement - 1; a < b; a++, b--){
+            unsigned char aux = octets[a];
+            octets[a] = octets[b];
+            octets[b] = aux;
+        }
+    }
+}
+
+bool zlibDisponible(){
+#ifdef AVEC_ZLIB
+    return true;
+#else
+    return false;
+#endif
+}
+
+std::vector<unsigned char> decompresserZlib(const unsigned char* octets, size_t taille, size_t tailleDecompressee){
+#ifdef AVEC_ZLIB
+    std::vector<unsigned char> resultat(tailleDecompressee);
+    uLongf tailleObtenue = tailleDecompressee;
+    if(uncompress(resultat.data(), &tailleObtenue, octets, taille) != Z_OK || tailleObtenue != tailleDecompressee){
+        throw std::invalid_argument("Erreur lors de la décompression zlib");
+    }
+    return resultat;
+#else
+    (void) octets;
+    (void) taille;
+    (void) tailleDecompressee;
+    throw std::runtime_error("Le programme a été compilé sans zlib");
+#endif
+}
+
+uint64_t encoderZigzag(int64_t valeur){
+    return (static_cast<uint64_t>(valeur) << 1) ^ static_cast<uint64_t>(valeur >> 63);
+}
+
+int64_t decoderZigzag(uint64_t valeur){
+    return static_cast<int64_t>(valeur >> 1) ^ -static_cast<int64_t>(valeur & 1);
+}
+
+void ajouterVarint(std::vector<char>& sortie, uint64_t valeur){
+    while(valeur >= 0x80){
+        sortie.push_back(static_cast<char>((valeur & 0x7F) | 0x80));
+        valeur >>= 7;
+    }
+    sortie.push_back(static_cast<char>(valeur));
+}
+
+uint64_t lireVarint(const char*& curseur, const char* fin){
+    uint64_t valeur = 0;
+    for(int decalage = 0; decalage < 64; decalage += 7){
+        if(curseur >= fin){
+            throw std::invalid_argument("Entier à longueur variable tronqué");
+        }
+        unsigned char octet = static_cast<unsigned char>(*curseur++);
+        valeur |= static_cast<uint64_t>(octet & 0x7F) << decalage;
+        if(!(octet & 0x80)){
+            return valeur;
+        }
+    }
+    throw std::invalid_argument("Entier à longueur variable trop long");
+}
@@ -8,8 +8,8 @@ std::ifstream ouvrirFichierDEntree(const std::string& adresseFichier){
     return fichier;
 }
 
-std::ofstream ouvrirFichierDeSortie(const std::string& adresseFichier){
-    std::ofstream fichier(adresseFichier);
+std::ofstream ouvrirFichierDeSortie(const std::string& adresseFichier, bool ajouter){
+    std::ofstream fichier(adresseFichier, ajouter ? std::ios::app : std::ios::out);
     if(!fichier.is_open()){
         throw std::runtime_error("Erreur lors de l'overture du fichier de sortie " + adresseFichier);
     }
@@ -1,4 +1,5 @@
 #include "imprimer.hxx"
+#include "univers.hxx"
 
 void imprimerParticulesSurConsole(const std::vector<Particule>& particules){
     for(auto& particule : particules){
@@ -6,12 +7,23 @@ void imprimerParticulesSurConsole(const std::vector<Particule>& particules){
     }
 }
 
-void imprimerGrilleSurConsole(const std::vector<Cellule>& grille){
-    for(const auto& cellule : grille){
+void imprimerGrilleSurConsole(const Univers& univers){
+    for(const auto& cellule : univers.getGrille()){
         std::cout << "Indice : " << cellule.getIndices() << "\n";
         std::cout << "Voisines : " << "\n";
-        for(const auto voisine : cellule.getVoisines()){
+        for(const auto voisine : univers.getVoisines(cellule)){
             std::cout << "  " << voisine->getIndices() << "\n";
         }
     }
 }
+
+void imprimerColonne(std::ostream& flux, const std::string& texte, size_t largeur, bool aGauche){
+
+    /* Compter les caractères plutôt que les octets */
+    size_t caracteres = 0;
+    for(char octet : texte){
+        caracteres += (static_cast<unsigned char>(octet) & 0xC0) != 0x80;
+    }
+    std::string espaces(largeur > caracteres ? largeur - caracteres : 0, ' ');
+    flux << (aGauche ? texte + espaces : espaces + texte);
+}
@@ -0,0 +1,222 @@
+#include "memoire.hxx"
+#include <cmath>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <unistd.h>
+#include "cellule.hxx"
+#include "configuration.hxx"
+#include "imprimer.hxx"
+
+namespace{
+
+    /* Nombre d'octets dans un Mo */
+    const double OCTETS_PAR_MO = 1024.0 * 1024.0;
+
+    /* Densité au-delà de laquelle la mémoire d'une cellule est extrapolée */
+    const size_t DENSITE_MAXIMALE = 1 << 16;
+
+    /* Calculer la mémoire d'un conteneur de cellule rempli de n pointeurs */
+    size_t octetsParticulesCellule(size_t n){
+        ConteneurParticules conteneur;
+        for(size_t i = 0; i < n; i++){
+            conteneur.insert(conteneur.end(), reinterpret_cast<Particule*>(i + 1));
+        }
+        return octetsConteneur(conteneur);
+    }
+
+}
+
+/* EstimationMemoire */
+
+size_t EstimationMemoire::getTotal() const{
+    size_t total = 0;
+    for(int p = 0; p < static_cast<int>(PosteMemoire::Nombre); p++){
+        total += octets[p];
+    }
+    return total;
+}
+
+/* Constructeur */
+
+Memoire::Memoire(){
+    reinitialiser();
+}
+
+Memoire& Memoire::getInstance(){
+    static Memoire instance;
+    return instance;
+}
+
+/* Méthodes publiques */
+
+void Memoire::reinitialiser(){
+    for(int p = 0; p < static_cast<int>(PosteMemoire::Nombre); p++){
+        octets[p] = 0;
+        pics[p] = 0;
+    }
+    rss = 0;
+    picRSS = 0;
+}
+
+void Memoire::enregistrer(PosteMemoire poste, size_t n){
+    octets[static_cast<int>(poste)] = n;
+    pics[static_cast<int>(poste)] = std::max(pics[static_cast<int>(poste)], n);
+}
+
+size_t Memoire::echantillonnerRSS(){
+    rss = lireRSS();
+    picRSS = std::max(picRSS, rss);
+    return rss;
+}
+
+void Memoire::afficherResume(std::ostream& flux) const{
+    flux << "\nMémoire :\n\n";
+    flux << "\t";
+    imprimerColonne(flux, "Poste", 24);
+    flux << std::setw(14) << "Actuelle (Mo)" << std::setw(12) << "Pic (Mo)" << "\n";
+    flux << std::fixed << std::setprecision(2);
+    size_t totalPics = 0;
+    for(int p = 0; p < static_cast<int>(PosteMemoire::Nombre); p++){
+        flux << "\t";
+        imprimerColonne(flux, getNom(static_cast<PosteMemoire>(p)), 24);
+        flux << std::setw(14) << octets[p] / OCTETS_PAR_MO << std::setw(12) << pics[p] / OCTETS_PAR_MO << "\n";
+        totalPics += pics[p];
+    }
+    flux << "\t";
+    imprimerColonne(flux, "Total", 24);
+    flux << std::setw(14) << getTotal() / OCTETS_PAR_MO << std::setw(12) << totalPics / OCTETS_PAR_MO << "\n";
+
+    flux << "\n\tMémoire résidente : " << rss / OCTETS_PAR_MO << " Mo (pic échantillonné "
+         << picRSS / OCTETS_PAR_MO << " Mo, pic du processus " << lireRSSMaximal() / OCTETS_PAR_MO << " Mo)\n\n";
+    flux.unsetf(std::ios::fixed);
+    flux << std::setprecision(6);
+}
+
+/* Getters */
+
+size_t Memoire::getOctets(PosteMemoire poste) const{
+    return octets[static_cast<int>(poste)];
+}
+
+size_t Memoire::getPic(PosteMemoire poste) const{
+    return pics[static_cast<int>(poste)];
+}
+
+size_t Memoire::getTotal() const{
+    size_t total = 0;
+    for(int p = 0; p < static_cast<int>(PosteMemoire::Nombre); p++){
+        total += octets[p];
+    }
+    return total;
+}
+
+size_t Memoire::getPicRSS() const{
+    return picRSS;
+}
+
+size_t Memoire::lireRSS(){
+    std::ifstream fichier("/proc/self/statm");
+    size_t pagesTotales = 0, pagesResidentes = 0;
+    if(!(fichier >> pagesTotales >> pagesResidentes)){
+        return 0;
+    }
+    return pagesResidentes * static_cast<size_t>(sysconf(_SC_PAGESIZE));
+}
+
+size_t Memoire::lireRSSMaximal(){
+    std::ifstream fichier("/proc/self/status");
+    std::string ligne;
+    while(std::getline(fichier, ligne)){
+        if(ligne.compare(0, 6, "VmHWM:") == 0){
+            std::istringstream valeur(ligne.substr(6));
+            size_t kilooctets = 0;
+            valeur >> kilooctets;
+            return kilooctets * 1024;
+        }
+    }
+    return 0;
+}
+
+size_t Memoire::lireMemoirePhysique(){
+    long pages = sysconf(_SC_PHYS_PAGES);
+    long taillePage = sysconf(_SC_PAGESIZE);
+    if(pages <= 0 || taillePage <= 0){
+        return 0;
+    }
+    return static_cast<size_t>(pages) * static_cast<size_t>(taillePage);
+}
+
+const char* Memoire::getNom(PosteMemoire poste){
+    switch(poste){
+        case PosteMemoire::Particules: return "Particules";
+        case PosteMemoire::Cellules: return "Cellules";
+        case PosteMemoire::Voisines: return "Voisines";
+        case PosteMemoire::ParticulesCellules: return "Particules des cellules";
+        case PosteMemoire::Parois: return "Parois";
+        case PosteMemoire::Sorties: return "Tampons de sortie";
+        default: return "?";
+    }
+}
+
+/* Fonctions */
+
+size_t octetsAllocation(size_t n){
+    if(n == 0){
+        return 0;
+    }
+
+    /* glibc ajoute un en-tête de 8 octets, aligne sur 16 et réserve au moins 32 octets */
+    return std::max<size_t>(32, (n + sizeof(size_t) + 15) / 16 * 16);
+}
+
+EstimationMemoire estimerMemoire(const Vecteur<double>& ld, double rCut, size_t nombreParticules, int subdivision){
+    EstimationMemoire estimation;
+
+    /* Nombre de cellules et de voisines par direction, comme dans le constructeur
+    d'Univers, le stencil étant majoré par 2k+1 décalages par direction */
+    const double longueurs[3] = {ld.getX(), ld.getY(), ld.getZ()};
+    size_t nombreVoisines = 1;
+    estimation.nombreCellules = 1;
+    for(double longueur : longueurs){
+        size_t nc = (longueur != 0) ? std::max(1.0, std::floor(longueur * subdivision / rCut)) : 1;
+        estimation.nombreCellules *= nc;
+        nombreVoisines *= (nc == 1) ? 1 : 2*subdivision + 1;
+    }
+
+    estimation.octets[static_cast<int>(PosteMemoire::Particules)] = octetsAllocation(nombreParticules * sizeof(Particule));
+    estimation.octets[static_cast<int>(PosteMemoire::Cellules)] = octetsAllocation(estimation.nombreCellules * sizeof(Cellule)) + 
+                                                                   octetsAllocation(estimation.nombreCellules);
+
+    /* Le stencil des voisines est commun à toutes les cellules */
+    std::vector<Vecteur<int>> stencil(nombreVoisines);
+    std::vector<int> stencilLineaire(nombreVoisines);
+    estimation.octets[static_cast<int>(PosteMemoire::Voisines)] = octetsConteneur(stencil) + octetsConteneur(stencilLineaire);
+
+    /* Interpoler entre les densités entières voisines de la densité moyenne */
+    double densite = static_cast<double>(nombreParticules) / estimation.nombreCellules;
+    size_t densiteBasse = static_cast<size_t>(densite);
+    double fraction = densite - densiteBasse;
+    double parCellule = (1 - fraction) * octetsParticulesCellule(densiteBasse) + fraction * octetsParticulesCellule(densiteBasse + 1);
+    if(densite > DENSITE_MAXIMALE){
+        parCellule = densite * octetsParticulesCellule(DENSITE_MAXIMALE) / DENSITE_MAXIMALE;
+    }
+    estimation.octets[static_cast<int>(PosteMemoire::ParticulesCellules)] = static_cast<size_t>(parCellule * estimation.nombreCellules);
+
+    return estimation;
+}
+
+void verifierMemoire(const EstimationMemoire& estimation){
+    double memoireMaximale = Configuration::getInstance().getMemoireMaximale();
+    size_t limite = memoireMaximale > 0 ? static_cast<size_t>(memoireMaximale * OCTETS_PAR_MO) : Memoire::lireMemoirePhysique();
+    if(limite > 0 && estimation.getTotal() > limite){
+        std::ostringstream message;
+        message << std::fixed << std::setprecision(2)
+                << "Mémoire estimée (" << estimation.getTotal() / OCTETS_PAR_MO << " Mo pour "
+                << estimation.nombreCellules << " cellules) supérieure à la mémoire autorisée ("
+                << limite / OCTETS_PAR_MO << " Mo)";
+        throw std::invalid_argument(message.str());
+    }
+}
@@ -0,0 +1,13 @@
+#include "sommation.hxx"
+
+double sommerParPaires(const double* valeurs, size_t n){
+    if(n <= 8){
+        double somme = 0;
+        for(size_t i = 0; i < n; i++){
+            somme += valeurs[i];
+        }
+        return somme;
+    }
+    size_t moitie = n / 2;
+    return sommerParPaires(valeurs, moitie) + sommerParPaires(valeurs + moitie, n - moitie);
+}
@@ -0,0 +1,134 @@
+#include "trace.hxx"
+#include <iomanip>
+#include "fichier.hxx"
+#include "memoire.hxx"
+
+/* Tampon attribué au thread courant et activation à laquelle il appartient */
+static thread_local int indiceTamponThread = -1;
+static thread_local uint64_t generationTamponThread = 0;
+
+/* Constructeur */
+
+Trace::Trace() : enregistrement(false), actif(false), iterationDebut(0), iterationFin(-1), nombreThreads(0), generation(0){}
+
+Trace& Trace::getInstance(){
+    static Trace instance;
+    return instance;
+}
+
+/* Méthodes privées */
+
+Trace::TamponTrace* Trace::getTamponThread(){
+    if(generationTamponThread != generation){
+        generationTamponThread = generation;
+        indiceTamponThread = nombreThreads.fetch_add(1, std::memory_order_relaxed);
+    }
+    if(indiceTamponThread >= static_cast<int>(tampons.size())){
+        return nullptr;
+    }
+    return tampons[indiceTamponThread].get();
+}
+
+/* Méthodes publiques */
+
+void Trace::activer(int iterationDebut, int iterationFin, size_t capacite, int nombreTampons){
+    this->iterationDebut = iterationDebut;
+    this->iterationFin = iterationFin;
+    tampons.clear();
+    for(int t = 0; t < nombreTampons; t++){
+        tampons.emplace_back(new TamponTrace());
+        tampons.back()->evenements.resize(capacite);
+    }
+    nombreThreads = 0;
+    generation++;
+    origine = std::chrono::steady_clock::now();
+    actif = true;
+
+    /* Réserver le premier tampon au thread qui active la trace */
+    getTamponThread();
+    enregistrement = iterationDebut <= 0;
+}
+
+void Trace::desactiver(){
+    actif = false;
+    enregistrement = false;
+}
+
+void Trace::setIteration(int iteration){
+    enregistrement.store(actif && iteration >= iterationDebut && (iterationFin < 0 || iteration <= iterationFin), std::memory_order_relaxed);
+}
+
+void Trace::enregistrer(const char* nom, const char* categorie,
+                        std::chrono::steady_clock::time_point debut, std::chrono::steady_clock::time_point fin){
+    TamponTrace* tampon = getTamponThread();
+    if(tampon == nullptr){
+        return;
+    }
+
+    /* Seul ce thread écrit dans son tampon : publier l'événement après l'avoir rempli */
+    uint64_t ecrits = tampon->ecrits.load(std::memory_order_relaxed);
+    EvenementTrace& evenement = tampon->evenements[ecrits % tampon->evenements.size()];
+    evenement.nom = nom;
+    evenement.categorie = categorie;
+    evenement.debut = std::chrono::duration_cast<std::chrono::nanoseconds>(debut - origine).count();
+    evenement.duree = std::chrono::duration_cast<std::chrono::nanoseconds>(fin - debut).count();
+    tampon->ecrits.store(ecrits + 1, std::memory_order_release);
+}
+
+void Trace::ecrire(const std::string& adresseFichier) const{
+    std::ofstream fichier = ouvrirFichierDeSortie(adresseFichier);
+    fichier << std::fixed << std::setprecision(3);
+    fichier << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n";
+    fichier << "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":1,\"tid\":0,\"args\":{\"name\":\"simulation\"}}";
+    for(int t = 0; t < getNombreThreads(); t++){
+        fichier << ",\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" << t
+                << ",\"args\":{\"name\":\"Thread " << t << "\"}}";
+        for(const auto& evenement : getEvenements(t)){
+            fichier << ",\n{\"name\":\"" << evenement.nom << "\",\"cat\":\"" << evenement.categorie
+                    << "\",\"ph\":\"X\",\"pid\":1,\"tid\":" << t
+                    << ",\"ts\":" << evenement.debut * 1e-3 << ",\"dur\":" << evenement.duree * 1e-3 << "}";
+        }
+    }
+    fichier << "\n]}\n";
+    fichier.close();
+    if(!fichier){
+        throw std::runtime_error("Erreur lors de l'écriture de la trace " + adresseFichier);
+    }
+}
+
+/* Getters */
+
+std::vector<EvenementTrace> Trace::getEvenements(int thread) const{
+    std::vector<EvenementTrace> evenements;
+    if(thread < 0 || thread >= getNombreThreads()){
+        return evenements;
+    }
+    const TamponTrace& tampon = *tampons[thread];
+    uint64_t ecrits = tampon.ecrits.load(std::memory_order_acquire);
+    uint64_t capacite = tampon.evenements.size();
+    for(uint64_t k = (ecrits > capacite ? ecrits - capacite : 0); k < ecrits; k++){
+        evenements.push_back(tampon.evenements[k % capacite]);
+    }
+    return evenements;
+}
+
+int Trace::getNombreThreads() const{
+    return std::min(nombreThreads.load(), static_cast<int>(tampons.size()));
+}
+
+uint64_t Trace::getEvenementsPerdus() const{
+    uint64_t perdus = 0;
+    for(int t = 0; t < getNombreThreads(); t++){
+        uint64_t ecrits = tampons[t]->ecrits.load(std::memory_order_acquire);
+        perdus += ecrits > tampons[t]->evenements.size() ? ecrits - tampons[t]->evenements.size() : 0;
+    }
+    return perdus;
+}
+
+size_t Trace::getOctets() const{
+    size_t octets = octetsConteneur(tampons);
+    for(const auto& tampon : tampons){
+        octets += octetsAllocation(sizeof(TamponTrace)) + octetsConteneur(tampon->evenements);
+    }
+    return octets;
+}
@@ -0,0 +1,232 @@
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+#include <map>
+#include <new>
+#include <sstream>
+#include <thread>
+#include "simulation.hxx"
+#include "scenarios.hxx"
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+/* Code de sortie interprété par ctest comme un test ignoré */
+static const int CODE_IGNORE = 77;
+
+/* Nombre d'allocations dynamiques du programme */
+static std::atomic<uint64_t> nombreAllocations{0};
+
+void* operator new(size_t taille){
+    nombreAllocations.fetch_add(1, std::memory_order_relaxed);
+    if(void* pointeur = std::malloc(taille == 0 ? 1 : taille)){
+        return pointeur;
+    }
+    throw std::bad_alloc();
+}
+
+void operator delete(void* pointeur) noexcept{
+    std::free(pointeur);
+}
+
+void operator delete(void* pointeur, size_t) noexcept{
+    std::free(pointeur);
+}
+
+/**
+* @brief
+* Structure décrivant un cas de référence et sa mesure.
+*/
+
+struct CasPerformance{
+    std::string nom; /**< Nom du scénario ('carre' ou 'disque'). */
+    int nombreParticules; /**< Nombre de particules demandé. */
+    int pas; /**< Nombre de pas de temps mesurés. */
+    double pasParSeconde = 0; /**< Pas de temps par seconde. */
+    double allocationsParPas = 0; /**< Allocations dynamiques par pas de temps. */
+    double tolerance = 0.25; /**< Perte de débit relative tolérée. */
+    std::string compilation; /**< Type de compilation et variantes du stockage des particules. */
+    std::string processeur; /**< Modèle du processeur de la machine. */
+    unsigned int threads = 0; /**< Nombre de threads matériels de la machine. */
+};
+
+/* Décrire la compilation : type de construction et options qui modifient
+le stockage des particules */
+static std::string decrireCompilation(){
+    std::string compilation = TYPE_COMPILATION;
+    if(compilation.empty()){
+        compilation = "aucun";
+    }
+#if defined(CELLULE_VECTOR)
+    compilation += "-vector";
+#elif defined(CELLULE_DEQUE)
+    compilation += "-deque";
+#elif defined(CELLULE_PETIT_VECTEUR)
+    compilation += "-petit_vecteur";
+#elif defined(CELLULE_COLONIE)
+    compilation += "-colonie";
+#else
+    compilation += "-list";
+#endif
+#ifdef GRAND_SYSTEME
+    compilation += "-grand_systeme";
+#endif
+    return compilation;
+}
+
+/* Lire le modèle du processeur, sans virgule pour rester dans sa colonne */
+static std::string lireProcesseur(){
+    std::ifstream fichier("/proc/cpuinfo");
+    std::string ligne;
+    while(std::getline(fichier, ligne)){
+        if(ligne.compare(0, 10, "model name") == 0 && ligne.find(':') != std::string::npos){
+            std::string modele = ligne.substr(ligne.find(':') + 1);
+            modele.erase(0, modele.find_first_not_of(" \t"));
+            std::replace(modele.begin(), modele.end(), ',', ' ');
+            return modele;
+        }
+    }
+    return "inconnu";
+}
+
+/* Renseigner la compilation et la machine de la mesure */
+static void decrireMachine(CasPerformance& cas){
+    cas.compilation = decrireCompilation();
+    cas.processeur = lireProcesseur();
+    cas.threads = std::thread::hardware_concurrency();
+}
+
+/* Cas mesurés, avec leurs paramètres par défaut */
+static const std::vector<CasPerformance> CAS = {
+    {"carre", 8000, 100},
+    {"disque", 4000, 100}
+};
+
+/* Mesurer un cas sur un thread, en gardant la meilleure de trois répétitions */
+static void mesurer(CasPerformance& cas){
+    cas.pasParSeconde = 0;
+    for(int repetition = 0; repetition < 3; repetition++){
+        DescriptionScenario description = genererScenario(lireScenario(cas.nom), cas.nombreParticules);
+        configurerScenario(description);
+        Configuration& configuration = Configuration::getInstance();
+        configuration.setRCut(2.5);
+        configuration.setSorties(false);
+        configuration.setDelta(0.00005);
+        configuration.setTFinal(0.00005 * (cas.pas - 0.5));
+
+        Univers univers;
+        for(auto& particule : description.particules){
+            univers.ajouterParticule(particule);
+        }
+        Simulation simulation(univers);
+
+        uint64_t allocations = nombreAllocations.load();
+        auto debut = std::chrono::steady_clock::now();
+        simulation.stromerVerlet();
+        std::chrono::duration<double> duree = std::chrono::steady_clock::now() - debut;
+        allocations = nombreAllocations.load() - allocations;
+
+        cas.pasParSeconde = std::max(cas.pasParSeconde, simulation.getIteration() / duree.count());
+        cas.allocationsParPas = static_cast<double>(allocations) / simulation.getIteration();
+    }
+}
+
+/* Lire le fichier de référence :
+scenario,particules,pas,pas_par_s,allocations_par_pas,tolerance,compilation,processeur,threads */
+static std::map<std::string, CasPerformance> lireReference(const std::string& adresseFichier){
+    std::map<std::string, CasPerformance> reference;
+    std::ifstream fichier(adresseFichier);
+    std::string ligne;
+    std::getline(fichier, ligne);
+    while(std::getline(fichier, ligne)){
+        std::stringstream flux(ligne);
+        std::string champ;
+        CasPerformance cas;
+        std::getline(flux, cas.nom, ',');
+        std::getline(flux, champ, ','); cas.nombreParticules = std::stoi(champ);
+        std::getline(flux, champ, ','); cas.pas = std::stoi(champ);
+        std::getline(flux, champ, ','); cas.pasParSeconde = std::stod(champ);
+        std::getline(flux, champ, ','); cas.allocationsParPas = std::stod(champ);
+        std::getline(flux, champ, ','); cas.tolerance = std::stod(champ);
+        std::getline(flux, cas.compilation, ',');
+        std::getline(flux, cas.processeur, ',');
+        if(std::getline(flux, champ, ',')){
+            cas.threads = std::stoul(champ);
+        }
+        reference[cas.nom] = cas;
+    }
+    return reference;
+}
+
+/* Mesurer les scénarios et les comparer à la référence, ou la réécrire */
+int main(int argc, char *argv[]){
+
+    if(argc != 3){
+        std::cerr << "Utilisation : " << argv[0] << " <fichier de référence> <scenario|--mettre-a-jour>" << std::endl;
+        return 1;
+    }
+    std::string adresseReference = argv[1];
+    std::string argument = argv[2];
+#ifdef _OPENMP
+    omp_set_num_threads(1);
+#endif
+
+    /* Réécrire la référence avec les mesures de cette machine */
+    if(argument == "--mettre-a-jour"){
+        std::map<std::string, CasPerformance> ancienne = lireReference(adresseReference);
+        std::ofstream fichier(adresseReference);
+        fichier << "scenario,particules,pas,pas_par_s,allocations_par_pas,tolerance,compilation,processeur,threads\n";
+        for(CasPerformance cas : CAS){
+            if(ancienne.count(cas.nom)){
+                cas.tolerance = ancienne[cas.nom].tolerance;
+            }
+            mesurer(cas);
+            decrireMachine(cas);
+            std::cout << cas.nom << " : " << cas.pasParSeconde << " pas/s, " << cas.allocationsParPas << " allocations/pas\n";
+            fichier << cas.nom << "," << cas.nombreParticules << "," << cas.pas << "," << cas.pasParSeconde << ","
+                    << cas.allocationsParPas << "," << cas.tolerance << "," << cas.compilation << ","
+                    << cas.processeur << "," << cas.threads << "\n";
+        }
+        return fichier ? 0 : 1;
+    }
+
+    std::map<std::string, CasPerformance> reference = lireReference(adresseReference);
+    if(!reference.count(argument)){
+        std::cout << "Aucune référence pour " << argument << " dans " << adresseReference << "\n";
+        return CODE_IGNORE;
+    }
+
+    /* Un débit mesuré sur une autre machine ou avec une autre compilation
+    n'est pas comparable à la référence */
+    CasPerformance attendu = reference[argument];
+    CasPerformance mesure = attendu;
+    decrireMachine(mesure);
+    if(mesure.compilation != attendu.compilation || mesure.processeur != attendu.processeur || mesure.threads != attendu.threads){
+        std::cout << "Référence de " << argument << " mesurée sur une autre configuration :\n"
+                  << "\tréférence : " << attendu.compilation << ", " << attendu.processeur << ", " << attendu.threads << " threads\n"
+                  << "\tmachine : " << mesure.compilation << ", " << mesure.processeur << ", " << mesure.threads << " threads\n"
+                  << "Mettre à jour la référence avec la cible reference_performance\n";
+        return CODE_IGNORE;
+    }
+    mesurer(mesure);
+
+    double rapport = mesure.pasParSeconde / attendu.pasParSeconde;
+    std::cout << argument << " (" << mesure.nombreParticules << " particules, " << mesure.pas << " pas)\n"
+              << "\tdébit : " << mesure.pasParSeconde << " pas/s, référence " << attendu.pasParSeconde
+              << " (" << 100 * (rapport - 1) << " %, tolérance -" << 100 * attendu.tolerance << " %)\n"
+              << "\tallocations : " << mesure.allocationsParPas << " par pas, référence " << attendu.allocationsParPas << "\n";
+
+    /* Les allocations sont déterministes : seule une petite marge est admise */
+    bool regression = false;
+    if(rapport < 1 - attendu.tolerance){
+        std::cout << "Régression du débit\n";
+        regression = true;
+    }
+    if(mesure.allocationsParPas > attendu.allocationsParPas * 1.05 + 0.5){
+        std::cout << "Régression des allocations\n";
+        regression = true;
+    }
+    return regression ? 1 : 0;
+}
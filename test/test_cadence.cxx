@@ -0,0 +1,47 @@
+#include <gtest/gtest.h>
+#include "cadence.hxx"
+
+TEST(CadenceTest, testIntervalleEnIterations){
+    Cadence cadence(3);
+    ASSERT_TRUE(cadence.estActive());
+    ASSERT_TRUE(cadence.doitSortir(0, 0));
+    ASSERT_FALSE(cadence.doitSortir(1, 0.1));
+    ASSERT_FALSE(cadence.doitSortir(2, 0.2));
+    ASSERT_TRUE(cadence.doitSortir(3, 0.3));
+}
+
+TEST(CadenceTest, testDesactivee){
+    Cadence cadence;
+    ASSERT_FALSE(cadence.estActive());
+    ASSERT_FALSE(cadence.doitSortir(0, 0));
+}
+
+TEST(CadenceTest, testIntervalleEnTemps){
+
+    /* Le temps est accumulé comme dans la simulation, avec ses erreurs d'arrondi */
+    Cadence cadence(1, 0.01);
+    double temps = 0;
+    int sorties = 0;
+    for(int i = 0; i < 100; i++, temps += 0.001){
+        if(cadence.doitSortir(i, temps)){
+            ASSERT_EQ(i % 10, 0);
+            sorties++;
+        }
+    }
+    ASSERT_EQ(sorties, 10);
+}
+
+TEST(CadenceTest, testIntervalleEnTempsApresReprise){
+
+    /* La première sortie a lieu au premier multiple de l'intervalle atteint */
+    Cadence cadence(0, 0.5);
+    ASSERT_FALSE(cadence.doitSortir(12, 1.2));
+    ASSERT_FALSE(cadence.doitSortir(13, 1.4));
+    ASSERT_TRUE(cadence.doitSortir(14, 1.5));
+    ASSERT_FALSE(cadence.doitSortir(15, 1.6));
+
+    /* Un pas plus grand que l'intervalle ne provoque qu'une sortie */
+    ASSERT_TRUE(cadence.doitSortir(16, 3.1));
+    ASSERT_FALSE(cadence.doitSortir(17, 3.4));
+    ASSERT_TRUE(cadence.doitSortir(18, 3.5));
+}
@@ -10,12 +10,6 @@ TEST(CelluleTest, testGettersAndSetters){
     ASSERT_EQ(cellule.getIndices(), Vecteur<int>(3, 5, 2));
     ASSERT_EQ(cellule.isBord(), true);
 
-    /* Ajouter une cellule voisine et vérifier */
-    Cellule autreCellule;
-    cellule.ajouterVoisine(&autreCellule);
-    ASSERT_EQ(cellule.getVoisines().size(), 1);
-    ASSERT_EQ(*cellule.getVoisines().begin(), &autreCellule);
-
     /* Ajouter une particule et vérifier */
     Particule particule(3, 4, 5);
     cellule.ajouterParticule(&particule);
@@ -23,7 +17,7 @@ TEST(CelluleTest, testGettersAndSetters){
     ASSERT_EQ(*cellule.getParticules().begin(), &particule);
 
     /* Supprimer la particule et vérifier */
-    std::list<Particule*>::const_iterator it = cellule.getParticules().begin(); 
+    ConteneurParticules::const_iterator it = cellule.getParticules().begin(); 
     cellule.suprimerParticule(it);
     ASSERT_EQ(cellule.getParticules().size(), 0);
 }
@@ -34,3 +28,45 @@ TEST(CelluleTest, testComparerIndices){
     cellule.setIndices(3, 5, 2);
     ASSERT_EQ(cellule.comparerIndices(3, 5, 2), true);
 }
+
+template <typename Conteneur>
+class CelluleConteneurTest : public ::testing::Test {};
+
+using Conteneurs = ::testing::Types<std::list<Particule*>, std::vector<Particule*>, std::deque<Particule*>,
+                                    PetitVecteur<Particule*, 4>, Colonie<Particule*>>;
+TYPED_TEST_SUITE(CelluleConteneurTest, Conteneurs);
+
+TYPED_TEST(CelluleConteneurTest, testSuppressionPendantParcours){
+    CelluleGenerique<TypeParam> cellule;
+    std::vector<Particule> particules;
+    for(int i = 0; i < 10; i++){
+        particules.emplace_back(i, 0, 0);
+    }
+    for(Particule& particule : particules){
+        cellule.ajouterParticule(&particule);
+    }
+
+    /* Supprimer les particules d'abscisse paire pendant le parcours, comme corrigerCellules */
+    const auto& contenu = cellule.getParticules();
+    int visitees = 0;
+    for(auto it = contenu.begin(); it != contenu.end();){
+        visitees++;
+        if(static_cast<int>((*it)->getPosition().getX()) % 2 == 0){
+            it = cellule.suprimerParticule(it);
+        }else{
+            it++;
+        }
+    }
+    ASSERT_EQ(visitees, 10);
+    ASSERT_EQ(cellule.getParticules().size(), 5u);
+
+    std::set<int> restantes;
+    for(Particule* particule : cellule.getParticules()){
+        restantes.insert(particule->getPosition().getX());
+    }
+    ASSERT_EQ(restantes, std::set<int>({1, 3, 5, 7, 9}));
+
+    /* Vider la cellule, comme lors du rattachement des particules après une réallocation */
+    cellule.vider();
+    ASSERT_EQ(cellule.getParticules().size(), 0u);
+}
@@ -0,0 +1,71 @@
+#include <gtest/gtest.h>
+#include <sstream>
+#include <thread>
+#include "simulation.hxx"
+
+TEST(ChronometrageTest, testChronometrePhase){
+    Chronometrage& chronometrage = Chronometrage::getInstance();
+    chronometrage.reinitialiser();
+
+    {
+        ChronometrePhase chronometre(Phase::SortieVTU);
+        std::this_thread::sleep_for(std::chrono::milliseconds(2));
+    }
+    chronometrage.compter(Compteur::Interactions, 5);
+
+    ASSERT_EQ(chronometrage.getAppels(Phase::SortieVTU), 1u);
+    ASSERT_GE(chronometrage.getDuree(Phase::SortieVTU), 0.002);
+    ASSERT_EQ(chronometrage.getAppels(Phase::Derive), 0u);
+    ASSERT_EQ(chronometrage.getCompteur(Compteur::Interactions), 5u);
+
+    /* Seules les phases exécutées apparaissent dans le résumé */
+    std::ostringstream resume;
+    chronometrage.afficherResume(resume, 1);
+    ASSERT_NE(resume.str().find("Sortie VTU"), std::string::npos);
+    ASSERT_EQ(resume.str().find("Dérive"), std::string::npos);
+
+    chronometrage.reinitialiser();
+    ASSERT_EQ(chronometrage.getAppels(Phase::SortieVTU), 0u);
+    ASSERT_EQ(chronometrage.getCompteur(Compteur::Interactions), 0u);
+}
+
+TEST(ChronometrageTest, testPhasesDeLaSimulation){
+#ifndef AVEC_CHRONOMETRAGE
+    GTEST_SKIP() << "Chronomètres retirés à la compilation";
+#endif
+
+    /* Établir la configuration de l'univers */
+    Configuration& configuration = Configuration::getInstance();
+    configuration.setConditionLimite(ConditionLimite::Absorption);
+    configuration.setForces(false, true, false);
+    configuration.setSorties(false);
+    configuration.setDelta(0.005);
+    configuration.setTFinal(0.04);
+    configuration.setLd(3, 3, 0);
+    configuration.setRCut(3);
+
+    Univers univers;
+    Particule particule1("A", 1.333333,0,0, 0,3.162,0, 1);
+    Particule particule2("B", -0.6666667,0,0, 0,-1.581,0, 2);
+    univers.ajouterParticule(particule1);
+    univers.ajouterParticule(particule2);
+
+    Simulation simulation(univers);
+    simulation.stromerVerlet();
+
+    /* Chaque phase de l'intégrateur est exécutée une fois par itération */
+    Chronometrage& chronometrage = Chronometrage::getInstance();
+    uint64_t iterations = simulation.getIteration();
+    ASSERT_GT(iterations, 0u);
+    ASSERT_EQ(chronometrage.getAppels(Phase::Derive), iterations);
+    ASSERT_EQ(chronometrage.getAppels(Phase::CorrectionCellules), iterations);
+    ASSERT_EQ(chronometrage.getAppels(Phase::Kick), iterations);
+    ASSERT_EQ(chronometrage.getAppels(Phase::ForcesPaires), iterations + 1);
+    ASSERT_EQ(chronometrage.getAppels(Phase::ForcesReflexion), 0u);
+    ASSERT_EQ(chronometrage.getAppels(Phase::SortieVTU), 0u);
+
+    /* La paire de particules interagit à chaque calcul des forces */
+    ASSERT_GE(chronometrage.getCompteur(Compteur::PairesEvaluees), iterations + 1);
+    ASSERT_GE(chronometrage.getCompteur(Compteur::Interactions), iterations + 1);
+    ASSERT_LE(chronometrage.getCompteur(Compteur::Interactions), chronometrage.getCompteur(Compteur::PairesEvaluees));
+}
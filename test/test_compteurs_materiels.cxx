@@ -0,0 +1,48 @@
+#include <gtest/gtest.h>
+#include <sstream>
+#include "compteurs_materiels.hxx"
+
+TEST(CompteursMaterielsTest, testAttributionAuxPhases){
+    CompteursMateriels& compteurs = CompteursMateriels::getInstance();
+    if(!compteurs.ouvrir()){
+        GTEST_SKIP() << "perf_event_open indisponible";
+    }
+    Chronometrage::getInstance().reinitialiser();
+    ASSERT_GE(compteurs.getNombreThreads(), 1);
+
+    /* Occuper le thread principal pendant une phase */
+    volatile double somme = 0;
+    {
+        ChronometrePhase chronometre(Phase::ForcesPaires);
+        for(int i = 0; i < 2000000; i++){
+            somme = somme + i * 0.5;
+        }
+    }
+
+    /* Les événements disponibles ont varié pendant la phase, pas pendant les autres */
+    bool variation = false;
+    for(int e = 0; e < static_cast<int>(EvenementMateriel::Nombre); e++){
+        EvenementMateriel evenement = static_cast<EvenementMateriel>(e);
+        if(compteurs.estDisponible(evenement)){
+            ASSERT_EQ(compteurs.getTotal(Phase::Kick, 0, evenement), 0u);
+            variation = variation || compteurs.getTotal(Phase::ForcesPaires, 0, evenement) > 0;
+        }else{
+            ASSERT_EQ(compteurs.getTotal(Phase::ForcesPaires, 0, evenement), 0u);
+        }
+    }
+    ASSERT_TRUE(variation);
+    if(compteurs.estDisponible(EvenementMateriel::Instructions)){
+        ASSERT_GT(compteurs.getTotal(Phase::ForcesPaires, 0, EvenementMateriel::Instructions), 2000000u);
+    }
+
+    std::ostringstream resume;
+    compteurs.afficherResume(resume);
+    ASSERT_NE(resume.str().find("Forces de paires"), std::string::npos);
+
+    /* Une fois fermés, les compteurs ne sont plus lus */
+    compteurs.fermer();
+    ASSERT_FALSE(compteurs.estActif());
+    std::ostringstream vide;
+    compteurs.afficherResume(vide);
+    ASSERT_TRUE(vide.str().empty());
+}
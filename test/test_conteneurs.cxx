@@ -0,0 +1,77 @@
+#include <gtest/gtest.h>
+#include "conteneurs.hxx"
+
+TEST(ConteneursTest, testPetitVecteurLocalPuisAlloue){
+    PetitVecteur<int, 4> vecteur;
+    for(int i = 0; i < 4; i++){
+        vecteur.push_back(i);
+    }
+    ASSERT_TRUE(vecteur.estLocal());
+
+    /* Le cinquième élément impose une allocation, le contenu est conservé */
+    vecteur.push_back(4);
+    ASSERT_FALSE(vecteur.estLocal());
+    ASSERT_EQ(vecteur.size(), 5u);
+    for(int i = 0; i < 5; i++){
+        ASSERT_EQ(vecteur[i], i);
+    }
+
+    /* La copie est indépendante */
+    PetitVecteur<int, 4> copie = vecteur;
+    copie[0] = 42;
+    ASSERT_EQ(vecteur[0], 0);
+    ASSERT_EQ(copie.back(), 4);
+}
+
+TEST(ConteneursTest, testPetitVecteurInsertionEtSuppression){
+    PetitVecteur<int, 2> vecteur;
+    vecteur.push_back(1);
+    vecteur.push_back(3);
+    vecteur.insert(vecteur.begin() + 1, 2);
+    ASSERT_EQ(vecteur.size(), 3u);
+    ASSERT_EQ(vecteur[1], 2);
+
+    /* La suppression conserve l'ordre des suivants */
+    auto it = vecteur.erase(vecteur.begin());
+    ASSERT_EQ(*it, 2);
+    ASSERT_EQ(vecteur.front(), 2);
+    ASSERT_EQ(vecteur.back(), 3);
+
+    vecteur.pop_back();
+    vecteur.clear();
+    ASSERT_TRUE(vecteur.empty());
+}
+
+TEST(ConteneursTest, testColonieReutiliseLesEmplacements){
+    int a = 1, b = 2, c = 3, d = 4;
+    Colonie<int*> colonie;
+    colonie.insert(colonie.end(), &a);
+    colonie.insert(colonie.end(), &b);
+    colonie.insert(colonie.end(), &c);
+
+    /* Supprimer le milieu laisse un trou sauté par le parcours */
+    auto it = colonie.erase(++colonie.begin());
+    ASSERT_EQ(*it, &c);
+    ASSERT_EQ(colonie.size(), 2u);
+    std::vector<int*> parcourus(colonie.begin(), colonie.end());
+    ASSERT_EQ(parcourus, std::vector<int*>({&a, &c}));
+
+    /* L'insertion suivante comble le trou sans agrandir la colonie */
+    colonie.insert(colonie.end(), &d);
+    ASSERT_EQ(colonie.getNombreEmplacements(), 3u);
+    parcourus.assign(colonie.begin(), colonie.end());
+    ASSERT_EQ(parcourus, std::vector<int*>({&a, &d, &c}));
+}
+
+TEST(ConteneursTest, testColonieVideeOublieSesEmplacements){
+    int a = 1, b = 2;
+    Colonie<int*> colonie;
+    colonie.insert(colonie.end(), &a);
+    colonie.insert(colonie.end(), &b);
+
+    auto it = colonie.erase(colonie.begin());
+    it = colonie.erase(it);
+    ASSERT_TRUE(it == colonie.end());
+    ASSERT_TRUE(colonie.empty());
+    ASSERT_EQ(colonie.getNombreEmplacements(), 0u);
+}
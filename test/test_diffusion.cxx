@@ -0,0 +1,133 @@
+#include <gtest/gtest.h>
+#include <unistd.h>
+#include "simulation.hxx"
+
+/* Nom de segment propre au processus, les tests pouvant s'exécuter en parallèle */
+static std::string nomSegmentTest(const std::string& suffixe){
+    return "/test_diffusion_" + std::to_string(getpid()) + "_" + suffixe;
+}
+
+static void preparerUnivers(Univers& univers){
+    Particule particule1("A", 1, 2, 0, 0.5, -1, 0, 2);
+    univers.ajouterParticule(particule1);
+    Particule particule2("A", -3, 0.5, 0, 0, 0, 0, 1);
+    univers.ajouterParticule(particule2);
+    Particule particule3("B", 4, -4, 0, 1, 1, 0, 1);
+    univers.ajouterParticule(particule3);
+    univers.remplirCellules();
+}
+
+TEST(DiffusionTest, testPublicationEtLecture){
+    Configuration& configuration = Configuration::getInstance();
+    configuration.setConditionLimite(ConditionLimite::Reflexion);
+    configuration.setLd(10, 10, 0);
+    configuration.setRCut(2.5);
+    Univers univers;
+    preparerUnivers(univers);
+
+    const std::string nom = nomSegmentTest("lecture");
+    DiffusionEtat diffusion(nom, univers.getLd(), 16);
+    LecteurDiffusion lecteur(nom);
+    ASSERT_EQ(lecteur.getEntete().capacite, 16u);
+    ASSERT_EQ(lecteur.getEntete().ld[0], 10);
+
+    /* Aucune frame avant la première publication */
+    FrameDiffusion frame;
+    ASSERT_FALSE(lecteur.lireDerniereFrame(frame));
+
+    diffusion.publier(univers, 7, 0.25);
+    ASSERT_TRUE(lecteur.lireDerniereFrame(frame));
+    ASSERT_EQ(frame.numero, 1u);
+    ASSERT_EQ(frame.iteration, 7);
+    ASSERT_EQ(frame.temps, 0.25);
+    ASSERT_EQ(frame.nombreParticules, 3u);
+    ASSERT_EQ(frame.nombreTotal, 3u);
+
+    /* Les colonnes désignent directement la mémoire partagée, positions centrées sur l'origine */
+    bool trouvee = false;
+    for(uint64_t k = 0; k < frame.nombreParticules; k++){
+        if(frame.masses[k] == 2){
+            trouvee = true;
+            ASSERT_FLOAT_EQ(frame.positions[3*k], 1);
+            ASSERT_FLOAT_EQ(frame.positions[3*k + 1], 2);
+            ASSERT_FLOAT_EQ(frame.vitesses[3*k], 0.5);
+            ASSERT_FLOAT_EQ(frame.vitesses[3*k + 1], -1);
+        }
+    }
+    ASSERT_TRUE(trouvee);
+    ASSERT_TRUE(lecteur.estValide(frame));
+    ASSERT_FALSE(lecteur.estTerminee());
+}
+
+TEST(DiffusionTest, testAnneauEtFrameReecrite){
+    Configuration& configuration = Configuration::getInstance();
+    configuration.setConditionLimite(ConditionLimite::Reflexion);
+    configuration.setLd(10, 10, 0);
+    configuration.setRCut(2.5);
+    Univers univers;
+    preparerUnivers(univers);
+
+    /* Une frame reste valide tant que son emplacement n'est pas réutilisé */
+    const std::string nom = nomSegmentTest("anneau");
+    DiffusionEtat diffusion(nom, univers.getLd(), 16, 3);
+    LecteurDiffusion lecteur(nom);
+    diffusion.publier(univers, 0, 0);
+    FrameDiffusion frame;
+    ASSERT_TRUE(lecteur.lireDerniereFrame(frame));
+    diffusion.publier(univers, 1, 0.1);
+    diffusion.publier(univers, 2, 0.2);
+    ASSERT_TRUE(lecteur.estValide(frame));
+    diffusion.publier(univers, 3, 0.3);
+    ASSERT_FALSE(lecteur.estValide(frame));
+
+    /* La dernière frame est toujours accessible */
+    ASSERT_TRUE(lecteur.lireDerniereFrame(frame));
+    ASSERT_EQ(frame.numero, 4u);
+    ASSERT_EQ(frame.iteration, 3);
+
+    /* Au-delà de la capacité, la frame est tronquée */
+    const std::string nomTronque = nomSegmentTest("tronque");
+    DiffusionEtat diffusionTronquee(nomTronque, univers.getLd(), 2);
+    LecteurDiffusion lecteurTronque(nomTronque);
+    diffusionTronquee.publier(univers, 0, 0);
+    ASSERT_TRUE(lecteurTronque.lireDerniereFrame(frame));
+    ASSERT_EQ(frame.nombreParticules, 2u);
+    ASSERT_EQ(frame.nombreTotal, 3u);
+}
+
+TEST(DiffusionTest, testSimulationDiffusee){
+    Configuration& configuration = Configuration::getInstance();
+    configuration.setConditionLimite(ConditionLimite::Reflexion);
+    configuration.setForces(true, false, false);
+    configuration.setSorties(false);
+    configuration.setLd(10, 10, 0);
+    configuration.setRCut(2.5);
+    configuration.setDelta(0.001);
+    configuration.setTFinal(0.0205);
+    const std::string nom = nomSegmentTest("simulation");
+    configuration.setDiffusion(nom, 5);
+
+    Univers univers;
+    Particule particule4("A", 1, 2, 0, 0.5, -1, 0, 1);
+    univers.ajouterParticule(particule4);
+    Particule particule5("A", -3, 0.5, 0, 0, 0, 0, 1);
+    univers.ajouterParticule(particule5);
+    std::unique_ptr<LecteurDiffusion> lecteur;
+    {
+        Simulation simulation(univers);
+        lecteur.reset(new LecteurDiffusion(nom));
+        ASSERT_EQ(lecteur->getEntete().capacite, 1024u);
+        simulation.stromerVerlet();
+    }
+    configuration.setDiffusion("", 100);
+
+    /* Frames des itérations 0, 5, 10, 15 et 20 puis état final,
+    toujours lisibles après la suppression du segment */
+    FrameDiffusion frame;
+    ASSERT_TRUE(lecteur->estTerminee());
+    ASSERT_TRUE(lecteur->lireDerniereFrame(frame));
+    ASSERT_EQ(frame.numero, 6u);
+    ASSERT_EQ(frame.iteration, 21);
+    ASSERT_EQ(frame.nombreParticules, 2u);
+    ASSERT_THROW(LecteurDiffusion lecteurTardif(nom), std::runtime_error);
+}
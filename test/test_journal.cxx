@@ -0,0 +1,186 @@
+#include <gtest/gtest.h>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include "journal.hxx"
+
+/* Adresse d'un fichier de test dans le dossier temporaire */
+static std::string adresseTemporaire(const std::string& nomFichier){
+    return (std::filesystem::temp_directory_path() / nomFichier).string();
+}
+
+static void configurerUnivers(){
+    Configuration& configuration = Configuration::getInstance();
+    configuration.setConditionLimite(ConditionLimite::Periodique);
+    configuration.setLd(10, 10, 0);
+    configuration.setRCut(2.5);
+}
+
+/* Remplir l'univers avec quatre particules */
+static void remplirUnivers(Univers& univers){
+    for(int i = 0; i < 4; i++){
+        Particule particule("A", -3 + 2*i, 1, 0, 0.5, -0.25, 0, 1.5);
+        univers.ajouterParticule(particule);
+    }
+    univers.remplirCellules();
+}
+
+/* Lire les lignes d'un fichier texte */
+static std::vector<std::string> lireLignes(const std::string& adresse){
+    std::ifstream fichier(adresse);
+    std::vector<std::string> lignes;
+    std::string ligne;
+    while(std::getline(fichier, ligne)){
+        lignes.push_back(ligne);
+    }
+    return lignes;
+}
+
+TEST(JournalTest, testLireChamps){
+    ASSERT_EQ(lireChampsJournal("id, position,masse"), JOURNAL_ID | JOURNAL_POSITION | JOURNAL_MASSE);
+    ASSERT_EQ(lireChampsJournal(""), 0u);
+    ASSERT_THROW(lireChampsJournal("id,acceleration"), std::invalid_argument);
+}
+
+TEST(JournalTest, testFormatCsv){
+    const std::string adresse = adresseTemporaire("journal_test.csv");
+    configurerUnivers();
+    Univers univers;
+    remplirUnivers(univers);
+    {
+        JournalParticules journal(adresse, FormatJournal::Csv, JOURNAL_CATEGORIE | JOURNAL_VITESSE | JOURNAL_MASSE);
+        journal.ecrire(univers, 0, 0);
+        journal.ecrire(univers, 1000, 0.05);
+    }
+
+    std::vector<std::string> lignes = lireLignes(adresse);
+    ASSERT_EQ(lignes.size(), 9u);
+    ASSERT_EQ(lignes[0], "iteration,temps,categorie,vx,vy,vz,masse");
+    ASSERT_EQ(lignes[1], "0,0,A,0.5,-0.25,0,1.5");
+    ASSERT_EQ(lignes[8], "1000,0.05,A,0.5,-0.25,0,1.5");
+    std::remove(adresse.c_str());
+}
+
+TEST(JournalTest, testEchantillonnageEtTamponPetit){
+    const std::string adresse = adresseTemporaire("journal_echantillon.csv");
+    configurerUnivers();
+    Univers univers;
+    remplirUnivers(univers);
+
+    /* Un tampon minuscule force plusieurs vidages au cours d'une écriture */
+    {
+        JournalParticules journal(adresse, FormatJournal::Csv, JOURNAL_ID | JOURNAL_POSITION, 2, -1, 1);
+        journal.ecrire(univers, 0, 0);
+    }
+
+    std::vector<std::string> lignes = lireLignes(adresse);
+    ASSERT_EQ(lignes.size(), 3u);
+    for(size_t k = 1; k < lignes.size(); k++){
+        int64_t id = std::stoll(lignes[k].substr(4));
+        ASSERT_EQ(id % 2, 0);
+    }
+    std::remove(adresse.c_str());
+}
+
+TEST(JournalTest, testFormatBinaire){
+    const std::string adresse = adresseTemporaire("journal_test.bin");
+    configurerUnivers();
+    Univers univers;
+    remplirUnivers(univers);
+    size_t tailleEnregistrement;
+    {
+        JournalParticules journal(adresse, FormatJournal::Binaire, JOURNAL_ID | JOURNAL_CATEGORIE | JOURNAL_POSITION);
+        journal.ecrire(univers, 7, 0.5);
+        tailleEnregistrement = journal.getTailleEnregistrement();
+    }
+    ASSERT_EQ(tailleEnregistrement, 2*sizeof(int64_t) + 4*sizeof(double));
+
+    /* Relire l'en-tête puis le premier enregistrement */
+    std::ifstream fichier(adresse, std::ios::binary);
+    std::string contenu((std::istreambuf_iterator<char>(fichier)), std::istreambuf_iterator<char>());
+    const size_t tailleEntete = 16;
+    ASSERT_EQ(contenu.size(), tailleEntete + 4*tailleEnregistrement);
+    ASSERT_EQ(contenu.substr(0, 7), "SIMJRNL");
+
+    uint32_t champs;
+    std::memcpy(&champs, contenu.data() + 12, sizeof(champs));
+    ASSERT_EQ(champs, JOURNAL_ID | JOURNAL_POSITION);
+
+    int64_t iteration;
+    double temps, y;
+    std::memcpy(&iteration, contenu.data() + tailleEntete, sizeof(iteration));
+    std::memcpy(&temps, contenu.data() + tailleEntete + 8, sizeof(temps));
+    std::memcpy(&y, contenu.data() + tailleEntete + 32, sizeof(y));
+    ASSERT_EQ(iteration, 7);
+    ASSERT_EQ(temps, 0.5);
+    ASSERT_DOUBLE_EQ(y, 1);
+    std::remove(adresse.c_str());
+}
+
+TEST(JournalTest, testRepriseTronqueLeJournal){
+    const std::string adresse = adresseTemporaire("journal_reprise.csv");
+    configurerUnivers();
+    Univers univers;
+    remplirUnivers(univers);
+    {
+        JournalParticules journal(adresse, FormatJournal::Csv, JOURNAL_MASSE);
+        journal.ecrire(univers, 0, 0);
+        journal.ecrire(univers, 1000, 0.05);
+        journal.ecrire(univers, 2000, 0.1);
+    }
+
+    /* Simuler une ligne interrompue en cours d'écriture */
+    {
+        std::ofstream fichier(adresse, std::ios::app);
+        fichier << "3000,0.1";
+    }
+
+    /* La reprise à l'itération 1000 réécrit cette itération et les suivantes */
+    {
+        JournalParticules journal(adresse, FormatJournal::Csv, JOURNAL_MASSE, 1, 1000);
+        journal.ecrire(univers, 1000, 0.05);
+    }
+
+    std::vector<std::string> lignes = lireLignes(adresse);
+    ASSERT_EQ(lignes.size(), 9u);
+    ASSERT_EQ(lignes[0], "iteration,temps,masse");
+    ASSERT_EQ(lignes[4], "0,0,1.5");
+    ASSERT_EQ(lignes[5], "1000,0.05,1.5");
+    ASSERT_EQ(lignes[8], "1000,0.05,1.5");
+    std::remove(adresse.c_str());
+}
+
+TEST(JournalTest, testRepriseTronqueLeJournalBinaire){
+    const std::string adresse = adresseTemporaire("journal_reprise.bin");
+    configurerUnivers();
+    Univers univers;
+    remplirUnivers(univers);
+    size_t tailleEnregistrement;
+    {
+        JournalParticules journal(adresse, FormatJournal::Binaire, JOURNAL_ID);
+        journal.ecrire(univers, 0, 0);
+        journal.ecrire(univers, 1000, 0.05);
+        tailleEnregistrement = journal.getTailleEnregistrement();
+    }
+
+    /* Simuler un enregistrement interrompu en cours d'écriture */
+    {
+        std::ofstream fichier(adresse, std::ios::binary | std::ios::app);
+        fichier.write("\x01\x02\x03", 3);
+    }
+
+    {
+        JournalParticules journal(adresse, FormatJournal::Binaire, JOURNAL_ID, 1, 1000);
+        journal.ecrire(univers, 1000, 0.05);
+    }
+
+    std::ifstream fichier(adresse, std::ios::binary);
+    std::string contenu((std::istreambuf_iterator<char>(fichier)), std::istreambuf_iterator<char>());
+    const size_t tailleEntete = 16;
+    ASSERT_EQ(contenu.size(), tailleEntete + 8*tailleEnregistrement);
+
+    int64_t iteration;
+    std::memcpy(&iteration, contenu.data() + tailleEntete + 4*tailleEnregistrement, sizeof(iteration));
+    ASSERT_EQ(iteration, 1000);
+    std::remove(adresse.c_str());
+}
@@ -0,0 +1,206 @@
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <cstdio>
+#include <filesystem>
+#include "lecture.hxx"
+
+/* Construire l'univers de test et lire le fichier, écrit puis supprimé
+dans le dossier temporaire */
+static std::vector<Particule*> lireParticules(const std::string& nomFichier, const std::string& contenu, Univers& univers){
+    const std::string adresse = (std::filesystem::temp_directory_path() / nomFichier).string();
+    std::ofstream fichier(adresse, std::ios::binary);
+    fichier << contenu;
+    fichier.close();
+
+    lectureDuFichier(adresse, univers);
+    std::remove(adresse.c_str());
+    univers.remplirCellules();
+
+    std::vector<Particule*> particules;
+    for(const auto& cellule : univers.getGrille()){
+        for(const auto particule : cellule.getParticules()){
+            particules.push_back(particule);
+        }
+    }
+    std::sort(particules.begin(), particules.end(), [](Particule* a, Particule* b){ return a->getId() < b->getId(); });
+    return particules;
+}
+
+/* Encoder un tableau binaire avec un en-tête UInt32 */
+template <typename T>
+static std::string encoderTableau(const std::vector<T>& valeurs){
+    uint32_t nombreOctets = valeurs.size() * sizeof(T);
+    std::string octets(reinterpret_cast<const char*>(&nombreOctets), 4);
+    octets.append(reinterpret_cast<const char*>(valeurs.data()), nombreOctets);
+    return encoderBase64(reinterpret_cast<const unsigned char*>(octets.data()), octets.size());
+}
+
+static void configurerUnivers(){
+    Configuration& configuration = Configuration::getInstance();
+    configuration.setConditionLimite(ConditionLimite::Absorption);
+    configuration.setLd(10, 10, 10);
+    configuration.setRCut(2.5);
+}
+
+TEST(LectureTest, testFormatAscii){
+    configurerUnivers();
+    Univers univers;
+
+    std::string contenu =
+        "<VTKFile type=\"UnstructuredGrid\" version=\"0.1\" byte_order=\"BigEndian\">\n"
+        "<UnstructuredGrid><Piece NumberOfPoints=\"2\" NumberOfCells=\"0\">\n"
+        "<Points><DataArray name=\"Position\" type=\"Float32\" NumberOfComponents=\"3\" format=\"ascii\">\n"
+        "1 2 3\n"
+        "-1 -2 -3\n"
+        "</DataArray></Points>\n"
+        "<PointData><DataArray type=\"Float32\" Name=\"Velocity\" NumberOfComponents=\"3\" format=\"ascii\">\n"
+        "0 1 0 0 -1 0\n"
+        "</DataArray>\n"
+        "<DataArray type=\"Float32\" Name=\"Masse\" format=\"ascii\">2 3</DataArray>\n"
+        "</PointData></Piece></UnstructuredGrid></VTKFile>\n";
+
+    std::vector<Particule*> particules = lireParticules("lecture_ascii.vtu", contenu, univers);
+
+    ASSERT_EQ(particules.size(), 2);
+    ASSERT_EQ(particules[0]->getPosition(), Vecteur<double>(6, 7, 8));
+    ASSERT_EQ(particules[1]->getPosition(), Vecteur<double>(4, 3, 2));
+    ASSERT_EQ(particules[1]->getVitesse(), Vecteur<double>(0, -1, 0));
+    ASSERT_EQ(particules[1]->getMasse(), 3);
+}
+
+TEST(LectureTest, testFormatBinaireBase64){
+    configurerUnivers();
+    Univers univers;
+
+    std::string ordre = estPetitBoutiste() ? "LittleEndian" : "BigEndian";
+    std::string contenu =
+        "<VTKFile type=\"UnstructuredGrid\" version=\"1.0\" byte_order=\"" + ordre + "\" header_type=\"UInt32\">\n"
+        "<UnstructuredGrid><Piece NumberOfPoints=\"2\" NumberOfCells=\"0\">\n"
+        "<Points><DataArray type=\"Float64\" Name=\"Points\" NumberOfComponents=\"3\" format=\"binary\">\n" +
+        encoderTableau(std::vector<double>{1.5, 2, 3, -1, -2, -3.25}) + "\n"
+        "</DataArray></Points>\n"
+        "<PointData>\n"
+        "<DataArray type=\"Int32\" Name=\"Categorie\" format=\"binary\">" + encoderTableau(std::vector<int32_t>{7, 9}) + "</DataArray>\n"
+        "<DataArray type=\"Int64\" Name=\"Id\" format=\"binary\">" + encoderTableau(std::vector<int64_t>{42, 17}) + "</DataArray>\n"
+        "</PointData></Piece></UnstructuredGrid></VTKFile>\n";
+
+    std::vector<Particule*> particules = lireParticules("lecture_binaire.vtu", contenu, univers);
+
+    ASSERT_EQ(particules.size(), 2);
+    ASSERT_EQ(particules[0]->getId(), 17);
+    ASSERT_EQ(particules[0]->getCategorie(), "9");
+    ASSERT_EQ(particules[0]->getPosition(), Vecteur<double>(4, 3, 1.75));
+    ASSERT_EQ(particules[1]->getId(), 42);
+    ASSERT_EQ(particules[1]->getPosition(), Vecteur<double>(6.5, 7, 8));
+}
+
+TEST(LectureTest, testDonneesAjouteesBrutesGrandBoutiste){
+    configurerUnivers();
+    Univers univers;
+
+    /* Construire les données ajoutées en ordre grand-boutiste */
+    std::vector<float> positions = {1, 2, 3, -1, -2, -3};
+    std::vector<float> vitesses = {0.5f, 0, 0, 0, 0, -0.5f};
+    std::string donnees;
+    for(const auto* tableau : {&positions, &vitesses}){
+        uint32_t nombreOctets = tableau->size() * sizeof(float);
+        std::string bloc(reinterpret_cast<const char*>(&nombreOctets), 4);
+        bloc.append(reinterpret_cast<const char*>(tableau->data()), nombreOctets);
+        if(estPetitBoutiste()){
+            inverserOctets(reinterpret_cast<unsigned char*>(&bloc[0]), bloc.size(), 4);
+        }
+        donnees += bloc;
+    }
+
+    std::string contenu =
+        "<VTKFile type=\"UnstructuredGrid\" version=\"1.0\" byte_order=\"BigEndian\">\n"
+        "<UnstructuredGrid><Piece NumberOfPoints=\"2\" NumberOfCells=\"0\">\n"
+        "<Points><DataArray type=\"Float32\" Name=\"Points\" NumberOfComponents=\"3\" format=\"appended\" offset=\"0\"/></Points>\n"
+        "<PointData><DataArray type=\"Float32\" Name=\"Velocity\" NumberOfComponents=\"3\" format=\"appended\" offset=\"28\"/></PointData>\n"
+        "</Piece></UnstructuredGrid>\n"
+        "<AppendedData encoding=\"raw\">\n_" + donnees + "\n</AppendedData></VTKFile>\n";
+
+    std::vector<Particule*> particules = lireParticules("lecture_ajoutees.vtu", contenu, univers);
+
+    ASSERT_EQ(particules.size(), 2);
+    ASSERT_EQ(particules[0]->getPosition(), Vecteur<double>(6, 7, 8));
+    ASSERT_EQ(particules[0]->getVitesse(), Vecteur<double>(0.5, 0, 0));
+    ASSERT_EQ(particules[1]->getVitesse(), Vecteur<double>(0, 0, -0.5));
+}
+
+TEST(LectureTest, testFormatBinaireCompresse){
+    if(!zlibDisponible()){
+        GTEST_SKIP();
+    }
+
+    configurerUnivers();
+    Univers univers;
+
+    /* Construire un flux zlib à bloc stocké (sans compression) */
+    std::vector<double> positions = {1, 2, 3, -1, -2, -3};
+    const unsigned char* brut = reinterpret_cast<const unsigned char*>(positions.data());
+    uint16_t taille = positions.size() * sizeof(double);
+    std::string flux = {'\x78', '\x01', '\x01'};
+    flux.push_back(taille & 0xFF);
+    flux.push_back(taille >> 8);
+    flux.push_back(~taille & 0xFF);
+    flux.push_back((~taille >> 8) & 0xFF);
+    flux.append(reinterpret_cast<const char*>(brut), taille);
+    uint32_t a = 1, b = 0;
+    for(int i = 0; i < taille; i++){
+        a = (a + brut[i]) % 65521;
+        b = (b + a) % 65521;
+    }
+    uint32_t adler = (b << 16) | a;
+    for(int decalage = 24; decalage >= 0; decalage -= 8){
+        flux.push_back((adler >> decalage) & 0xFF);
+    }
+
+    /* En-tête : un bloc, taille du bloc, taille du dernier bloc, taille compressée */
+    std::vector<uint32_t> entete = {1, taille, taille, static_cast<uint32_t>(flux.size())};
+    std::string donnees = encoderBase64(reinterpret_cast<const unsigned char*>(entete.data()), entete.size() * 4) +
+                          encoderBase64(reinterpret_cast<const unsigned char*>(flux.data()), flux.size());
+
+    std::string ordre = estPetitBoutiste() ? "LittleEndian" : "BigEndian";
+    std::string contenu =
+        "<VTKFile type=\"UnstructuredGrid\" version=\"1.0\" byte_order=\"" + ordre + "\" compressor=\"vtkZLibDataCompressor\">\n"
+        "<UnstructuredGrid><Piece NumberOfPoints=\"2\" NumberOfCells=\"0\">\n"
+        "<Points><DataArray type=\"Float64\" Name=\"Points\" NumberOfComponents=\"3\" format=\"binary\">" + donnees + "</DataArray></Points>\n"
+        "</Piece></UnstructuredGrid></VTKFile>\n";
+
+    std::vector<Particule*> particules = lireParticules("lecture_compresse.vtu", contenu, univers);
+
+    ASSERT_EQ(particules.size(), 2);
+    ASSERT_EQ(particules[1]->getPosition(), Vecteur<double>(4, 3, 2));
+}
+
+TEST(LectureTest, testIdentifiantsSoixanteQuatreBits){
+    configurerUnivers();
+
+    /* Au-delà de 2^53, un identifiant lu via un double serait arrondi */
+    const int64_t grand = (int64_t(1) << 53) + 1;
+    const int64_t tresGrand = (int64_t(1) << 62) + 3;
+    std::string ascii =
+        "<VTKFile type=\"UnstructuredGrid\" version=\"0.1\" byte_order=\"LittleEndian\">\n"
+        "<UnstructuredGrid><Piece NumberOfPoints=\"2\" NumberOfCells=\"0\">\n"
+        "<Points><DataArray type=\"Float32\" NumberOfComponents=\"3\" format=\"ascii\">1 2 3 -1 -2 -3</DataArray></Points>\n"
+        "<PointData><DataArray type=\"Int64\" Name=\"Id\" format=\"ascii\">" + std::to_string(grand) + " " + std::to_string(tresGrand) + "</DataArray></PointData>\n"
+        "</Piece></UnstructuredGrid></VTKFile>\n";
+    Univers universAscii;
+    std::vector<Particule*> particules = lireParticules("lecture_ids_ascii.vtu", ascii, universAscii);
+    ASSERT_EQ(particules.size(), 2);
+    ASSERT_EQ(particules[0]->getId(), grand);
+    ASSERT_EQ(particules[1]->getId(), tresGrand);
+
+    std::string binaire =
+        "<VTKFile type=\"UnstructuredGrid\" version=\"0.1\" byte_order=\"" + std::string(estPetitBoutiste() ? "LittleEndian" : "BigEndian") + "\">\n"
+        "<UnstructuredGrid><Piece NumberOfPoints=\"2\" NumberOfCells=\"0\">\n"
+        "<Points><DataArray type=\"Float32\" NumberOfComponents=\"3\" format=\"binary\">" + encoderTableau(std::vector<float>{1, 2, 3, -1, -2, -3}) + "</DataArray></Points>\n"
+        "<PointData><DataArray type=\"Int64\" Name=\"Id\" format=\"binary\">" + encoderTableau(std::vector<int64_t>{tresGrand, grand}) + "</DataArray></PointData>\n"
+        "</Piece></UnstructuredGrid></VTKFile>\n";
+    Univers universBinaire;
+    particules = lireParticules("lecture_ids_binaire.vtu", binaire, universBinaire);
+    ASSERT_EQ(particules.size(), 2);
+    ASSERT_EQ(particules[0]->getId(), grand);
+    ASSERT_EQ(particules[1]->getId(), tresGrand);
+}
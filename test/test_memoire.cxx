@@ -0,0 +1,97 @@
+#include <gtest/gtest.h>
+#include "univers.hxx"
+
+TEST(MemoireTest, testOctetsAllocation){
+    ASSERT_EQ(octetsAllocation(0), 0u);
+    ASSERT_EQ(octetsAllocation(1), 32u);
+    ASSERT_EQ(octetsAllocation(24), 32u);
+    ASSERT_EQ(octetsAllocation(25), 48u);
+
+    std::vector<double> vecteur;
+    vecteur.reserve(100);
+    ASSERT_EQ(octetsConteneur(vecteur), octetsAllocation(800));
+
+    std::list<int*> liste(10);
+    ASSERT_EQ(octetsConteneur(liste), 10 * octetsAllocation(3 * sizeof(void*)));
+}
+
+TEST(MemoireTest, testPicsParPoste){
+    Memoire& memoire = Memoire::getInstance();
+    memoire.reinitialiser();
+    memoire.enregistrer(PosteMemoire::Voisines, 300);
+    memoire.enregistrer(PosteMemoire::Voisines, 100);
+    memoire.enregistrer(PosteMemoire::Sorties, 50);
+    ASSERT_EQ(memoire.getOctets(PosteMemoire::Voisines), 100u);
+    ASSERT_EQ(memoire.getPic(PosteMemoire::Voisines), 300u);
+    ASSERT_EQ(memoire.getTotal(), 150u);
+
+    /* La mémoire résidente est lue dans /proc */
+    ASSERT_GT(memoire.echantillonnerRSS(), 0u);
+    ASSERT_GE(Memoire::lireRSSMaximal(), memoire.getPicRSS() / 2);
+    ASSERT_GT(Memoire::lireMemoirePhysique(), 0u);
+}
+
+TEST(MemoireTest, testEstimationProcheDeLaMesure){
+    Configuration& configuration = Configuration::getInstance();
+    configuration.setConditionLimite(ConditionLimite::Periodique);
+    configuration.setLd(20, 20, 20);
+    configuration.setRCut(2);
+    configuration.setMemoireMaximale(0);
+
+    const size_t nombreParticules = 5000;
+    EstimationMemoire estimation = estimerMemoire(Vecteur<double>(20, 20, 20), 2, nombreParticules);
+    ASSERT_EQ(estimation.nombreCellules, 1000u);
+
+    Univers univers;
+    univers.reserverParticules(nombreParticules);
+    univers.ajouterParticulesAleatoires(nombreParticules);
+    univers.remplirCellules();
+    univers.mesurerMemoire();
+
+    /* La grille et les particules sont exactes, les conteneurs des cellules approchés */
+    Memoire& memoire = Memoire::getInstance();
+    ASSERT_EQ(memoire.getOctets(PosteMemoire::Particules), estimation.octets[static_cast<int>(PosteMemoire::Particules)]);
+    ASSERT_EQ(memoire.getOctets(PosteMemoire::Cellules), estimation.octets[static_cast<int>(PosteMemoire::Cellules)]);
+    ASSERT_EQ(memoire.getOctets(PosteMemoire::Voisines), estimation.octets[static_cast<int>(PosteMemoire::Voisines)]);
+    double mesure = memoire.getOctets(PosteMemoire::ParticulesCellules);
+    double estimee = estimation.octets[static_cast<int>(PosteMemoire::ParticulesCellules)];
+    ASSERT_NEAR(mesure / estimee, 1, 0.5);
+}
+
+TEST(MemoireTest, testRefusAvantConstruction){
+    Configuration& configuration = Configuration::getInstance();
+    configuration.setConditionLimite(ConditionLimite::Periodique);
+    configuration.setLd(400, 400, 400);
+    configuration.setRCut(1.5);
+
+    /* 18 millions de cellules ne tiennent pas dans 10 Mo */
+    configuration.setMemoireMaximale(10);
+    ASSERT_THROW(Univers univers, std::invalid_argument);
+
+    /* Une grille acceptée peut refuser les particules */
+    configuration.setLd(20, 20, 20);
+    Univers univers;
+    ASSERT_THROW(univers.reserverParticules(1000000), std::invalid_argument);
+    configuration.setMemoireMaximale(0);
+}
+
+TEST(MemoireTest, testRefusAvecSubdivision){
+    Configuration& configuration = Configuration::getInstance();
+    configuration.setConditionLimite(ConditionLimite::Periodique);
+    configuration.setLd(60, 60, 60);
+    configuration.setRCut(2.5);
+
+    /* La limite est comprise entre les estimations avec k = 1 et k = 4 :
+    la réservation doit compter les cellules et le stencil subdivisés */
+    const size_t n = 1000;
+    const Vecteur<double> ld(60, 60, 60);
+    double simple = estimerMemoire(ld, 2.5, n, 1).getTotal() / (1024.0 * 1024.0);
+    double subdivisee = estimerMemoire(ld, 2.5, n, 4).getTotal() / (1024.0 * 1024.0);
+    ASSERT_LT(2 * simple, subdivisee);
+    configuration.setSubdivisionCellules(4);
+    Univers univers;
+    configuration.setMemoireMaximale((simple + subdivisee) / 2);
+    ASSERT_THROW(univers.reserverParticules(n), std::invalid_argument);
+    configuration.setMemoireMaximale(0);
+    configuration.setSubdivisionCellules(1);
+}
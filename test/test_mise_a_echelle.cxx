@@ -0,0 +1,89 @@
+#include <gtest/gtest.h>
+#include <sstream>
+#include "mise_a_echelle.hxx"
+
+/* Vérifier que toutes les particules d'un scénario sont dans l'univers */
+static void verifierDansUnivers(const DescriptionScenario& description){
+    const Vecteur<double>& ld = description.ld;
+    for(const auto& particule : description.particules){
+        const Vecteur<double>& position = particule.getPosition();
+        ASSERT_GE(position.getX(), -ld.getX()/2);
+        ASSERT_LT(position.getX(), ld.getX()/2);
+        ASSERT_GE(position.getY(), -ld.getY()/2);
+        ASSERT_LT(position.getY(), ld.getY()/2);
+    }
+}
+
+TEST(MiseAEchelleTest, testCarreSurRectangle){
+
+    /* À 8000 particules, le scénario est celui de colision1.vtu */
+    DescriptionScenario description = genererScenario(Scenario::CarreSurRectangle, 8000);
+    ASSERT_EQ(description.particules.size(), 8000u);
+    ASSERT_DOUBLE_EQ(description.ld.getX(), 250);
+    ASSERT_DOUBLE_EQ(description.ld.getY(), 130);
+    verifierDansUnivers(description);
+
+    /* Les autres tailles sont approchées */
+    description = genererScenario(Scenario::CarreSurRectangle, 100000);
+    ASSERT_NEAR(description.particules.size(), 100000, 5000);
+    verifierDansUnivers(description);
+}
+
+TEST(MiseAEchelleTest, testDisqueSurDalle){
+    DescriptionScenario description = genererScenario(Scenario::DisqueSurDalle, 17567);
+    ASSERT_EQ(description.particules.size(), 17567u);
+    ASSERT_EQ(description.conditionLimite, ConditionLimite::Reflexion);
+    verifierDansUnivers(description);
+
+    description = genererScenario(Scenario::DisqueSurDalle, 2000);
+    ASSERT_NEAR(description.particules.size(), 2000, 200);
+    verifierDansUnivers(description);
+
+    ASSERT_THROW(genererScenario(Scenario::DisqueSurDalle, 0), std::invalid_argument);
+    ASSERT_THROW(lireScenario("triangle"), std::invalid_argument);
+    ASSERT_EQ(lireScenario(getNomScenario(Scenario::DisqueSurDalle)), Scenario::DisqueSurDalle);
+}
+
+TEST(MiseAEchelleTest, testMatriceCSV){
+    std::ostringstream csv;
+    std::vector<MesureMiseAEchelle> mesures = mesurerMiseAEchelle(csv, Scenario::CarreSurRectangle, false, {500, 1000}, {1}, 3);
+
+    ASSERT_EQ(mesures.size(), 2u);
+    for(const auto& mesure : mesures){
+        ASSERT_EQ(mesure.pas, 3);
+        ASSERT_EQ(mesure.threads, 1);
+        ASSERT_GT(mesure.particulesPasParSeconde, 0);
+        ASSERT_DOUBLE_EQ(mesure.efficacite, 1);
+    }
+
+    /* Une ligne d'en-tête puis une ligne par mesure */
+    std::istringstream lignes(csv.str());
+    std::string ligne;
+    std::getline(lignes, ligne);
+    ASSERT_EQ(ligne, "scenario,mode,threads,particules,pas,duree_s,pas_par_s,particules_pas_par_s,efficacite");
+    int nombreLignes = 0;
+    while(std::getline(lignes, ligne)){
+        ASSERT_EQ(ligne.rfind("carre,forte,1,", 0), 0u);
+        nombreLignes++;
+    }
+    ASSERT_EQ(nombreLignes, 2);
+}
+
+TEST(MiseAEchelleTest, testMatriceDeterministe){
+    std::ostringstream csv;
+    std::vector<MesureMiseAEchelle> mesures = mesurerMiseAEchelle(csv, Scenario::CarreSurRectangle, false, {500}, {1}, 3, true);
+
+    /* La référence en mode par défaut précède la mesure déterministe */
+    ASSERT_EQ(mesures.size(), 2u);
+    ASSERT_DOUBLE_EQ(mesures[0].efficacite, 1);
+    ASSERT_EQ(mesures[1].nombreParticules, mesures[0].nombreParticules);
+    ASSERT_GT(mesures[1].efficacite, 0);
+
+    std::istringstream lignes(csv.str());
+    std::string ligne;
+    std::getline(lignes, ligne);
+    std::getline(lignes, ligne);
+    ASSERT_EQ(ligne.rfind("carre,forte,1,", 0), 0u);
+    std::getline(lignes, ligne);
+    ASSERT_EQ(ligne.rfind("carre,deterministe,1,", 0), 0u);
+}
@@ -0,0 +1,202 @@
+#include <gtest/gtest.h>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include "simulation.hxx"
+
+/* Adresse d'un fichier de test dans le dossier temporaire */
+static std::string adresseTemporaire(const std::string& nomFichier){
+    return (std::filesystem::temp_directory_path() / nomFichier).string();
+}
+
+TEST(ParoisTest, testDistancesAnalytiques){
+    double distance;
+    Vecteur<double> normale;
+
+    /* Plan x = 1, fluide du côté des x croissants */
+    Obstacle plan = Obstacle::creerPlan(Vecteur<double>(1, 0, 0), Vecteur<double>(2, 0, 0));
+    ASSERT_TRUE(plan.mesurer(Vecteur<double>(1.5, 7, -3), distance, normale));
+    ASSERT_DOUBLE_EQ(distance, 0.5);
+    ASSERT_EQ(normale, Vecteur<double>(1, 0, 0));
+
+    /* Sphère de rayon 2 */
+    Obstacle sphere = Obstacle::creerSphere(Vecteur<double>(0, 0, 0), 2);
+    sphere.mesurer(Vecteur<double>(0, 3, 0), distance, normale);
+    ASSERT_DOUBLE_EQ(distance, 1);
+    ASSERT_EQ(normale, Vecteur<double>(0, 1, 0));
+    sphere.mesurer(Vecteur<double>(-1, 0, 0), distance, normale);
+    ASSERT_DOUBLE_EQ(distance, -1);
+    ASSERT_EQ(normale, Vecteur<double>(-1, 0, 0));
+
+    /* Boîte [0, 2]^3 : face, arête et intérieur */
+    Obstacle boite = Obstacle::creerBoite(Vecteur<double>(0, 0, 0), Vecteur<double>(2, 2, 2));
+    boite.mesurer(Vecteur<double>(1, 1, 2.5), distance, normale);
+    ASSERT_DOUBLE_EQ(distance, 0.5);
+    ASSERT_EQ(normale, Vecteur<double>(0, 0, 1));
+    boite.mesurer(Vecteur<double>(3, -1, 1), distance, normale);
+    ASSERT_DOUBLE_EQ(distance, std::sqrt(2));
+    ASSERT_NEAR(normale.getX(), 1 / std::sqrt(2), 1e-12);
+    ASSERT_NEAR(normale.getY(), -1 / std::sqrt(2), 1e-12);
+    boite.mesurer(Vecteur<double>(0.25, 1, 1), distance, normale);
+    ASSERT_DOUBLE_EQ(distance, -0.25);
+    ASSERT_EQ(normale, Vecteur<double>(-1, 0, 0));
+}
+
+TEST(ParoisTest, testChampDistance){
+
+    /* Champ d'un plan incliné d(x, y) = (x + y)/sqrt(2) - 1, sur une grille plane */
+    const int nx = 11, ny = 11;
+    std::vector<float> distances;
+    for(int x = 0; x < nx; x++){
+        for(int y = 0; y < ny; y++){
+            distances.push_back((0.5*x + 0.5*y) / std::sqrt(2) - 1);
+        }
+    }
+    Obstacle champ = Obstacle::creerChamp(std::make_shared<const ChampDistance>(Vecteur<int>(nx, ny, 1), Vecteur<double>(0, 0, 0), 0.5, distances));
+
+    /* L'interpolation d'un champ linéaire est exacte à la précision des flottants */
+    double distance;
+    Vecteur<double> normale;
+    ASSERT_TRUE(champ.mesurer(Vecteur<double>(1.3, 2.1, 0), distance, normale));
+    ASSERT_NEAR(distance, 3.4 / std::sqrt(2) - 1, 1e-6);
+    ASSERT_NEAR(normale.getX(), 1 / std::sqrt(2), 1e-6);
+    ASSERT_NEAR(normale.getY(), 1 / std::sqrt(2), 1e-6);
+    ASSERT_EQ(normale.getZ(), 0);
+
+    /* Hors de la grille, la distance n'est pas définie */
+    ASSERT_FALSE(champ.mesurer(Vecteur<double>(-0.1, 2, 0), distance, normale));
+    ASSERT_FALSE(champ.mesurer(Vecteur<double>(1, 5.1, 0), distance, normale));
+
+    ASSERT_THROW(ChampDistance(Vecteur<int>(2, 2, 2), Vecteur<double>(0, 0, 0), 1, std::vector<float>(7)), std::invalid_argument);
+}
+
+TEST(ParoisTest, testLectureFichier){
+    const std::string adresseChamp = adresseTemporaire("test_parois_champ.sdf");
+    const std::string adresseObstacles = adresseTemporaire("test_parois_obstacles.txt");
+    {
+        std::ofstream champ(adresseChamp);
+        champ << "2 2 1\n-1 -1 0\n2\n0 1 1 2\n";
+        std::ofstream obstacles(adresseObstacles);
+        obstacles << "# Obstacles de test\n\nPLAN 0 -4 0 0 1 0\nSPHERE 1 1 0 0.5\nBOITE -1 -1 -1 1 1 1\nCHAMP " << adresseChamp << "\n";
+    }
+
+    /* Les coordonnées du fichier sont translatées vers le repère de la grille */
+    Parois parois;
+    parois.lireFichier(adresseObstacles, Vecteur<double>(5, 5, 0));
+    ASSERT_EQ(parois.getObstacles().size(), 4u);
+    ASSERT_EQ(parois.getObstacles()[0].getType(), TypeObstacle::Plan);
+    ASSERT_EQ(parois.getObstacles()[3].getType(), TypeObstacle::Champ);
+
+    double distance;
+    Vecteur<double> normale;
+    parois.getObstacles()[0].mesurer(Vecteur<double>(5, 2, 0), distance, normale);
+    ASSERT_DOUBLE_EQ(distance, 1);
+    parois.getObstacles()[1].mesurer(Vecteur<double>(6, 7, 0), distance, normale);
+    ASSERT_DOUBLE_EQ(distance, 0.5);
+    ASSERT_TRUE(parois.getObstacles()[3].mesurer(Vecteur<double>(5, 5, 0), distance, normale));
+    ASSERT_NEAR(distance, 1, 1e-6);
+
+    /* Un type inconnu est refusé avec le numéro de ligne */
+    {
+        std::ofstream obstacles(adresseObstacles);
+        obstacles << "CYLINDRE 0 0 0 1\n";
+    }
+    try{
+        parois.lireFichier(adresseObstacles, Vecteur<double>());
+        FAIL();
+    }catch(const std::invalid_argument& erreur){
+        ASSERT_NE(std::string(erreur.what()).find("ligne 1"), std::string::npos);
+    }
+
+    std::remove(adresseChamp.c_str());
+    std::remove(adresseObstacles.c_str());
+}
+
+TEST(ParoisTest, testCellulesProchesReflexion){
+
+    /* En réflexion, seules les cellules au bord de la boîte sont proches des parois */
+    Configuration& configuration = Configuration::getInstance();
+    configuration.setConditionLimite(ConditionLimite::Reflexion);
+    configuration.setFichierObstacles("");
+    configuration.setLd(25, 25, 25);
+    configuration.setRCut(2.5);
+
+    Univers univers;
+    const std::vector<int>& cellulesProches = univers.getParois().getCellulesProches();
+    ASSERT_EQ(univers.getParois().getObstacles().size(), 6u);
+    ASSERT_EQ(cellulesProches.size(), 1000u - 512u);
+    for(int indice : cellulesProches){
+        ASSERT_TRUE(univers.getGrille()[indice].isBord());
+    }
+
+    /* Sans réflexion ni obstacle, aucune cellule n'est visitée */
+    configuration.setConditionLimite(ConditionLimite::Periodique);
+    Univers universPeriodique;
+    ASSERT_TRUE(universPeriodique.getParois().getCellulesProches().empty());
+}
+
+TEST(ParoisTest, testContactFaceBoite){
+    Configuration& configuration = Configuration::getInstance();
+    configuration.setConditionLimite(ConditionLimite::Reflexion);
+    configuration.setFichierObstacles("");
+    configuration.setLd(10, 10, 0);
+    configuration.setRCut(2.5);
+
+    Univers univers;
+    const Parois& parois = univers.getParois();
+
+    /* Une particule près du coin (0, 0) voit les deux faces, à leur distance respective */
+    const Vecteur<double> position(0.5, 0.8, 0);
+    size_t k = std::find(parois.getCellulesProches().begin(), parois.getCellulesProches().end(), univers.getIndiceCellule(position)) - parois.getCellulesProches().begin();
+    ASSERT_LT(k, parois.getCellulesProches().size());
+
+    Vecteur<double> somme;
+    int contacts = 0;
+    parois.pourChaqueContact(k, position, [&](double distance, const Vecteur<double>& normale){
+        somme += normale * distance;
+        contacts++;
+    });
+    ASSERT_EQ(contacts, 2);
+    ASSERT_EQ(somme, Vecteur<double>(0.5, 0.8, 0));
+}
+
+TEST(ParoisTest, testRebondSurSphere){
+    const std::string adresseObstacles = adresseTemporaire("test_parois_sphere.txt");
+    {
+        std::ofstream obstacles(adresseObstacles);
+        obstacles << "SPHERE 0 0 0 2\n";
+    }
+
+    Configuration& configuration = Configuration::getInstance();
+    configuration.setConditionLimite(ConditionLimite::Absorption);
+    configuration.setFichierObstacles(adresseObstacles);
+    configuration.setForces(false, false, false);
+    configuration.setSorties(false);
+    configuration.setLd(20, 20, 0);
+    configuration.setRCut(2.5);
+    configuration.setDelta(0.005);
+    configuration.setTFinal(5);
+
+    Univers univers;
+    std::remove(adresseObstacles.c_str());
+
+    /* Une particule lancée vers la sphère repart en sens inverse sans la traverser */
+    Particule particule("A", -5,0,0, 1,0,0, 1);
+    univers.ajouterParticule(particule);
+
+    Simulation simulation(univers);
+    simulation.stromerVerlet();
+
+    const Particule* rebond = nullptr;
+    for(const auto& cellule : univers.getGrille()){
+        for(const auto p : cellule.getParticules()){
+            rebond = p;
+        }
+    }
+    ASSERT_NE(rebond, nullptr);
+    ASSERT_LT(rebond->getVitesse().getX(), 0);
+    ASSERT_NEAR(rebond->getVitesse().norme(), 1, 1e-3);
+    ASSERT_LT(rebond->getPosition().getX(), 10 - 2);
+
+    configuration.setFichierObstacles("");
+}
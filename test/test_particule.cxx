@@ -25,12 +25,15 @@ TEST(ParticuleTest, testDeplacerAccelerer){
 TEST(ParticuleTest, testOperatorComparaison){
     Particule particule1(1,2,3);
     Particule particule2(4,1,3);
+    particule1.setId(1);
+    particule2.setId(2);
 
     ASSERT_EQ(particule1 < particule2, true);
 }
 
 TEST(ParticuleTest, testOperatorOutput){
     Particule particule("NA", 3,4,5, 0,-10,0, 1);
+    particule.setId(1);
 
     std::stringstream ss;
     ss << particule;
@@ -39,3 +42,54 @@ TEST(ParticuleTest, testOperatorOutput){
 
     ASSERT_EQ(ss.str(), str);
 }
+
+TEST(ParticuleTest, testIdentifiant64Bits){
+    Particule particule(0, 0, 0);
+
+    /* Une particule isolée n'a pas d'identifiant */
+    ASSERT_EQ(particule.getId(), 0);
+
+    particule.setId(int64_t(1) << 40);
+    ASSERT_EQ(particule.getId(), int64_t(1) << 40);
+}
+
+TEST(ParticuleTest, testCategoriesPartagees){
+    Particule particule1("argon", 0,0,0, 0,0,0, 1);
+    Particule particule2(0, 0, 0);
+
+    ASSERT_EQ(particule2.getCategorie(), "N/A");
+    particule2.setCategorie("argon");
+    ASSERT_EQ(particule1.getCategorie(), particule2.getCategorie());
+    ASSERT_EQ(&particule1.getCategorie(), &particule2.getCategorie());
+    particule2.setCategorie("neon");
+    ASSERT_EQ(particule1.getCategorie(), "argon");
+    ASSERT_EQ(particule2.getCategorie(), "neon");
+}
+
+TEST(ParticuleTest, testCategoriesLuesPendantLesInsertions){
+    Particule argon("argon", 0,0,0, 0,0,0, 1);
+    const std::string* adresse = &argon.getCategorie();
+
+    /* Des lectures concurrentes d'insertions qui allouent plusieurs blocs */
+    bool lecturesCorrectes = true;
+    #pragma omp parallel for schedule(static, 1) reduction(&&:lecturesCorrectes)
+    for(int i = 0; i < 1024; i++){
+        if(i % 2 == 0){
+            Particule particule("espece_" + std::to_string(i), 0,0,0, 0,0,0, 1);
+            lecturesCorrectes = lecturesCorrectes && particule.getCategorie() == "espece_" + std::to_string(i);
+        }else{
+            lecturesCorrectes = lecturesCorrectes && &argon.getCategorie() == adresse && argon.getCategorie() == "argon";
+        }
+    }
+    ASSERT_TRUE(lecturesCorrectes);
+    ASSERT_EQ(&argon.getCategorie(), adresse);
+    ASSERT_EQ(Particule("espece_1000", 0,0,0, 0,0,0, 1).getCategorie(), "espece_1000");
+}
+
+TEST(ParticuleTest, testTailleEnregistrement){
+#ifdef GRAND_SYSTEME
+    ASSERT_LE(sizeof(Particule), 64u);
+#else
+    ASSERT_LE(sizeof(Particule), 96u);
+#endif
+}
@@ -0,0 +1,82 @@
+#include <gtest/gtest.h>
+#include "philox.hxx"
+#include "univers.hxx"
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+TEST(PhiloxTest, testVecteursDeReference){
+
+    /* Vecteurs de test de Random123 pour Philox4x32-10 */
+    std::array<uint32_t, 4> zero = Philox(0).generer(0, 0, 0);
+    ASSERT_EQ(zero, (std::array<uint32_t, 4>{0x6627e8d5, 0xe169c58d, 0xbc57ac4c, 0x9b00dbd8}));
+
+    std::array<uint32_t, 4> uns = Philox(~0ULL).generer(~0ULL, 0xffffffff, 0xffffffff);
+    ASSERT_EQ(uns, (std::array<uint32_t, 4>{0x408f276d, 0x41c83b0e, 0xa20bc7c6, 0x6d5451fd}));
+
+    std::array<uint32_t, 4> pi = Philox(0x299f31d0a4093822ULL).generer(0x85a308d3243f6a88ULL, 0x13198a2e, 0x03707344);
+    ASSERT_EQ(pi, (std::array<uint32_t, 4>{0xd16cfe09, 0x94fdcceb, 0x5001e420, 0x24126ea1}));
+}
+
+TEST(PhiloxTest, testMomentsDesLois){
+    Philox philox(12345);
+    const int n = 100000;
+    double sommeUniforme = 0, sommeNormale = 0, sommeCarres = 0;
+    for(int i = 0; i < n; i++){
+        std::array<double, 2> u = philox.uniformes(i, 0);
+        ASSERT_GE(u[0], 0);
+        ASSERT_LT(u[0], 1);
+        sommeUniforme += u[0] + u[1];
+
+        std::array<double, 2> g = philox.normales(i, 1);
+        sommeNormale += g[0] + g[1];
+        sommeCarres += g[0]*g[0] + g[1]*g[1];
+    }
+    ASSERT_NEAR(sommeUniforme / (2*n), 0.5, 0.005);
+    ASSERT_NEAR(sommeNormale / (2*n), 0, 0.01);
+    ASSERT_NEAR(sommeCarres / (2*n), 1, 0.02);
+}
+
+/* Relever les positions et les vitesses d'un univers aléatoire */
+static std::vector<double> tirerUnivers(uint64_t graine, int threads){
+#ifdef _OPENMP
+    int threadsInitiaux = omp_get_max_threads();
+    omp_set_num_threads(threads);
+#else
+    (void)threads;
+#endif
+    Configuration& configuration = Configuration::getInstance();
+    configuration.setConditionLimite(ConditionLimite::Periodique);
+    configuration.setLd(10, 20, 30);
+    configuration.setRCut(2.5);
+    configuration.setGraine(graine);
+
+    Univers univers;
+    univers.ajouterParticulesAleatoires(1000, 0.5);
+    univers.remplirCellules();
+    configuration.setGraine(0);
+#ifdef _OPENMP
+    omp_set_num_threads(threadsInitiaux);
+#endif
+
+    std::vector<double> valeurs;
+    for(const auto& cellule : univers.getGrille()){
+        for(const auto particule : cellule.getParticules()){
+            const Vecteur<double>& position = particule->getPosition();
+            const Vecteur<double>& vitesse = particule->getVitesse();
+            EXPECT_TRUE(position.getX() >= 0 && position.getX() < 10);
+            EXPECT_TRUE(position.getZ() >= 0 && position.getZ() < 30);
+            valeurs.insert(valeurs.end(), {position.getX(), position.getY(), position.getZ(), vitesse.getX(), vitesse.getY(), vitesse.getZ()});
+        }
+    }
+    return valeurs;
+}
+
+TEST(PhiloxTest, testUniversReproductible){
+    std::vector<double> reference = tirerUnivers(7, 1);
+    ASSERT_EQ(reference.size(), 6000u);
+
+    /* Le tirage ne dépend que de la graine, pas du nombre de threads */
+    ASSERT_EQ(tirerUnivers(7, 4), reference);
+    ASSERT_NE(tirerUnivers(8, 1), reference);
+}
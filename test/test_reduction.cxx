@@ -0,0 +1,82 @@
+#include <gtest/gtest.h>
+#include <cstdio>
+#include <filesystem>
+#include "reduction.hxx"
+
+/* Univers 2D de 4 x 4 cellules de côté 2.5 */
+static void configurerUnivers(){
+    Configuration& configuration = Configuration::getInstance();
+    configuration.setConditionLimite(ConditionLimite::Absorption);
+    configuration.setLd(10, 10, 0);
+    configuration.setRCut(2.5);
+}
+
+TEST(ReductionTest, testGrilleDeVoxels){
+    configurerUnivers();
+    Univers univers;
+    ReductionChamps reductionFine(univers);
+    ReductionChamps reductionGrossiere(univers, 3);
+    ASSERT_EQ(reductionFine.getNv(), Vecteur<int>(4, 4, 1));
+    ASSERT_EQ(reductionGrossiere.getNv(), Vecteur<int>(2, 2, 1));
+    ASSERT_THROW(ReductionChamps(univers, 0), std::invalid_argument);
+}
+
+TEST(ReductionTest, testChampsMoyens){
+    configurerUnivers();
+    Univers univers;
+
+    /* Deux particules dans le voxel du coin inférieur gauche, de vitesses opposées en Y */
+    Particule particule1("A", -4, -4, 0, 1, 1, 0, 1);
+    Particule particule2("A", -3, -4, 0, 1, -1, 0, 1);
+    /* Une particule lourde immobile dans le voxel du coin supérieur droit */
+    Particule particule3("B", 4, 4, 0, 0, 0, 0, 5);
+    univers.ajouterParticule(particule1);
+    univers.ajouterParticule(particule2);
+    univers.ajouterParticule(particule3);
+    univers.remplirCellules();
+
+    ReductionChamps reduction(univers, 2);
+    reduction.accumuler(univers);
+    reduction.accumuler(univers);
+    ASSERT_EQ(reduction.getEchantillons(), 2);
+
+    ChampsReduits champs = reduction.calculerChamps();
+    ASSERT_EQ(champs.densites.size(), 4u);
+
+    /* Voxel (0, 0) : 2 particules de masse 1 sur une surface de 5 x 5 */
+    ASSERT_DOUBLE_EQ(champs.nombres[0], 2);
+    ASSERT_DOUBLE_EQ(champs.densites[0], 2.0 / 25);
+    ASSERT_DOUBLE_EQ(champs.vitesses[0], 1);
+    ASSERT_DOUBLE_EQ(champs.vitesses[1], 0);
+
+    /* Agitation : somme de m*(v - vMoyenne)² = 2, répartie sur 2 particules et 2 directions */
+    ASSERT_DOUBLE_EQ(champs.temperatures[0], 0.5);
+
+    /* Voxel (1, 1) : particule immobile */
+    ASSERT_DOUBLE_EQ(champs.densites[3], 5.0 / 25);
+    ASSERT_DOUBLE_EQ(champs.temperatures[3], 0);
+
+    /* Voxels vides */
+    ASSERT_DOUBLE_EQ(champs.densites[1], 0);
+    ASSERT_DOUBLE_EQ(champs.nombres[2], 0);
+}
+
+TEST(ReductionTest, testSauvegardeVTI){
+    configurerUnivers();
+    Univers univers;
+    Particule particule("A", 0, 0, 0, 1, 0, 0, 1);
+    univers.ajouterParticule(particule);
+    univers.remplirCellules();
+
+    ReductionChamps reduction(univers);
+    reduction.accumuler(univers);
+    const std::string adresse = (std::filesystem::temp_directory_path() / "reduction_test.vti").string();
+    reduction.sauvegarderEnVTI(adresse);
+    ASSERT_EQ(reduction.getEchantillons(), 0);
+
+    std::ifstream fichier(adresse);
+    std::string contenu((std::istreambuf_iterator<char>(fichier)), std::istreambuf_iterator<char>());
+    ASSERT_NE(contenu.find("WholeExtent=\"0 4 0 4 0 1\""), std::string::npos);
+    ASSERT_NE(contenu.find("Name=\"Temperature\""), std::string::npos);
+    std::remove(adresse.c_str());
+}
@@ -0,0 +1,226 @@
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include "simulation.hxx"
+
+/* Établir la configuration commune aux simulations */
+static void configurerSimulation(double tFinal){
+    Configuration& configuration = Configuration::getInstance();
+    configuration.setConditionLimite(ConditionLimite::Periodique);
+    configuration.setForces(true, false, false);
+    configuration.setSorties(false);
+    configuration.setLd(10, 10, 0);
+    configuration.setRCut(2.5);
+    configuration.setDelta(0.001);
+    configuration.setTFinal(tFinal);
+    configuration.setFichierReprise("");
+}
+
+/* Adresse d'un fichier de test dans le dossier temporaire */
+static std::string adresseTemporaire(const std::string& nomFichier){
+    return (std::filesystem::temp_directory_path() / nomFichier).string();
+}
+
+/* Ajouter un petit réseau de particules en mouvement */
+static void remplirUnivers(Univers& univers){
+    for(int i = 0; i < 4; i++){
+        for(int j = 0; j < 4; j++){
+            Particule particule("A", -2 + 1.2*i, -2 + 1.2*j, 0, 0.3*(j - 1.5), -0.2*(i - 1.5), 0, 1 + 0.1*i);
+            univers.ajouterParticule(particule);
+        }
+    }
+}
+
+/* Récupérer les particules de la grille triées par identifiant */
+static std::vector<Particule*> particulesTriees(const Univers& univers){
+    std::vector<Particule*> particules;
+    for(const auto& cellule : univers.getGrille()){
+        for(const auto particule : cellule.getParticules()){
+            particules.push_back(particule);
+        }
+    }
+    std::sort(particules.begin(), particules.end(), [](Particule* a, Particule* b){ return a->getId() < b->getId(); });
+    return particules;
+}
+
+TEST(RepriseTest, testRepriseIdentiqueAuBitPres){
+
+    /* Simulation de référence sans interruption */
+    configurerSimulation(0.4);
+    Univers universReference;
+    remplirUnivers(universReference);
+    Simulation simulationReference(universReference);
+    simulationReference.stromerVerlet();
+
+    /* Simulation interrompue à mi-parcours avec un point de reprise */
+    configurerSimulation(0.2);
+    Univers universInterrompu;
+    remplirUnivers(universInterrompu);
+    Simulation simulationInterrompue(universInterrompu);
+    simulationInterrompue.stromerVerlet();
+    const std::string adresseReprise = adresseTemporaire("reprise_test.bin");
+    simulationInterrompue.sauvegarderPointDeReprise(adresseReprise);
+
+    /* Reprise jusqu'au temps final */
+    configurerSimulation(0.4);
+    Configuration::getInstance().setFichierReprise(adresseReprise);
+    Univers universRepris;
+    Simulation simulationReprise(universRepris);
+    ASSERT_EQ(simulationReprise.getIteration(), simulationInterrompue.getIteration());
+    ASSERT_EQ(particulesTriees(universRepris).front()->getId(), particulesTriees(universInterrompu).front()->getId());
+    simulationReprise.stromerVerlet();
+    Configuration::getInstance().setFichierReprise("");
+    std::remove(adresseReprise.c_str());
+
+    /* Comparer les états au bit près, les identifiants des deux univers
+    étant attribués dans le même ordre */
+    std::vector<Particule*> reference = particulesTriees(universReference);
+    std::vector<Particule*> reprise = particulesTriees(universRepris);
+    ASSERT_EQ(simulationReprise.getIteration(), simulationReference.getIteration());
+    ASSERT_EQ(reference.size(), reprise.size());
+    for(size_t k = 0; k < reference.size(); k++){
+        ASSERT_EQ(reference[k]->getCategorie(), reprise[k]->getCategorie());
+        ASSERT_EQ(reference[k]->getPosition(), reprise[k]->getPosition());
+        ASSERT_EQ(reference[k]->getVitesse(), reprise[k]->getVitesse());
+        ASSERT_EQ(reference[k]->getForce(), reprise[k]->getForce());
+    }
+}
+
+TEST(RepriseTest, testRepriseAvecSourceEtAbsorption){
+#ifdef CELLULE_COLONIE
+    GTEST_SKIP() << "Les emplacements libres d'une colonie ne sont pas sauvegardés";
+#endif
+    const std::string adresseSources = adresseTemporaire("test_reprise_sources.txt");
+    {
+        std::ofstream fichier(adresseSources);
+        fichier << "SOURCE X- 60 40 3 0\nSOURCE X+ 30 400 0 0\n";
+    }
+
+    /* Les particules injectées sortent par les bords absorbants, celles
+    de la face X+ dès leur injection : les emplacements libérés sont
+    réutilisés ou compactés, et le vecteur des particules est réalloué */
+    auto configurerOuvert = [&](double tFinal){
+        configurerSimulation(tFinal);
+        Configuration& configuration = Configuration::getInstance();
+        configuration.setConditionLimite(ConditionLimite::Absorption);
+        configuration.setFichierSources(adresseSources);
+        configuration.setIntervalleCompaction(7);
+    };
+
+    configurerOuvert(0.54);
+    Univers universReference;
+    remplirUnivers(universReference);
+    Simulation simulationReference(universReference);
+    simulationReference.stromerVerlet();
+
+    configurerOuvert(0.27);
+    Univers universInterrompu;
+    remplirUnivers(universInterrompu);
+    Simulation simulationInterrompue(universInterrompu);
+    simulationInterrompue.stromerVerlet();
+    const std::string adresseReprise = adresseTemporaire("reprise_sources.bin");
+    simulationInterrompue.sauvegarderPointDeReprise(adresseReprise);
+
+    /* La dernière particule injectée a déjà été absorbée */
+    ASSERT_LT(particulesTriees(universInterrompu).back()->getId() + 1, universInterrompu.getProchainId());
+
+    configurerOuvert(0.54);
+    Configuration::getInstance().setFichierReprise(adresseReprise);
+    Univers universRepris;
+    Simulation simulationReprise(universRepris);
+    ASSERT_EQ(universRepris.getProchainId(), universInterrompu.getProchainId());
+    simulationReprise.stromerVerlet();
+
+    Configuration::getInstance().setFichierReprise("");
+    Configuration::getInstance().setFichierSources("");
+    Configuration::getInstance().setIntervalleCompaction(1000);
+    std::remove(adresseSources.c_str());
+    std::remove(adresseReprise.c_str());
+
+    /* Des particules ont été absorbées, dont les dernières injectées */
+    std::vector<Particule*> reference = particulesTriees(universReference);
+    std::vector<Particule*> reprise = particulesTriees(universRepris);
+    ASSERT_LT(reference.size(), static_cast<size_t>(universReference.getProchainId() - 1));
+    ASSERT_EQ(universRepris.getProchainId(), universReference.getProchainId());
+    ASSERT_EQ(reference.size(), reprise.size());
+    for(size_t k = 0; k < reference.size(); k++){
+        ASSERT_EQ(reference[k]->getId(), reprise[k]->getId());
+        ASSERT_EQ(reference[k]->getPosition(), reprise[k]->getPosition());
+        ASSERT_EQ(reference[k]->getVitesse(), reprise[k]->getVitesse());
+        ASSERT_EQ(reference[k]->getForce(), reprise[k]->getForce());
+    }
+}
+
+TEST(RepriseTest, testConfigurationDifferente){
+    configurerSimulation(0.01);
+    Univers univers;
+    remplirUnivers(univers);
+    Simulation simulation(univers);
+    simulation.stromerVerlet();
+    const std::string adresseReprise = adresseTemporaire("reprise_configuration.bin");
+    simulation.sauvegarderPointDeReprise(adresseReprise);
+
+    /* Changer un paramètre physique puis tenter la reprise */
+    configurerSimulation(0.02);
+    Configuration::getInstance().setDelta(0.002);
+    Configuration::getInstance().setFichierReprise(adresseReprise);
+    Univers universRepris;
+    ASSERT_THROW(Simulation simulationReprise(universRepris), std::invalid_argument);
+    Configuration::getInstance().setFichierReprise("");
+    std::remove(adresseReprise.c_str());
+}
+
+TEST(RepriseTest, testHashParametresDeTrajectoire){
+
+    /* Chaque paramètre qui modifie la trajectoire modifie l'empreinte,
+    y compris les 32 bits de poids fort de la graine */
+    Configuration& configuration = Configuration::getInstance();
+    configurerSimulation(0.01);
+    const uint64_t reference = configuration.calculerHash();
+    configuration.setSubdivisionCellules(2);
+    ASSERT_NE(configuration.calculerHash(), reference);
+    configuration.setSubdivisionCellules(1);
+    configuration.setDeterministe(true);
+    ASSERT_NE(configuration.calculerHash(), reference);
+    configuration.setDeterministe(false);
+    configuration.setIntervalleCompaction(10);
+    ASSERT_NE(configuration.calculerHash(), reference);
+    configuration.setIntervalleCompaction(1000);
+    configuration.setGraine(1ULL << 40);
+    ASSERT_NE(configuration.calculerHash(), reference);
+    configuration.setGraine(0);
+    ASSERT_EQ(configuration.calculerHash(), reference);
+}
+
+TEST(RepriseTest, testHashFichiersObstaclesEtSources){
+    Configuration& configuration = Configuration::getInstance();
+    configurerSimulation(0.01);
+
+    /* Les deux adresses ne se confondent pas une fois concaténées */
+    configuration.setFichierObstacles("ab");
+    configuration.setFichierSources("");
+    const uint64_t separes = configuration.calculerHash();
+    configuration.setFichierObstacles("a");
+    configuration.setFichierSources("b");
+    ASSERT_NE(configuration.calculerHash(), separes);
+
+    /* Modifier le fichier de sources sans changer son adresse modifie l'empreinte */
+    const std::string adresse = (std::filesystem::temp_directory_path() / "test_hash_sources.txt").string();
+    {
+        std::ofstream fichier(adresse);
+        fichier << "SOURCE X- 60 40 3 0\n";
+    }
+    configuration.setFichierObstacles("");
+    configuration.setFichierSources(adresse);
+    const uint64_t avant = configuration.calculerHash();
+    {
+        std::ofstream fichier(adresse);
+        fichier << "SOURCE X- 60 40 4 0\n";
+    }
+    ASSERT_NE(configuration.calculerHash(), avant);
+
+    configuration.setFichierSources("");
+    std::remove(adresse.c_str());
+}
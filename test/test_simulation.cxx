@@ -1,5 +1,19 @@
 #include <gtest/gtest.h>
+#include <filesystem>
+#include <map>
 #include "simulation.hxx"
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+#ifdef GRAND_SYSTEME
+/* Les vitesses et les forces sont stockées en simple précision ; la
+conservation des petits déplacements est vérifiée par testDeriveLongueDuree */
+const double TOLERANCE_POSITION = 1e-5;
+#else
+/* Les deux demi-pas de vitesse ne sont exacts qu'aux arrondis près */
+const double TOLERANCE_POSITION = 1e-12;
+#endif
 
 TEST(SimulationTest, testCasDeuxCorps){
     
@@ -7,7 +21,7 @@ TEST(SimulationTest, testCasDeuxCorps){
     Configuration& configuration = Configuration::getInstance();
     configuration.setConditionLimite(ConditionLimite::Absorption);
     configuration.setForces(false, true, false);
-    configuration.setNomDossier("test");
+    configuration.setSorties(false);
     configuration.setDelta(0.005);
     configuration.setTFinal(0.04);
     configuration.setLd(3, 3, 0);
@@ -25,7 +39,7 @@ TEST(SimulationTest, testCasDeuxCorps){
 
     const Cellule& cellule = univers.getCelluleParIndices(0,0,0);
     Particule* particulePtr1 = cellule.getParticules().front();
-    Particule* particulePtr2 = cellule.getParticules().back();
+    Particule* particulePtr2 = *std::next(cellule.getParticules().begin());
 
     Vecteur<double> ldM = -univers.getLd() / 2;
     univers.deplacerParticule(particulePtr1, ldM);
@@ -40,8 +54,7 @@ TEST(SimulationTest, testCasDeuxCorps){
     ASSERT_EQ(particulePtr2->getPosition().getX() - (-0.658758) > -0.000001, true);
     ASSERT_EQ(particulePtr2->getPosition().getX() - (-0.658758) < 0.000001, true);
 
-    ASSERT_EQ(particulePtr2->getPosition().getY() - (-0.0629929) > -0.0000001, true);
-    ASSERT_EQ(particulePtr2->getPosition().getY() - (-0.0629929) < 0.0000001, true);
+    ASSERT_NEAR(particulePtr2->getPosition().getY(), -0.0629929, std::max(0.0000001, TOLERANCE_POSITION));
 
 }
 
@@ -51,7 +64,7 @@ TEST(SimulationTest, testCasChuteCorp){
     Configuration& configuration = Configuration::getInstance();
     configuration.setConditionLimite(ConditionLimite::Absorption);
     configuration.setForces(false, false, true);
-    configuration.setNomDossier("test");
+    configuration.setSorties(false);
     configuration.setLd(2, 20, 0);
     configuration.setDelta(0.005);
     configuration.setTFinal(1);
@@ -71,6 +84,191 @@ TEST(SimulationTest, testCasChuteCorp){
     Vecteur<double> ldM = -univers.getLd() / 2;
     univers.deplacerParticule(particulePtr, ldM);
 
-    ASSERT_EQ(particulePtr->getPosition().getY(), 3);
+    ASSERT_NEAR(particulePtr->getPosition().getY(), 3, TOLERANCE_POSITION);
+
+}
+
+TEST(SimulationTest, testDeriveLongueDuree){
+
+    /* Une particule libre loin de l'origine, sur 20000 petits pas */
+    Configuration& configuration = Configuration::getInstance();
+    configuration.setConditionLimite(ConditionLimite::Absorption);
+    configuration.setForces(false, false, false);
+    configuration.setSorties(false);
+    configuration.setLd(300, 10, 0);
+    configuration.setDelta(0.00005);
+    configuration.setTFinal(0.00005 * 19999.5);
+    configuration.setRCut(2.5);
+
+    Univers univers;
+
+    Particule particule("A", -25,0,0, 0.75,0,0, 1);
+    univers.ajouterParticule(particule);
+
+    Simulation simulation(univers);
+    simulation.stromerVerlet();
+    ASSERT_EQ(simulation.getIteration(), 20000);
+
+    /* Chaque déplacement de 3.75e-5 doit être conservé près de x = 125 */
+    const Particule* finale = nullptr;
+    for(const auto& cellule : univers.getGrille()){
+        for(const auto particulePtr : cellule.getParticules()){
+            finale = particulePtr;
+        }
+    }
+    ASSERT_NE(finale, nullptr);
+    ASSERT_NEAR(finale->getPosition().getX(), 125 + 0.75 * 0.00005 * 20000, 1e-8);
+    ASSERT_DOUBLE_EQ(finale->getPosition().getY(), 5);
+}
+
+TEST(SimulationTest, testSortiesEtCollectionPVD){
+
+    /* Établir la configuration de l'univers avec des sorties VTU cadencées en temps */
+    Configuration& configuration = Configuration::getInstance();
+    configuration.setConditionLimite(ConditionLimite::Absorption);
+    configuration.setForces(false, true, false);
+    configuration.setSorties(true);
+    const std::string dossier = (std::filesystem::temp_directory_path() / "sorties_test").string();
+    configuration.setNomDossier(dossier);
+    configuration.setIntervallesSortie(0, 0, 0, 0.01);
+    configuration.setDelta(0.005);
+    configuration.setTFinal(0.04);
+    configuration.setLd(3, 3, 0);
+    configuration.setRCut(3);
+
+    Univers univers;
+    Particule particule("A", 0,0,0, 0,1,0, 1);
+    univers.ajouterParticule(particule);
+
+    {
+        Simulation simulation(univers);
+        simulation.stromerVerlet();
+    }
+    configuration.setSorties(false);
+
+    /* Une entrée par centième de temps simulé, le journal étant désactivé */
+    std::ifstream fichier(dossier + "/simulation.pvd");
+    ASSERT_TRUE(fichier.is_open());
+    std::string ligne;
+    std::vector<std::string> fichiers;
+    while(std::getline(fichier, ligne)){
+        if(ligne.find("<DataSet") != std::string::npos){
+            fichiers.push_back(ligne.substr(ligne.find("file=\"") + 6));
+        }
+    }
+    ASSERT_EQ(fichiers.size(), 4u);
+    ASSERT_EQ(fichiers[1], "Iteration.2.vtu\"/>");
+    ASSERT_FALSE(std::ifstream(dossier + "/simulation.csv").is_open());
+    std::filesystem::remove_all(dossier);
+}
+
+TEST(SimulationTest, testSousCellulesMemeTrajectoire){
+
+    /* Un liquide de Lennard-Jones périodique simulé avec des cellules de côté rCut puis rCut/2 */
+    Configuration& configuration = Configuration::getInstance();
+    configuration.setConditionLimite(ConditionLimite::Periodique);
+    configuration.setForces(true, false, false);
+    configuration.setSorties(false);
+    configuration.setLd(10, 10, 10);
+    configuration.setRCut(2.5);
+    configuration.setDelta(0.0005);
+    configuration.setTFinal(0.01);
+
+    std::map<IdentifiantParticule, Vecteur<double>> positions[2];
+    uint64_t paires[2];
+    for(int essai = 0; essai < 2; essai++){
+        configuration.setSubdivisionCellules(essai + 1);
+        Univers univers;
+
+        /* Réseau de 6x6x6 particules espacées de 5/3, aux vitesses variées */
+        for(int i = 0; i < 216; i++){
+            Particule particule("A", (i % 6) * 5.0/3 - 4.5, (i / 6 % 6) * 5.0/3 - 4.5, (i / 36) * 5.0/3 - 4.5,
+                                std::sin(i), std::cos(3*i), std::sin(7*i), 1);
+            univers.ajouterParticule(particule);
+        }
+        Simulation simulation(univers);
+        simulation.stromerVerlet();
+        paires[essai] = Chronometrage::getInstance().getCompteur(Compteur::PairesEvaluees);
+        for(const auto& cellule : univers.getGrille()){
+            for(const auto particule : cellule.getParticules()){
+                positions[essai][particule->getId()] = particule->getPosition();
+            }
+        }
+    }
+    configuration.setSubdivisionCellules(1);
+
+    /* Seul l'ordre des sommes de forces change */
+    ASSERT_EQ(positions[0].size(), 216u);
+    ASSERT_EQ(positions[1].size(), 216u);
+    for(const auto& [id, position] : positions[0]){
+        ASSERT_NEAR(position.getX(), positions[1][id].getX(), 1e-6 + TOLERANCE_POSITION);
+        ASSERT_NEAR(position.getY(), positions[1][id].getY(), 1e-6 + TOLERANCE_POSITION);
+        ASSERT_NEAR(position.getZ(), positions[1][id].getZ(), 1e-6 + TOLERANCE_POSITION);
+    }
+
+#ifdef AVEC_CHRONOMETRAGE
+    /* Des cellules deux fois plus petites évaluent moins de paires */
+    ASSERT_LT(paires[1], paires[0] * 3 / 4);
+#endif
+}
+
+TEST(SimulationTest, testModeDeterministe){
+
+    /* Le liquide de Lennard-Jones périodique, dont la vitesse est limitée à la première itération */
+    Configuration& configuration = Configuration::getInstance();
+    configuration.setConditionLimite(ConditionLimite::Periodique);
+    configuration.setForces(true, false, false);
+    configuration.setLimiterVitesse(true, 20);
+    configuration.setSorties(false);
+    configuration.setLd(10, 10, 10);
+    configuration.setRCut(2.5);
+    configuration.setDelta(0.0005);
+    configuration.setTFinal(0.01);
+
+    /* Essais : mode par défaut, puis mode déterministe avec 1 et 4 threads */
+    std::map<IdentifiantParticule, Vecteur<double>> positions[3];
+    uint64_t paires[3];
+    for(int essai = 0; essai < 3; essai++){
+        configuration.setDeterministe(essai > 0);
+#ifdef _OPENMP
+        int nombreThreads = omp_get_max_threads();
+        omp_set_num_threads(essai == 2 ? 4 : 1);
+#endif
+        Univers univers;
+        for(int i = 0; i < 216; i++){
+            Particule particule("A", (i % 6) * 5.0/3 - 4.5, (i / 6 % 6) * 5.0/3 - 4.5, (i / 36) * 5.0/3 - 4.5,
+                                std::sin(i), std::cos(3*i), std::sin(7*i), 1);
+            univers.ajouterParticule(particule);
+        }
+        Simulation simulation(univers);
+        simulation.stromerVerlet();
+#ifdef _OPENMP
+        omp_set_num_threads(nombreThreads);
+#endif
+        paires[essai] = Chronometrage::getInstance().getCompteur(Compteur::PairesEvaluees);
+        for(const auto& cellule : univers.getGrille()){
+            for(const auto particule : cellule.getParticules()){
+                positions[essai][particule->getId()] = particule->getPosition();
+            }
+        }
+    }
+    configuration.setDeterministe(false);
+    configuration.setLimiterVitesse(false, 0.005);
+
+    /* Le mode déterministe ne diffère du mode par défaut que par l'ordre
+    des sommes, et ne dépend pas du nombre de threads */
+    ASSERT_EQ(positions[1].size(), 216u);
+    ASSERT_EQ(positions[2].size(), 216u);
+    for(const auto& [id, position] : positions[1]){
+        ASSERT_NEAR(position.getX(), positions[0][id].getX(), 1e-6 + TOLERANCE_POSITION);
+        ASSERT_NEAR(position.getY(), positions[0][id].getY(), 1e-6 + TOLERANCE_POSITION);
+        ASSERT_NEAR(position.getZ(), positions[0][id].getZ(), 1e-6 + TOLERANCE_POSITION);
+        ASSERT_EQ(position, positions[2][id]);
+    }
 
+#ifdef AVEC_CHRONOMETRAGE
+    /* Chaque paire est évaluée depuis ses deux particules */
+    ASSERT_EQ(paires[1], 2 * paires[0]);
+    ASSERT_EQ(paires[2], paires[1]);
+#endif
 }
@@ -0,0 +1,26 @@
+#include <gtest/gtest.h>
+#include <cmath>
+#include <vector>
+#include "sommation.hxx"
+
+TEST(SommationTest, testSommeExacte){
+    std::vector<double> valeurs;
+    for(int i = 1; i <= 1000; i++){
+        valeurs.push_back(i);
+    }
+    ASSERT_EQ(sommerParPaires(valeurs.data(), valeurs.size()), 500500);
+    ASSERT_EQ(sommerParPaires(valeurs.data(), 3), 6);
+    ASSERT_EQ(sommerParPaires(valeurs.data(), 0), 0);
+}
+
+TEST(SommationTest, testErreurArrondi){
+
+    /* Un million de dixièmes : la somme séquentielle perd environ 1e-6, la somme par paires moins de 1e-9 */
+    std::vector<double> valeurs(1000000, 0.1);
+    double sequentielle = 0;
+    for(double valeur : valeurs){
+        sequentielle += valeur;
+    }
+    ASSERT_GT(std::abs(sequentielle - 100000), 1e-7);
+    ASSERT_LT(std::abs(sommerParPaires(valeurs.data(), valeurs.size()) - 100000), 1e-9);
+}
@@ -0,0 +1,108 @@
+#include <gtest/gtest.h>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include "simulation.hxx"
+
+/* Adresse d'un fichier de test dans le dossier temporaire */
+static std::string adresseTemporaire(const std::string& nomFichier){
+    return (std::filesystem::temp_directory_path() / nomFichier).string();
+}
+
+TEST(SourcesTest, testLectureFichier){
+    const std::string adresseSources = adresseTemporaire("test_sources.txt");
+    {
+        std::ofstream fichier(adresseSources);
+        fichier << "# Sources de test\n\nSOURCE X- 100 1 0 0\nSOURCE Y+ 2.5 0 -1 0 2 B\n";
+    }
+
+    Sources sources(Vecteur<double>(10, 10, 0), 0.5, 0);
+    sources.lireFichier(adresseSources);
+    ASSERT_EQ(sources.getSources().size(), 2u);
+    ASSERT_EQ(sources.getSources()[0].face, FaceSource::XMin);
+    ASSERT_EQ(sources.getSources()[0].masse, 1);
+    ASSERT_EQ(sources.getSources()[1].face, FaceSource::YMax);
+    ASSERT_EQ(sources.getSources()[1].vitesse, Vecteur<double>(0, -1, 0));
+    ASSERT_EQ(sources.getSources()[1].categorie, "B");
+
+    /* Une face d'un axe de longueur nulle est refusée avec le numéro de ligne */
+    {
+        std::ofstream fichier(adresseSources);
+        fichier << "SOURCE X+ 1 0 0 0\nSOURCE Z- 1 0 0 0\n";
+    }
+    try{
+        sources.lireFichier(adresseSources);
+        FAIL();
+    }catch(const std::invalid_argument& erreur){
+        ASSERT_NE(std::string(erreur.what()).find("ligne 2"), std::string::npos);
+    }
+
+    std::remove(adresseSources.c_str());
+}
+
+TEST(SourcesTest, testDebitEtPositions){
+    Configuration& configuration = Configuration::getInstance();
+    configuration.setConditionLimite(ConditionLimite::Absorption);
+    configuration.setFichierObstacles("");
+    configuration.setLd(10, 10, 0);
+    configuration.setRCut(2.5);
+
+    Univers univers;
+    univers.remplirCellules();
+
+    /* Un débit de 0.3 particule par itération en injecte 3 en 10 itérations */
+    Sources sources(univers.getLd(), 0.5, 7);
+    sources.ajouterSource({FaceSource::XMax, 30, Vecteur<double>(-1, 0, 0), 1, "A"});
+    int64_t injectees = 0;
+    for(int i = 0; i < 10; i++){
+        injectees += sources.injecter(univers, i, 0.01);
+    }
+    ASSERT_EQ(injectees, 3);
+    ASSERT_EQ(univers.getNombreParticules(), 3);
+
+    /* Les particules sont sur la face x = ldX, à des ordonnées tirées */
+    for(const auto& cellule : univers.getGrille()){
+        for(const auto particule : cellule.getParticules()){
+            ASSERT_DOUBLE_EQ(particule->getPosition().getX(), 9.5);
+            ASSERT_GE(particule->getPosition().getY(), 0);
+            ASSERT_LT(particule->getPosition().getY(), 10);
+            ASSERT_EQ(particule->getPosition().getZ(), 0);
+            ASSERT_EQ(particule->getVitesse(), Vecteur<double>(-1, 0, 0));
+        }
+    }
+}
+
+TEST(SourcesTest, testSystemeOuvertAMemoireConstante){
+    const std::string adresseSources = adresseTemporaire("test_sources_ouvert.txt");
+    {
+        std::ofstream fichier(adresseSources);
+        fichier << "SOURCE X- 40 20 0 0\n";
+    }
+
+    Configuration& configuration = Configuration::getInstance();
+    configuration.setConditionLimite(ConditionLimite::Absorption);
+    configuration.setFichierObstacles("");
+    configuration.setFichierSources(adresseSources);
+    configuration.setIntervalleCompaction(10);
+    configuration.setForces(false, false, false);
+    configuration.setSorties(false);
+    configuration.setLd(10, 10, 0);
+    configuration.setRCut(2.5);
+    configuration.setDelta(0.005);
+    configuration.setTFinal(5);
+
+    /* Les particules traversent l'univers en 0.5 : au régime établi,
+    une vingtaine sont présentes et le stockage n'en contient pas plus */
+    Univers univers;
+    Simulation simulation(univers);
+    simulation.stromerVerlet();
+    std::remove(adresseSources.c_str());
+
+    ASSERT_EQ(univers.getProchainId(), 201);
+    ASSERT_GE(univers.getNombreParticules(), 18);
+    ASSERT_LE(univers.getNombreParticules(), 21);
+    ASSERT_LE(univers.getNombreEmplacements(), 32u);
+
+    configuration.setFichierSources("");
+    configuration.setIntervalleCompaction(1000);
+}
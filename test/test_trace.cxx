@@ -0,0 +1,71 @@
+#include <gtest/gtest.h>
+#include <filesystem>
+#include <thread>
+#include "trace.hxx"
+#include "fichier.hxx"
+
+TEST(TraceTest, testPlageIterations){
+    Trace& trace = Trace::getInstance();
+    trace.activer(5, 7);
+    auto instant = std::chrono::steady_clock::now();
+
+    /* Seules les itérations 5 à 7 sont enregistrées */
+    for(int i = 0; i < 10; i++){
+        trace.setIteration(i);
+        if(trace.estEnregistree()){
+            trace.enregistrer("Kick", "phase", instant, instant + std::chrono::microseconds(i));
+        }
+    }
+    trace.desactiver();
+
+    ASSERT_FALSE(trace.estEnregistree());
+    ASSERT_EQ(trace.getNombreThreads(), 1);
+    std::vector<EvenementTrace> evenements = trace.getEvenements(0);
+    ASSERT_EQ(evenements.size(), 3u);
+    ASSERT_EQ(evenements[0].duree, 5000);
+    ASSERT_EQ(evenements[2].duree, 7000);
+}
+
+TEST(TraceTest, testTamponCirculaireParThread){
+    Trace& trace = Trace::getInstance();
+    trace.activer(0, -1, 4);
+
+    /* Le premier tampon revient au thread principal et chaque autre
+    thread obtient son propre tampon, dont les plus anciens événements sont écrasés */
+    auto enregistrer = [&trace](int n){
+        for(int k = 0; k < n; k++){
+            PorteeTrace portee("tâche", "tache");
+        }
+    };
+    std::thread thread1(enregistrer, 6);
+    thread1.join();
+    std::thread thread2(enregistrer, 3);
+    thread2.join();
+    trace.desactiver();
+
+    ASSERT_EQ(trace.getNombreThreads(), 3);
+    ASSERT_TRUE(trace.getEvenements(0).empty());
+    ASSERT_EQ(trace.getEvenements(1).size(), 4u);
+    ASSERT_EQ(trace.getEvenements(2).size(), 3u);
+    ASSERT_EQ(trace.getEvenementsPerdus(), 2u);
+}
+
+TEST(TraceTest, testEcritureJSON){
+    Trace& trace = Trace::getInstance();
+    trace.activer(0, -1);
+    {
+        PorteeTrace portee("Sortie VTU", "es");
+    }
+    trace.desactiver();
+
+    std::string adresseFichier = (std::filesystem::temp_directory_path() / "test_trace.json").string();
+    trace.ecrire(adresseFichier);
+
+    std::ifstream fichier = ouvrirFichierDEntree(adresseFichier);
+    std::string contenu((std::istreambuf_iterator<char>(fichier)), std::istreambuf_iterator<char>());
+    ASSERT_EQ(contenu.rfind("{\"displayTimeUnit\":\"ms\",\"traceEvents\":[", 0), 0u);
+    ASSERT_NE(contenu.find("\"name\":\"thread_name\""), std::string::npos);
+    ASSERT_NE(contenu.find("{\"name\":\"Sortie VTU\",\"cat\":\"es\",\"ph\":\"X\",\"pid\":1,\"tid\":0,"), std::string::npos);
+    ASSERT_EQ(contenu.substr(contenu.size() - 4), "\n]}\n");
+    std::filesystem::remove(adresseFichier);
+}
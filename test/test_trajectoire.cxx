@@ -0,0 +1,289 @@
+#include <gtest/gtest.h>
+#include <cstdio>
+#include <filesystem>
+#include "trajectoire.hxx"
+
+/* Adresse d'un fichier de test dans le dossier temporaire */
+static std::string adresseTemporaire(const std::string& nomFichier){
+    return (std::filesystem::temp_directory_path() / nomFichier).string();
+}
+
+static void configurerUnivers(){
+    Configuration& configuration = Configuration::getInstance();
+    configuration.setConditionLimite(ConditionLimite::Periodique);
+    configuration.setLd(10, 10, 0);
+    configuration.setRCut(2.5);
+}
+
+/* Remplir l'univers avec deux catégories de particules */
+static void remplirUnivers(Univers& univers){
+    for(int i = 0; i < 3; i++){
+        Particule particuleA("A", -3 + 2*i, 1, 0, 0.5*i, 0, 0, 1);
+        Particule particuleB("B", -3 + 2*i, -2, 0, 0, -0.25*i, 0, 2);
+        univers.ajouterParticule(particuleA);
+        univers.ajouterParticule(particuleB);
+    }
+    univers.remplirCellules();
+}
+
+/* Écrire trois frames en déplaçant les particules entre chacune */
+static void ecrireTrajectoire(const std::string& adresse, Univers& univers, bool avecForces){
+    EcrivainTrajectoire ecrivain(adresse, univers.getLd(), avecForces);
+    for(int frame = 0; frame < 3; frame++){
+        ecrivain.ajouterFrame(univers, frame*1000, frame*0.05);
+        for(const auto& cellule : univers.getGrille()){
+            for(const auto particule : cellule.getParticules()){
+                particule->setPosition(particule->getPosition() + Vecteur<double>(0.1, 0, 0));
+                particule->setForce(Vecteur<double>(frame, 1, 0));
+            }
+        }
+    }
+}
+
+TEST(TrajectoireTest, testEcritureEtLecture){
+    const std::string adresse = adresseTemporaire("trajectoire_test.traj");
+    configurerUnivers();
+    Univers univers;
+    remplirUnivers(univers);
+    ecrireTrajectoire(adresse, univers, true);
+
+    LecteurTrajectoire lecteur(adresse);
+    ASSERT_EQ(lecteur.getNombreFrames(), 3u);
+    ASSERT_EQ(lecteur.getLd(), univers.getLd());
+
+    /* Accéder directement à la dernière frame */
+    FrameTrajectoire frame = lecteur.lireFrame(2);
+    ASSERT_EQ(frame.iteration, 2000);
+    ASSERT_DOUBLE_EQ(frame.temps, 0.1);
+    ASSERT_EQ(frame.nombreParticules, 6u);
+    ASSERT_NE(frame.forces, nullptr);
+    ASSERT_EQ(frame.nomsCategories.size(), 2u);
+
+    /* Comparer avec l'état de l'univers avant le dernier déplacement */
+    for(uint64_t k = 0; k < frame.nombreParticules; k++){
+        const std::string& categorie = frame.nomsCategories[frame.categories[k]];
+        ASSERT_TRUE(categorie == "A" || categorie == "B");
+        ASSERT_FLOAT_EQ(frame.masses[k], categorie == "A" ? 1 : 2);
+        ASSERT_FLOAT_EQ(frame.forces[3*k], 1);
+        ASSERT_FLOAT_EQ(frame.forces[3*k + 1], 1);
+        ASSERT_NEAR(frame.positions[3*k + 1], categorie == "A" ? 1 : -2, 1e-5);
+    }
+    ASSERT_THROW(lecteur.lireFrame(3), std::out_of_range);
+    std::remove(adresse.c_str());
+}
+
+TEST(TrajectoireTest, testSansForces){
+    const std::string adresse = adresseTemporaire("trajectoire_sans_forces.traj");
+    configurerUnivers();
+    Univers univers;
+    remplirUnivers(univers);
+    ecrireTrajectoire(adresse, univers, false);
+
+    LecteurTrajectoire lecteur(adresse);
+    ASSERT_EQ(lecteur.getNombreFrames(), 3u);
+    ASSERT_EQ(lecteur.lireFrame(0).forces, nullptr);
+    ASSERT_EQ(lecteur.getIndex()[1].iteration, 1000);
+    std::remove(adresse.c_str());
+}
+
+TEST(TrajectoireTest, testRecuperationSansIndex){
+    const std::string adresse = adresseTemporaire("trajectoire_tronquee.traj");
+    configurerUnivers();
+    Univers univers;
+    remplirUnivers(univers);
+    ecrireTrajectoire(adresse, univers, false);
+
+    /* Supprimer l'index et le pied de page comme après un arrêt brutal */
+    uint64_t fin;
+    {
+        LecteurTrajectoire lecteur(adresse);
+        fin = lecteur.getFinFrame(2);
+    }
+    ASSERT_EQ(truncate(adresse.c_str(), fin - 8), 0);
+
+    LecteurTrajectoire lecteur(adresse);
+    ASSERT_EQ(lecteur.getNombreFrames(), 2u);
+    ASSERT_EQ(lecteur.lireFrame(1).iteration, 1000);
+    std::remove(adresse.c_str());
+}
+
+/* Remplacer un entier de 64 bits à une position du fichier */
+static void ecraser(const std::string& adresse, std::streamoff position, uint64_t valeur){
+    std::fstream fichier(adresse, std::ios::in | std::ios::out | std::ios::binary);
+    fichier.seekp(position);
+    fichier.write(reinterpret_cast<const char*>(&valeur), sizeof(valeur));
+}
+
+TEST(TrajectoireTest, testIndexCorrompu){
+    const std::string adresse = adresseTemporaire("trajectoire_corrompue.traj");
+    configurerUnivers();
+    Univers univers;
+    remplirUnivers(univers);
+    ecrireTrajectoire(adresse, univers, false);
+
+    struct stat info;
+    ASSERT_EQ(stat(adresse.c_str(), &info), 0);
+    const std::streamoff taille = info.st_size;
+    const std::streamoff pied = taille - 24;
+    const std::streamoff derniereEntree = pied - sizeof(EntreeIndexTrajectoire);
+
+    /* Une entrée qui désigne la table d'index elle-même */
+    ecraser(adresse, derniereEntree, derniereEntree);
+    ASSERT_THROW(LecteurTrajectoire lecteur(adresse), std::invalid_argument);
+
+    /* Un nombre de frames dont la taille de la table déborde */
+    ecrireTrajectoire(adresse, univers, false);
+    ecraser(adresse, pied + 8, (UINT64_MAX / sizeof(EntreeIndexTrajectoire)) + 2);
+    ASSERT_THROW(LecteurTrajectoire lecteur(adresse), std::invalid_argument);
+    std::remove(adresse.c_str());
+}
+
+TEST(TrajectoireTest, testReprise){
+    const std::string adresse = adresseTemporaire("trajectoire_reprise.traj");
+    configurerUnivers();
+    Univers univers;
+    remplirUnivers(univers);
+    ecrireTrajectoire(adresse, univers, false);
+
+    /* Reprendre à l'itération 1000 : la frame 1000 est réécrite */
+    {
+        EcrivainTrajectoire ecrivain(adresse, univers.getLd(), false, 1000);
+        ecrivain.ajouterFrame(univers, 1000, 0.05);
+        ecrivain.ajouterFrame(univers, 2000, 0.1);
+        ecrivain.ajouterFrame(univers, 3000, 0.15);
+    }
+
+    LecteurTrajectoire lecteur(adresse);
+    ASSERT_EQ(lecteur.getNombreFrames(), 4u);
+    for(size_t k = 0; k < 4; k++){
+        ASSERT_EQ(lecteur.lireFrame(k).iteration, static_cast<int64_t>(k*1000));
+    }
+    std::remove(adresse.c_str());
+}
+
+TEST(TrajectoireTest, testConversionEnVTU){
+    const std::string adresse = adresseTemporaire("trajectoire_conversion.traj");
+    const std::string dossier = adresseTemporaire("trajectoire_vtu");
+    configurerUnivers();
+    Univers univers;
+    remplirUnivers(univers);
+    ecrireTrajectoire(adresse, univers, false);
+    convertirTrajectoireEnVTU(adresse, dossier);
+
+    std::ifstream fichier(dossier + "/Iteration.2000.vtu");
+    ASSERT_TRUE(fichier.good());
+    std::remove(adresse.c_str());
+    std::remove(dossier.c_str());
+    std::filesystem::remove_all(dossier);
+}
+
+TEST(TrajectoireTest, testCodageVarintZigzag){
+    std::vector<char> flux;
+    const int64_t valeurs[] = {0, -1, 1, 63, -64, 300, -123456789, INT64_MAX, INT64_MIN};
+    for(int64_t valeur : valeurs){
+        ajouterVarint(flux, encoderZigzag(valeur));
+    }
+    ASSERT_EQ(flux[0], 0);
+    ASSERT_EQ(flux[1], 1);
+
+    const char* curseur = flux.data();
+    for(int64_t valeur : valeurs){
+        ASSERT_EQ(decoderZigzag(lireVarint(curseur, flux.data() + flux.size())), valeur);
+    }
+    ASSERT_THROW(lireVarint(curseur, flux.data() + flux.size()), std::invalid_argument);
+}
+
+TEST(TrajectoireTest, testCompression){
+    const std::string adresseBrute = adresseTemporaire("trajectoire_brute.traj");
+    const std::string adresseCompressee = adresseTemporaire("trajectoire_compressee.traj");
+    configurerUnivers();
+    Univers univers;
+    remplirUnivers(univers);
+
+    /* Écrire la même suite de frames, brute puis compressée avec une image clé sur trois */
+    ecrireTrajectoire(adresseBrute, univers, true);
+    Univers universCompresse;
+    remplirUnivers(universCompresse);
+    {
+        EcrivainTrajectoire ecrivain(adresseCompressee, universCompresse.getLd(), true);
+        ecrivain.activerCompression(1e-4, 3);
+        for(int frame = 0; frame < 7; frame++){
+            ecrivain.ajouterFrame(universCompresse, frame*1000, frame*0.05);
+            for(const auto& cellule : universCompresse.getGrille()){
+                for(const auto particule : cellule.getParticules()){
+                    particule->setPosition(particule->getPosition() + Vecteur<double>(0.1, 0, 0));
+                    particule->setForce(Vecteur<double>(frame, 1, 0));
+                }
+            }
+        }
+    }
+
+    LecteurTrajectoire brute(adresseBrute);
+    LecteurTrajectoire compressee(adresseCompressee);
+    ASSERT_EQ(compressee.getNombreFrames(), 7u);
+
+    /* Accès direct puis séquentiel, les frames étant triées par identifiant */
+    for(size_t k : {2u, 1u, 0u, 1u, 2u, 5u, 6u}){
+        FrameTrajectoire frame = compressee.lireFrame(k);
+        ASSERT_EQ(frame.iteration, static_cast<int64_t>(k*1000));
+        ASSERT_EQ(frame.nombreParticules, 6u);
+        for(uint64_t p = 0; p < frame.nombreParticules; p++){
+            if(p > 0){
+                ASSERT_LT(frame.ids[p - 1], frame.ids[p]);
+            }
+            const std::string& categorie = frame.nomsCategories[frame.categories[p]];
+            ASSERT_FLOAT_EQ(frame.masses[p], categorie == "A" ? 1 : 2);
+            ASSERT_NEAR(frame.positions[3*p + 1], categorie == "A" ? 1 : -2, 1e-4);
+            if(k > 0){
+                ASSERT_FLOAT_EQ(frame.forces[3*p], k - 1);
+            }
+        }
+
+        /* Comparer aux positions de la trajectoire brute, particule par particule */
+        if(k < 3){
+            FrameTrajectoire reference = brute.lireFrame(k);
+            for(uint64_t p = 0; p < reference.nombreParticules; p++){
+                for(uint64_t q = 0; q < frame.nombreParticules; q++){
+                    if(reference.ids[p] == frame.ids[q]){
+                        ASSERT_NEAR(reference.positions[3*p], frame.positions[3*q], 1e-4);
+                        ASSERT_NEAR(reference.vitesses[3*p + 1], frame.vitesses[3*q + 1], 1e-4);
+                    }
+                }
+            }
+        }
+    }
+    std::remove(adresseBrute.c_str());
+    std::remove(adresseCompressee.c_str());
+}
+
+TEST(TrajectoireTest, testCompressionParticuleAbsorbee){
+    const std::string adresse = adresseTemporaire("trajectoire_absorption.traj");
+    Configuration& configuration = Configuration::getInstance();
+    configuration.setConditionLimite(ConditionLimite::Absorption);
+    configuration.setLd(10, 10, 0);
+    configuration.setRCut(2.5);
+    Univers univers;
+    remplirUnivers(univers);
+    {
+        EcrivainTrajectoire ecrivain(adresse, univers.getLd(), false);
+        ecrivain.activerCompression(1e-3, 10);
+        ecrivain.ajouterFrame(univers, 0, 0);
+
+        /* Faire sortir une particule de l'univers */
+        Particule* particule = nullptr;
+        for(const auto& cellule : univers.getGrille()){
+            if(!cellule.getParticules().empty()){
+                particule = *cellule.getParticules().begin();
+                break;
+            }
+        }
+        univers.deplacerParticule(particule, Vecteur<double>(-20, 0, 0));
+        univers.corrigerCellules();
+        ecrivain.ajouterFrame(univers, 1000, 0.05);
+    }
+
+    LecteurTrajectoire lecteur(adresse);
+    ASSERT_EQ(lecteur.lireFrame(0).nombreParticules, 6u);
+    ASSERT_EQ(lecteur.lireFrame(1).nombreParticules, 5u);
+    std::remove(adresse.c_str());
+}
@@ -1,4 +1,5 @@
 #include <gtest/gtest.h>
+#include <algorithm>
 #include "univers.hxx"
 
 TEST(UniversTest, testConstructorAndGetters){
@@ -40,19 +41,19 @@ TEST(UniversTest, testConstructorAndGetters){
         }
 
         if(bords == 0){
-            ASSERT_EQ(cellule.getVoisines().size(), 27);
+            ASSERT_EQ(univers.getVoisines(cellule).size(), 27);
         }
 
         if(bords == 1){
-            ASSERT_EQ(cellule.getVoisines().size(), 18);
+            ASSERT_EQ(univers.getVoisines(cellule).size(), 18);
         }
 
         if(bords == 2){
-            ASSERT_EQ(cellule.getVoisines().size(), 12);
+            ASSERT_EQ(univers.getVoisines(cellule).size(), 12);
         }
 
         if(bords == 3){
-            ASSERT_EQ(cellule.getVoisines().size(), 8);
+            ASSERT_EQ(univers.getVoisines(cellule).size(), 8);
         }
 
     }
@@ -183,3 +184,385 @@ TEST(UniversTest, testCorrigerCellules){
     ASSERT_EQ(*nouvelleCellule.getParticules().begin(), particuleStockee);  
     
 }
+
+TEST(UniversTest, testStencilDeuxCellulesParAxe){
+    Configuration& configuration = Configuration::getInstance();
+    configuration.setLd(5, 5, 5);
+    configuration.setRCut(2.5);
+
+    /* En condition périodique, l'autre cellule d'un axe est visitée deux fois, avec deux translations */
+    configuration.setConditionLimite(ConditionLimite::Periodique);
+    Univers universPeriodique;
+    ASSERT_EQ(universPeriodique.getStencil().size(), 27u);
+    for(const auto& cellule : universPeriodique.getGrille()){
+        std::vector<const Cellule*> voisines = universPeriodique.getVoisines(cellule);
+        ASSERT_EQ(std::set<const Cellule*>(voisines.begin(), voisines.end()).size(), 8u);
+        std::set<std::pair<const Cellule*, double>> images;
+        universPeriodique.pourChaqueVoisine(cellule, [&](const Cellule& voisine, const Vecteur<double>& translation){
+            images.insert({&voisine, translation.getX() + 100 * translation.getY() + 10000 * translation.getZ()});
+        });
+        ASSERT_EQ(images.size(), 27u);
+    }
+
+    /* Sans repliement, chaque cellule voit les sept autres et elle-même */
+    configuration.setConditionLimite(ConditionLimite::Absorption);
+    Univers univers;
+    for(const auto& cellule : univers.getGrille()){
+        ASSERT_EQ(univers.getVoisines(cellule).size(), 8u);
+    }
+}
+
+TEST(UniversTest, testStencilPeriodiqueEtGrandeGrille){
+    Configuration& configuration = Configuration::getInstance();
+    configuration.setConditionLimite(ConditionLimite::Periodique);
+    configuration.setLd(10, 12.5, 15);
+    configuration.setRCut(2.5);
+
+    /* Les voisines des cellules du bord et de l'intérieur sont les 27 cellules attendues */
+    Univers univers;
+    const Vecteur<int>& nc = univers.getNc();
+    for(const auto& cellule : univers.getGrille()){
+        const Vecteur<int>& indices = cellule.getIndices();
+        std::set<const Cellule*> attendues;
+        for(int dx = -1; dx <= 1; dx++){
+            for(int dy = -1; dy <= 1; dy++){
+                for(int dz = -1; dz <= 1; dz++){
+                    int x = (indices.getX() + dx + nc.getX()) % nc.getX();
+                    int y = (indices.getY() + dy + nc.getY()) % nc.getY();
+                    int z = (indices.getZ() + dz + nc.getZ()) % nc.getZ();
+                    attendues.insert(&univers.getGrille()[x*nc.getY()*nc.getZ() + y*nc.getZ() + z]);
+                }
+            }
+        }
+        std::vector<const Cellule*> voisines = univers.getVoisines(cellule);
+        ASSERT_EQ(voisines.size(), 27u);
+        ASSERT_EQ(std::set<const Cellule*>(voisines.begin(), voisines.end()), attendues);
+    }
+
+    /* Une grille d'un million de cellules ne stocke aucune voisine */
+    configuration.setLd(250, 250, 250);
+    Univers grandUnivers;
+    grandUnivers.mesurerMemoire();
+    ASSERT_EQ(grandUnivers.getGrille().size(), 1000000u);
+    ASSERT_LT(Memoire::getInstance().getOctets(PosteMemoire::Voisines), 1024u);
+}
+
+TEST(UniversTest, testPairesDuStencil){
+    Configuration& configuration = Configuration::getInstance();
+    configuration.setRCut(2.5);
+    configuration.setGraine(3);
+
+    /* Quelles que soient la condition limite, la subdivision et la taille de
+    la grille, les paires à portée trouvées par le stencil et ses translations
+    sont exactement celles de l'image minimale */
+    for(ConditionLimite condition : {ConditionLimite::Periodique, ConditionLimite::Absorption}){
+        for(int subdivision : {1, 2, 3}){
+            for(double longueur : {12.5, 5.0}){
+                configuration.setConditionLimite(condition);
+                configuration.setSubdivisionCellules(subdivision);
+                configuration.setLd(longueur, longueur, longueur);
+                Univers univers;
+                univers.ajouterParticulesAleatoires(200);
+                univers.remplirCellules();
+
+                int pairesMinimales = 0;
+                std::vector<Particule*> toutes;
+                for(const auto& cellule : univers.getGrille()){
+                    toutes.insert(toutes.end(), cellule.getParticules().begin(), cellule.getParticules().end());
+                }
+                for(Particule* a : toutes){
+                    for(Particule* b : toutes){
+                        pairesMinimales += a->getId() > b->getId() && univers.calculerVecteurDirection(a, b).norme() < univers.getRCut();
+                    }
+                }
+
+                int pairesTranslatees = 0;
+                for(const auto& cellule : univers.getGrille()){
+                    for(const auto a : cellule.getParticules()){
+                        univers.pourChaqueVoisine(cellule, [&](const Cellule& voisine, const Vecteur<double>& translation){
+                            for(const auto b : voisine.getParticules()){
+                                Vecteur<double> direction = b->getPosition() - a->getPosition() + translation;
+                                if(a->getId() > b->getId() && direction.norme() < univers.getRCut()){
+                                    pairesTranslatees++;
+                                    ASSERT_EQ(direction, univers.calculerVecteurDirection(a, b));
+                                }
+                            }
+                        });
+                    }
+                }
+                ASSERT_EQ(toutes.size(), 200u);
+                ASSERT_GT(pairesMinimales, 0);
+                ASSERT_EQ(pairesTranslatees, pairesMinimales);
+            }
+        }
+    }
+    configuration.setSubdivisionCellules(1);
+    configuration.setGraine(0);
+}
+
+TEST(UniversTest, testSousCellules){
+    Configuration& configuration = Configuration::getInstance();
+    configuration.setConditionLimite(ConditionLimite::Absorption);
+    configuration.setRCut(2.5);
+
+    /* Les cellules pavent exactement l'univers : la tranche au-delà de nc*rCut n'est plus perdue */
+    configuration.setLd(10, 11, 0);
+    Univers univers;
+    ASSERT_EQ(univers.getNc(), Vecteur<int>(4, 4, 1));
+    ASSERT_EQ(univers.getTailleCellule(), Vecteur<double>(2.5, 2.75, 0));
+    ASSERT_EQ(univers.getIndiceCellule(Vecteur<double>(1, 10.9, 0)), 3);
+    ASSERT_EQ(univers.getIndiceCellule(Vecteur<double>(1, 11, 0)), -1);
+    ASSERT_EQ(univers.getIndiceCellule(Vecteur<double>(std::nextafter(10.0, 0.0), 1, 0)), 12);
+
+    /* Avec k = 2, aucune des 125 cellules n'est trop loin ; avec k = 3, les 32 coins
+    dont deux décalages valent 3 et le troisième au moins 2 sont écartés */
+    configuration.setLd(11, 11, 11);
+    configuration.setSubdivisionCellules(2);
+    Univers universK2;
+    ASSERT_EQ(universK2.getNc(), Vecteur<int>(8, 8, 8));
+    ASSERT_EQ(universK2.getStencil().size(), 125u);
+    configuration.setSubdivisionCellules(3);
+    Univers universK3;
+    ASSERT_EQ(universK3.getNc(), Vecteur<int>(13, 13, 13));
+    ASSERT_EQ(universK3.getStencil().size(), 343u - 32u);
+
+    /* Une cellule intérieure voit tout le stencil, une cellule de coin les 4x4x4
+    décalages positifs moins les 4 coins écartés */
+    const Cellule& interieure = universK3.getCelluleParIndices(6, 6, 6);
+    const Cellule& coin = universK3.getCelluleParIndices(0, 0, 0);
+    ASSERT_FALSE(interieure.isBord());
+    ASSERT_TRUE(universK3.getCelluleParIndices(2, 6, 6).isBord());
+    ASSERT_EQ(universK3.getVoisines(interieure).size(), 311u);
+    ASSERT_EQ(universK3.getVoisines(coin).size(), 4u*4u*4u - 4u);
+
+    /* Subdivision hors limites et longueur inférieure à rCut */
+    configuration.setSubdivisionCellules(Univers::subdivisionMaximale + 1);
+    ASSERT_THROW(Univers(), std::invalid_argument);
+    configuration.setSubdivisionCellules(2);
+    configuration.setLd(2, 10, 10);
+    ASSERT_THROW(Univers(), std::invalid_argument);
+    configuration.setSubdivisionCellules(1);
+}
+
+TEST(UniversTest, testIdentifiantsAttribuesParUnivers){
+
+    /* Établir la configuration de l'univers */
+    Configuration& configuration = Configuration::getInstance();
+    configuration.setConditionLimite(ConditionLimite::Periodique);
+    configuration.setLd(10, 10, 10);
+    configuration.setRCut(2.5);
+
+    /* Chaque univers numérote ses particules à partir de 1 */
+    for(int k = 0; k < 2; k++){
+        Univers univers;
+        Particule particule(0, 0, 0);
+        univers.ajouterParticule(particule);
+        ASSERT_EQ(particule.getId(), 1);
+    }
+
+    /* Un identifiant fourni est conservé et les suivants le dépassent */
+    Univers univers;
+    Particule particule(0, 0, 0);
+    particule.setId(int64_t(3) << 32);
+    univers.ajouterParticule(particule);
+    univers.ajouterParticulesAleatoires(3);
+    univers.remplirCellules();
+
+    std::vector<IdentifiantParticule> ids;
+    for(const auto& cellule : univers.getGrille()){
+        for(const Particule* p : cellule.getParticules()){
+            ids.push_back(p->getId());
+        }
+    }
+    std::sort(ids.begin(), ids.end());
+    std::vector<IdentifiantParticule> attendus = {int64_t(3) << 32, (int64_t(3) << 32) + 1, (int64_t(3) << 32) + 2, (int64_t(3) << 32) + 3};
+    ASSERT_EQ(ids, attendus);
+    ASSERT_EQ(univers.getNombreParticules(), 4);
+}
+
+TEST(UniversTest, testDeriverEtCorrigerCellulesSignalees){
+
+    /* Établir la configuration de l'univers */
+    Configuration& configuration = Configuration::getInstance();
+    configuration.setConditionLimite(ConditionLimite::Absorption);
+    configuration.setLd(10, 10, 10);
+    configuration.setRCut(2.5);
+
+    Univers univers;
+
+    /* Trois particules dans la cellule (0, 0, 0) */
+    Particule particule1(-4.5, -4.5, -4.5);
+    Particule particule2(-4, -4, -4);
+    Particule particule3(-3.5, -3.5, -3.5);
+    univers.ajouterParticule(particule1);
+    univers.ajouterParticule(particule2);
+    univers.ajouterParticule(particule3);
+    univers.remplirCellules();
+    ASSERT_EQ(univers.getCelluleParIndices(0, 0, 0).getParticules().size(), 3u);
+
+    /* La première reste, la deuxième change de cellule et la troisième sort de la grille */
+    size_t indice = univers.getIndiceCellule(Vecteur<double>(0.5, 0.5, 0.5));
+    ASSERT_EQ(indice, 0u);
+    std::vector<Particule*> particules(univers.getCelluleParIndices(0, 0, 0).getParticules().begin(), 
+                                        univers.getCelluleParIndices(0, 0, 0).getParticules().end());
+    std::sort(particules.begin(), particules.end(), [](Particule* a, Particule* b){ return a->getId() < b->getId(); });
+    univers.deriverParticule(indice, particules[0], Vecteur<double>(0.1, 0, 0));
+    univers.deriverParticule(indice, particules[1], Vecteur<double>(2, 0, 0));
+    univers.deriverParticule(indice, particules[2], Vecteur<double>(0, -2, 0));
+    ASSERT_TRUE(particules[0]->isCelluleConfirmee());
+    ASSERT_FALSE(particules[1]->isCelluleConfirmee());
+
+    univers.corrigerCellulesSignalees();
+    ASSERT_EQ(univers.getCelluleParIndices(0, 0, 0).getParticules().size(), 1u);
+    ASSERT_EQ(univers.getCelluleParIndices(1, 0, 0).getParticules().size(), 1u);
+    ASSERT_EQ(univers.getNombreParticules(), 2);
+    ASSERT_EQ(univers.getIndiceCellule(Vecteur<double>(-0.1, 1, 1)), -1);
+    ASSERT_EQ(univers.getIndiceCellule(Vecteur<double>(1, 10, 1)), -1);
+}
+
+/* Vérifie que chaque particule des cellules est dans la cellule de sa position et renvoie leurs identifiants */
+static std::vector<IdentifiantParticule> verifierCellules(const Univers& univers){
+    std::vector<IdentifiantParticule> ids;
+    const std::vector<Cellule>& grille = univers.getGrille();
+    for(size_t c = 0; c < grille.size(); c++){
+        for(const auto particule : grille[c].getParticules()){
+            EXPECT_EQ(univers.getIndiceCellule(particule->getPosition()), static_cast<int>(c));
+            ids.push_back(particule->getId());
+        }
+    }
+    std::sort(ids.begin(), ids.end());
+    return ids;
+}
+
+TEST(UniversTest, testCompacterParticulesAbsorbees){
+
+    /* Établir la configuration de l'univers */
+    Configuration& configuration = Configuration::getInstance();
+    configuration.setConditionLimite(ConditionLimite::Absorption);
+    configuration.setLd(10, 10, 10);
+    configuration.setRCut(2.5);
+
+    Univers univers;
+
+    /* Six particules alignées, d'abscisses 0.5 à 5.5 dans le repère de la grille */
+    for(int i = 0; i < 6; i++){
+        Particule particule(i - 4.5, 0, 0);
+        univers.ajouterParticule(particule);
+    }
+    univers.remplirCellules();
+
+    /* Faire sortir de la grille les particules 1 et 3 */
+    const std::vector<Cellule>& grille = univers.getGrille();
+    for(size_t c = 0; c < grille.size(); c++){
+        std::vector<Particule*> particules(grille[c].getParticules().begin(), grille[c].getParticules().end());
+        for(Particule* particule : particules){
+            bool sortie = particule->getId() == 1 || particule->getId() == 3;
+            univers.deriverParticule(c, particule, Vecteur<double>(0, sortie ? -6 : 0, 0));
+        }
+    }
+    univers.corrigerCellulesSignalees();
+    ASSERT_EQ(univers.getNombreParticules(), 4);
+    ASSERT_EQ(univers.getNombreEmplacements(), 6u);
+
+    /* La compaction libère les emplacements, sans changer les identifiants ni les positions */
+    univers.compacterParticules();
+    ASSERT_EQ(univers.getNombreEmplacements(), 4u);
+    ASSERT_EQ(verifierCellules(univers), std::vector<IdentifiantParticule>({2, 4, 5, 6}));
+    for(const auto& cellule : grille){
+        for(const auto particule : cellule.getParticules()){
+            ASSERT_EQ(particule->getPosition().getX(), particule->getId() - 0.5);
+        }
+    }
+}
+
+/* Obtenir les identifiants d'une cellule dans l'ordre de son conteneur */
+static std::vector<IdentifiantParticule> ordreCellule(const Cellule& cellule){
+    std::vector<IdentifiantParticule> ids;
+    for(const auto particule : cellule.getParticules()){
+        ids.push_back(particule->getId());
+    }
+    return ids;
+}
+
+TEST(UniversTest, testOrdreDesCellulesConserve){
+
+    /* Établir la configuration de l'univers */
+    Configuration& configuration = Configuration::getInstance();
+    configuration.setConditionLimite(ConditionLimite::Absorption);
+    configuration.setLd(10, 10, 10);
+    configuration.setRCut(2.5);
+
+    Univers univers;
+    for(int i = 0; i < 6; i++){
+        Particule particule(-4.9 + 0.3 * i, -4, -4);
+        univers.ajouterParticule(particule);
+    }
+    univers.remplirCellules();
+    const Cellule& cellule = univers.getCelluleParIndices(0, 0, 0);
+
+    /* Absorber la particule 2 : l'ordre de la cellule diffère alors de celui du stockage */
+    for(const auto particule : std::vector<Particule*>(cellule.getParticules().begin(), cellule.getParticules().end())){
+        univers.deriverParticule(0, particule, Vecteur<double>(0, particule->getId() == 2 ? -2 : 0, 0));
+    }
+    univers.corrigerCellulesSignalees();
+
+    /* Chaque injection, qui réutilise l'emplacement libre puis réalloue
+    le stockage, ajoute une particule sans réordonner les autres */
+    for(int i = 0; i < 40; i++){
+        std::vector<IdentifiantParticule> avant = ordreCellule(cellule);
+        ASSERT_TRUE(univers.injecterParticule(Particule(0.1 + 0.05 * i, 1, 1)));
+        std::vector<IdentifiantParticule> apres = ordreCellule(cellule);
+        apres.erase(std::find(apres.begin(), apres.end(), univers.getProchainId() - 1));
+        ASSERT_EQ(apres, avant);
+    }
+
+    /* La compaction déplace des particules dans le stockage, pas dans la cellule */
+    for(const auto particule : std::vector<Particule*>(cellule.getParticules().begin(), cellule.getParticules().end())){
+        univers.deriverParticule(0, particule, Vecteur<double>(0, particule->getId() % 3 == 0 ? -2 : 0, 0));
+    }
+    univers.corrigerCellulesSignalees();
+    std::vector<IdentifiantParticule> avant = ordreCellule(cellule);
+    univers.compacterParticules();
+    ASSERT_EQ(univers.getNombreEmplacements(), avant.size());
+    ASSERT_EQ(ordreCellule(cellule), avant);
+}
+
+TEST(UniversTest, testInjecterParticule){
+
+    /* Établir la configuration de l'univers */
+    Configuration& configuration = Configuration::getInstance();
+    configuration.setConditionLimite(ConditionLimite::Absorption);
+    configuration.setLd(10, 10, 10);
+    configuration.setRCut(2.5);
+
+    Univers univers;
+    Particule particule(-4, -4, -4);
+    univers.ajouterParticule(particule);
+    univers.remplirCellules();
+
+    /* Absorber la particule */
+    Particule* stockee = *univers.getCelluleParIndices(0, 0, 0).getParticules().begin();
+    univers.deriverParticule(0, stockee, Vecteur<double>(-2, 0, 0));
+    univers.corrigerCellulesSignalees();
+    ASSERT_EQ(univers.getNombreParticules(), 0);
+
+    /* L'injection réutilise son emplacement et attribue un nouvel identifiant */
+    ASSERT_TRUE(univers.injecterParticule(Particule(1, 6, 1)));
+    ASSERT_EQ(univers.getNombreEmplacements(), 1u);
+    ASSERT_EQ(univers.getNombreParticules(), 1);
+    ASSERT_EQ(*univers.getCelluleParIndices(0, 2, 0).getParticules().begin(), stockee);
+    ASSERT_EQ(stockee->getId(), 2);
+
+    /* Une position hors de la grille est refusée */
+    ASSERT_FALSE(univers.injecterParticule(Particule(1, 11, 1)));
+
+    /* Les réallocations du vecteur des particules ne laissent aucun pointeur invalide */
+    for(int i = 0; i < 100; i++){
+        ASSERT_TRUE(univers.injecterParticule(Particule(0.1 * i, 5, 5)));
+    }
+    ASSERT_EQ(univers.getNombreParticules(), 101);
+    std::vector<IdentifiantParticule> ids = verifierCellules(univers);
+    ASSERT_EQ(ids.size(), 101u);
+    ASSERT_EQ(ids.front(), 2);
+    ASSERT_EQ(ids.back(), 102);
+}